@@ -26,7 +26,7 @@
  * @author: Joachim Redies
  * @author: Ulrich Loup
  * @since: 2011-11-12
- * @version: 2012-05-14
+ * @version: 2026-10-18
  */
 
 #include "settings.h"
@@ -54,6 +54,7 @@ namespace GiNaCRA
         mIsComplete( false ),
         mSetting( CADSettings::getSettings() )
     {
+        UnivariatePolynomialPool::acquire();
         // initialize root
         mSampleTree.insert( mSampleTree.begin(), RealAlgebraicNumberPtr() );    // empty root node!!
     }
@@ -67,6 +68,7 @@ namespace GiNaCRA
         mIsComplete( false ),
         mSetting( setting )
     {
+        UnivariatePolynomialPool::acquire();
         // settings (need to be set before every other process because of VariableListPool)
         if( mSetting.simplifyByGroebner() )
         {
@@ -89,12 +91,44 @@ namespace GiNaCRA
             mEliminationSets[0].push_back( pNewVar );
             currentEliminationSet.insert( pNewVar );
         }
+        // *** CADSettings: simplifyByFactorization
+        if( mSetting.simplifyByFactorization() )
+        {
+            currentEliminationSet = factorization( currentEliminationSet );
+            mEliminationSets[0]   = vector<UnivariatePolynomial>( currentEliminationSet.begin(), currentEliminationSet.end() );
+        }
+        // *** /CADSettings: simplifyByFactorization
+        // *** CADSettings: simplifyByGcdFreeBasis
+        if( mSetting.simplifyByGcdFreeBasis() )
+        {
+            currentEliminationSet = gcdFreeBasis( currentEliminationSet );
+            mEliminationSets[0]   = vector<UnivariatePolynomial>( currentEliminationSet.begin(), currentEliminationSet.end() );
+        }
+        // *** /CADSettings: simplifyByGcdFreeBasis
         sort( mEliminationSets[0].begin(), mEliminationSets[0].end(), mSetting.mUP_isLess );
+        ProjectionOperator      projection         = mSetting.mProjectionOperator;
+        UnivariatePolynomialSet baseEliminationSet = currentEliminationSet;
         // this loop does nothing if we have univariate polynomials
         for( unsigned i = 1; i != dim; ++i )
         {    // perform elimination of level i-1
+            if( (projection == MCCALLUM_PROJECTIONOPERATOR || projection == BROWN_PROJECTIONOPERATOR)
+                    && !wellOriented( currentEliminationSet, dim - i, i == 1 ))
+            {    // the reduced operators are only applicable if every level is well-oriented, so the whole tower is recomputed by Hong's operator
+                projection            = HONG_PROJECTIONOPERATOR;
+                currentEliminationSet = baseEliminationSet;
+                i                     = 0;
+                continue;
+            }
             // position i of mEliminationSets corresponds to variable i-1 (current main variable) eliminated in position i-1 of mEliminationSets
-            currentEliminationSet = eliminationSet( currentEliminationSet, mVariables[i] );
+            currentEliminationSet = eliminationSet( currentEliminationSet, mVariables[i], mSetting.mSubresultantStrategy, projection, dim - i );
+            // *** CADSettings: simplifyByFactorization
+            if( mSetting.simplifyByFactorization() )
+                currentEliminationSet = factorization( currentEliminationSet );
+            // *** /CADSettings: simplifyByFactorization
+            // *** CADSettings: simplifyByGcdFreeBasis
+            if( mSetting.simplifyByGcdFreeBasis() )
+                currentEliminationSet = gcdFreeBasis( currentEliminationSet );
+            // *** /CADSettings: simplifyByGcdFreeBasis
             vector<UnivariatePolynomial> currentEliminationList( currentEliminationSet.begin(), currentEliminationSet.end() );
             // *** CADSettings: simplifyBySquarefreeing
             if( mSetting.simplifyBySquarefreeing() )
@@ -207,26 +241,45 @@ namespace GiNaCRA
     ///////////////////////////
 
     const UnivariatePolynomialSet CAD::eliminationSet( const UnivariatePolynomialSet& polynomials,
-                                                       const symbol& nextVariable )
+                                                       const symbol& nextVariable,
+                                                       UnivariatePolynomial::subresultantStrategy strategy,
+                                                       ProjectionOperator projection,
+                                                       unsigned dimension )
             throw ( invalid_argument )
     {
         if( polynomials.empty() )
             return polynomials;
-        UnivariatePolynomialSet eliminatedPolynomials = UnivariatePolynomialSet();
-        symbol x                                      = polynomials.variable();
+        symbol x = polynomials.variable();
         assert( (ex)nextVariable != x );    // Next variable must not equal the main variable of the set!
+        UnivariatePolynomialSet projected = polynomials;
+        if( projection != HONG_PROJECTIONOPERATOR )    // the reduced operators work on a square-free basis
+            projected = gcdFreeBasis( polynomials );
+        if( projection == BROWN_PROJECTIONOPERATOR && dimension != 1 )    // leading coefficients might vanish on cells of positive dimension
+            projection = MCCALLUM_PROJECTIONOPERATOR;
+        // polynomials coinciding up to a rational factor have the same projection, so it suffices to eliminate their canonical representatives
+        vector<unsigned> ids = vector<unsigned>();
+        for( UnivariatePolynomialSet::const_iterator it = projected.begin(); it != projected.end(); ++it )
+            ids.push_back( UnivariatePolynomialPool::intern( *it ));
+        sort( ids.begin(), ids.end() );
+        ids.erase( std::unique( ids.begin(), ids.end() ), ids.end() );
+        std::set<unsigned> eliminatedIds = std::set<unsigned>();
         // !PAIRED:
-        for( UnivariatePolynomialSet::const_iterator it1 = polynomials.begin(); it1 != polynomials.end(); ++it1 )
-            elimination( *it1, nextVariable, eliminatedPolynomials );
+        for( vector<unsigned>::const_iterator id1 = ids.begin(); id1 != ids.end(); ++id1 )
+            cachedElimination( vector<unsigned>( 1, *id1 ), nextVariable, eliminatedIds, strategy, projection );
         // PAIRED:
-        for( UnivariatePolynomialSet::const_iterator pol_it1 = polynomials.begin(); pol_it1 != polynomials.end(); ++pol_it1 )
+        for( vector<unsigned>::const_iterator id1 = ids.begin(); id1 != ids.end(); ++id1 )
         {
-            UnivariatePolynomialSet::const_iterator it2 = pol_it1;
-            ++it2;    // guarantees pol_it1 != it2
-            for( ; it2 != polynomials.end(); ++it2 )
-                elimination( *pol_it1, *it2, nextVariable, eliminatedPolynomials );
+            vector<unsigned> pairIds = vector<unsigned>( 2, *id1 );
+            for( vector<unsigned>::const_iterator id2 = id1 + 1; id2 != ids.end(); ++id2 )
+            {
+                pairIds[1] = *id2;
+                cachedElimination( pairIds, nextVariable, eliminatedIds, strategy, projection );
+            }
         }
-        eliminatedPolynomials = eliminatedPolynomials.makePrimitive();
+        // makePrimitive would not change the canonical representatives
+        UnivariatePolynomialSet eliminatedPolynomials = UnivariatePolynomialSet();
+        for( std::set<unsigned>::const_iterator id = eliminatedIds.begin(); id != eliminatedIds.end(); ++id )
+            eliminatedPolynomials.insert( UnivariatePolynomialPool::polynomial( *id ));
         eliminatedPolynomials.removeNumbers();
         return eliminatedPolynomials;
     }
@@ -260,6 +313,10 @@ namespace GiNaCRA
         vector<symbol> variablesIR = vector<symbol>( variables.size() );    // shall contain the variable indices corresponding to the components of rInterval
         int j = 0;
         ex pEx = p;
+        // *** CADSettings: Lazard's evaluation
+        if( settings.mProjectionOperator == LAZARD_PROJECTIONOPERATOR )
+            pEx = lazardEvaluation( p, sample, variables );
+        // *** /CADSettings: Lazard's evaluation
         list<RealAlgebraicNumberPtr>::const_iterator sampleValue = sample.begin();
         list<symbol>::const_iterator                 variable    = variables.begin();
         // Preprocessing: substitute all NumericRepresentation occurrences of r directly
@@ -309,7 +366,11 @@ namespace GiNaCRA
     // ATOMIC METHODS //
     ////////////////////
 
-    void CAD::elimination( const UnivariatePolynomial& p, const symbol& variable, UnivariatePolynomialSet& eliminated ) throw ( invalid_argument )
+    void CAD::elimination( const UnivariatePolynomial& p,
+                           const symbol& variable,
+                           UnivariatePolynomialSet& eliminated,
+                           UnivariatePolynomial::subresultantStrategy strategy )
+                           throw ( invalid_argument )
     {
         UnivariatePolynomialSet truncations = CAD::truncation( p );
         for( UnivariatePolynomialSet::const_iterator it2 = truncations.begin(); it2 != truncations.end(); ++it2 )
@@ -318,7 +379,7 @@ namespace GiNaCRA
             UnivariatePolynomial it2Diff = it2->diff();
             if( !it2Diff.isZero() )
             {
-                vector<ex> subresultants = UnivariatePolynomial::principalSubresultantCoefficients( *it2, it2Diff );
+                vector<ex> subresultants = UnivariatePolynomial::principalSubresultantCoefficients( *it2, it2Diff, strategy );
                 for( int i = 0; i <= it2->degree() - 2 || i == 0; ++i )
                     for( vector<ex>::const_iterator i = subresultants.begin(); i != subresultants.end(); ++i )
                         eliminated.insert( UnivariatePolynomial( *i, variable ));
@@ -329,18 +390,109 @@ namespace GiNaCRA
     void CAD::elimination( const UnivariatePolynomial& p,
                            const UnivariatePolynomial& q,
                            const symbol& variable,
-                           UnivariatePolynomialSet& eliminated )
+                           UnivariatePolynomialSet& eliminated,
+                           UnivariatePolynomial::subresultantStrategy strategy )
                            throw ( invalid_argument )
     {
         UnivariatePolynomialSet truncations = CAD::truncation( p );
         for( UnivariatePolynomialSet::const_iterator it1 = truncations.begin(); it1 != truncations.end(); ++it1 )
         {
-            vector<ex> subresultants = UnivariatePolynomial::principalSubresultantCoefficients( *it1, q );
+            vector<ex> subresultants = UnivariatePolynomial::principalSubresultantCoefficients( *it1, q, strategy );
             for( vector<ex>::const_iterator i = subresultants.begin(); i != subresultants.end(); ++i )
                 eliminated.insert( UnivariatePolynomial( *i, variable ));
         }
     }
 
+    void CAD::cachedElimination( const vector<unsigned>& ids,
+                                 const symbol& variable,
+                                 std::set<unsigned>& eliminated,
+                                 UnivariatePolynomial::subresultantStrategy strategy,
+                                 ProjectionOperator projection )
+                                 throw ( invalid_argument )
+    {
+        UnivariatePolynomialPool::Key key = UnivariatePolynomialPool::Key( 1, (unsigned)projection );
+        key.push_back( (unsigned)strategy );
+        key.push_back( UnivariatePolynomialPool::intern( UnivariatePolynomial( variable, variable )));
+        key.insert( key.end(), ids.begin(), ids.end() );
+        vector<unsigned> result;
+        if( !UnivariatePolynomialPool::cached( key, result ))
+        {
+            UnivariatePolynomialSet projected = UnivariatePolynomialSet();
+            UnivariatePolynomial    p         = UnivariatePolynomialPool::polynomial( ids.front() );
+            UnivariatePolynomial    q         = UnivariatePolynomialPool::polynomial( ids.back() );
+            if( projection == MCCALLUM_PROJECTIONOPERATOR && ids.size() == 1 )
+                mcCallumElimination( p, variable, projected );
+            else if( projection == BROWN_PROJECTIONOPERATOR && ids.size() == 1 )
+                brownElimination( p, variable, projected );
+            else if( projection == LAZARD_PROJECTIONOPERATOR && ids.size() == 1 )
+                lazardElimination( p, variable, projected );
+            else if( projection != HONG_PROJECTIONOPERATOR )
+                mcCallumElimination( p, q, variable, projected );
+            else if( ids.size() == 1 )
+                elimination( p, variable, projected, strategy );
+            else
+                elimination( p, q, variable, projected, strategy );
+            for( UnivariatePolynomialSet::const_iterator i = projected.begin(); i != projected.end(); ++i )
+                result.push_back( UnivariatePolynomialPool::intern( *i ));
+            UnivariatePolynomialPool::cache( key, result );
+        }
+        eliminated.insert( result.begin(), result.end() );
+    }
+
+    void CAD::mcCallumElimination( const UnivariatePolynomial& p, const symbol& variable, UnivariatePolynomialSet& eliminated )
+    {
+        if( p.isConstant() )
+        {
+            eliminated.insert( UnivariatePolynomial( p, variable ));
+            return;
+        }
+        for( int d = p.degree(); d >= 0; --d )
+        {
+            ex c = p.coeff( d );
+            if( c.is_zero() )
+                continue;
+            eliminated.insert( UnivariatePolynomial( c, variable ));
+            if( GiNaC::is_exactly_a<numeric>( c ))
+                break;    // p does not vanish identically anywhere
+        }
+        if( p.degree() > 1 )
+            eliminated.insert( UnivariatePolynomial( p.resultant( p.diff() ), variable ));
+    }
+
+    void CAD::mcCallumElimination( const UnivariatePolynomial& p,
+                                   const UnivariatePolynomial& q,
+                                   const symbol& variable,
+                                   UnivariatePolynomialSet& eliminated )
+    {
+        if( !p.isConstant() && !q.isConstant() )
+            eliminated.insert( UnivariatePolynomial( p.resultant( q ), variable ));
+    }
+
+    void CAD::brownElimination( const UnivariatePolynomial& p, const symbol& variable, UnivariatePolynomialSet& eliminated )
+    {
+        if( p.isConstant() )
+        {
+            eliminated.insert( UnivariatePolynomial( p, variable ));
+            return;
+        }
+        eliminated.insert( UnivariatePolynomial( p.lcoeff(), variable ));
+        if( p.degree() > 1 )
+            eliminated.insert( UnivariatePolynomial( p.resultant( p.diff() ), variable ));
+    }
+
+    void CAD::lazardElimination( const UnivariatePolynomial& p, const symbol& variable, UnivariatePolynomialSet& eliminated )
+    {
+        if( p.isConstant() )
+        {
+            eliminated.insert( UnivariatePolynomial( p, variable ));
+            return;
+        }
+        eliminated.insert( UnivariatePolynomial( p.lcoeff(), variable ));
+        eliminated.insert( UnivariatePolynomial( p.tcoeff(), variable ));
+        if( p.degree() > 1 )
+            eliminated.insert( UnivariatePolynomial( p.resultant( p.diff() ), variable ));
+    }
+
     const SampleList CAD::samples( const list<RationalUnivariatePolynomial>& polynomials, SampleList& currentSamples ) throw ( invalid_argument )
     {
         list<RealAlgebraicNumberPtr> roots = list<RealAlgebraicNumberPtr>();
@@ -425,7 +577,7 @@ namespace GiNaCRA
                     cout << " " << *k << ( (*k)->isRoot() ? "r" : "" ) << ( (*k)->isNumeric() ? "n" : "" );
                 cout << " }:" << endl;
 #endif
-                SampleList sampls = samples( mEliminationSets[level][liftingPosition], sample, variables, currentSamples );
+                SampleList sampls = samples( mEliminationSets[level][liftingPosition], sample, variables, currentSamples, mSetting );
 #ifdef GINACRA_CAD_DEBUG
                 for( auto k = sampls.begin(); k != sampls.end(); ++k )
                     cout << " " << *k << ( (*k)->isRoot() ? "r" : "" ) << ( (*k)->isNumeric() ? "n" : "" ) << endl;
@@ -733,4 +885,153 @@ namespace GiNaCRA
         return ret;
     }
 
+    const UnivariatePolynomialSet CAD::factorization( const UnivariatePolynomialSet& P )
+    {
+        UnivariatePolynomialSet ret;
+        for( UnivariatePolynomialSet::const_iterator it = P.begin(); it != P.end(); ++it )
+        {
+            ex factored = GiNaC::factor( it->expand() );
+            // factor returns a product of powers of irreducible polynomials and a numeric factor
+            vector<ex> factors = vector<ex>( 1, factored );
+            if( GiNaC::is_exactly_a<GiNaC::mul>( factored ))
+            {
+                factors.clear();
+                for( size_t i = 0; i < factored.nops(); ++i )
+                    factors.push_back( factored.op( i ));
+            }
+            for( vector<ex>::const_iterator factor = factors.begin(); factor != factors.end(); ++factor )
+            {
+                ex base = GiNaC::is_exactly_a<GiNaC::power>( *factor ) ? factor->op( 0 ) : *factor;
+                if( !GiNaC::is_exactly_a<numeric>( base ))
+                    ret.insert( UnivariatePolynomialPool::canonical( UnivariatePolynomial( base, it->variable() )));
+            }
+        }
+        return ret;
+    }
+
+    const UnivariatePolynomialSet CAD::gcdFreeBasis( const UnivariatePolynomialSet& P ) throw ( invalid_argument )
+    {
+        list<UnivariatePolynomial> basis   = list<UnivariatePolynomial>();
+        list<UnivariatePolynomial> pending = list<UnivariatePolynomial>();
+        for( UnivariatePolynomialSet::const_iterator it = P.begin(); it != P.end(); ++it )
+        {    // the content is kept separately, because it contributes zeros as well
+            ex c = it->content();
+            if( !GiNaC::is_exactly_a<numeric>( c ))
+                pending.push_back( UnivariatePolynomial( c, it->variable() ));
+            if( !it->isConstant() )
+                pending.push_back( it->primpart( c ).sepapart() );
+        }
+        while( !pending.empty() )
+        {
+            UnivariatePolynomial a = pending.front();
+            pending.pop_front();
+            if( GiNaC::is_exactly_a<numeric>( a ))
+                continue;
+            bool coprime = true;
+            for( list<UnivariatePolynomial>::iterator b = basis.begin(); b != basis.end(); ++b )
+            {
+                UnivariatePolynomial g = a.gcd( *b );
+                if( GiNaC::is_exactly_a<numeric>( g ))
+                    continue;
+                // replace a and b by g and the cofactors, whose total degrees sum up to less than the ones of a and b
+                ex aCofactor, bCofactor;
+                if( !GiNaC::divide( a, g, aCofactor ) || !GiNaC::divide( *b, g, bCofactor ))
+                    throw invalid_argument( "The gcd of two polynomials of the set does not divide them, so the coefficients are not rational." );
+                pending.push_back( g );
+                pending.push_back( UnivariatePolynomial( aCofactor, a.variable() ));
+                pending.push_back( UnivariatePolynomial( bCofactor, a.variable() ));
+                basis.erase( b );
+                coprime = false;
+                break;
+            }
+            if( coprime )
+                basis.push_back( a );
+        }
+        UnivariatePolynomialSet ret;
+        for( list<UnivariatePolynomial>::const_iterator b = basis.begin(); b != basis.end(); ++b )
+            ret.insert( UnivariatePolynomialPool::canonical( *b ));
+        return ret;
+    }
+
+    bool CAD::wellOriented( const UnivariatePolynomialSet& P, unsigned dimension, bool first )
+    {
+        UnivariatePolynomialSet basis = gcdFreeBasis( P );
+        for( UnivariatePolynomialSet::const_iterator p = basis.begin(); p != basis.end(); ++p )
+        {
+            if( p->isConstant() )
+                continue;
+            bool nullifiable = true;
+            for( int d = p->degree(); d >= 0 && nullifiable; --d )
+                nullifiable = !GiNaC::is_exactly_a<numeric>( p->coeff( d )) || p->coeff( d ).is_zero();
+            // the coprime coefficients of a primitive polynomial vanish simultaneously at isolated points at most if at most two variables remain
+            if( nullifiable && (!first || dimension == 0 || dimension > 2) )
+                return false;
+        }
+        return true;
+    }
+
+    const ex CAD::lazardEvaluation( const UnivariatePolynomial& p,
+                                    const list<RealAlgebraicNumberPtr>& sample,
+                                    const list<symbol>& variables )
+    {
+        // if result = (variable - a)^k * g, its k-th derivative at a is k! * g(a), so no division by an algebraic number a is necessary
+        ex                               result      = p;
+        list<symbol>                     free        = list<symbol>( 1, p.variable() );    // the variables not assigned by the processed components
+        vector<RealAlgebraicNumberIRPtr> numbersIR   = vector<RealAlgebraicNumberIRPtr>();
+        vector<symbol>                   variablesIR = vector<symbol>();
+        free.insert( free.end(), variables.begin(), variables.end() );
+        // the last component of the sample is the first one lifted, so the components are processed from the base upwards
+        list<RealAlgebraicNumberPtr>::const_reverse_iterator sampleValue = sample.rbegin();
+        for( list<symbol>::const_reverse_iterator variable = variables.rbegin(); variable != variables.rend(); ++variable, ++sampleValue )
+        {
+            free.pop_back();
+            RealAlgebraicNumberNRPtr rNumeric = std::tr1::dynamic_pointer_cast<RealAlgebraicNumberNR>( *sampleValue );
+            if( rNumeric != 0 )
+            {
+                numeric a = static_cast<numeric>(*rNumeric);
+                while( result.has( *variable ) && vanishesIdentically( result.subs( *variable == a ), free, numbersIR, variablesIR ))
+                    result = result.diff( *variable ).expand();
+                result = result.subs( *variable == a ).expand();
+            }
+            else
+            {    // interval-represented components stay symbolic, the vanishing is decided in the algebraic extension by all of them
+                numbersIR.push_back( std::tr1::dynamic_pointer_cast<RealAlgebraicNumberIR>( *sampleValue ));    // cast safe here
+                variablesIR.push_back( *variable );
+                while( result.has( *variable ) && vanishesIdentically( result, free, numbersIR, variablesIR ))
+                    result = result.diff( *variable ).expand();
+            }
+        }
+        return result;
+    }
+
+    bool CAD::vanishesIdentically( const ex& p,
+                                   const list<symbol>& free,
+                                   const vector<RealAlgebraicNumberIRPtr>& numbers,
+                                   const vector<symbol>& variables )
+    {
+        // split p into its non-zero coefficients w.r.t. the free variables
+        ex       pExpanded    = p.expand();
+        list<ex> coefficients = list<ex>();
+        if( !pExpanded.is_zero() )
+            coefficients.push_back( pExpanded );
+        for( list<symbol>::const_iterator variable = free.begin(); variable != free.end(); ++variable )
+        {
+            list<ex> split = list<ex>();
+            for( list<ex>::const_iterator c = coefficients.begin(); c != coefficients.end(); ++c )
+                for( int d = c->ldegree( *variable ); d <= c->degree( *variable ); ++d )
+                    if( !c->coeff( *variable, d ).is_zero() )
+                        split.push_back( c->coeff( *variable, d ));
+            coefficients.swap( split );
+        }
+        // numeric coefficients are decided without refining the components
+        for( list<ex>::const_iterator c = coefficients.begin(); c != coefficients.end(); ++c )
+            if( GiNaC::is_exactly_a<numeric>( *c ))
+                return false;
+        for( list<ex>::const_iterator c = coefficients.begin(); c != coefficients.end(); ++c )
+            if( variables.empty()
+                    || RealAlgebraicNumberFactory::evaluateIR( UnivariatePolynomial( *c, variables.back() ), numbers, variables )->sgn() != GiNaC::ZERO_SIGN )
+                return false;
+        return true;
+    }
+
 }
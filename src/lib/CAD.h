@@ -23,7 +23,7 @@
 /**
  * @file CAD.h
  * @author Ulrich Loup
- * @version 2012-05-19
+ * @version 2026-10-18
  */
 
 #ifndef GINACRA_CAD_H
@@ -37,6 +37,7 @@
 #include "settings.h"
 #include "Constraint.h"
 #include "UnivariatePolynomialSet.h"
+#include "UnivariatePolynomialPool.h"
 #include "RealAlgebraicNumber.h"
 #include "RealAlgebraicNumberFactory.h"
 #include "RealAlgebraicPoint.h"
@@ -498,6 +499,10 @@ namespace GiNaCRA
         bool (*mUP_isLess)( const UnivariatePolynomial&, const UnivariatePolynomial& );
         /// standard strategy to be used for real root isolation
         RealAlgebraicNumberSettings::IsolationStrategy mIsolationStrategy;
+        /// strategy to be used for the subresultants in the elimination
+        UnivariatePolynomial::subresultantStrategy mSubresultantStrategy;
+        /// projection operator to be used in the elimination
+        ProjectionOperator mProjectionOperator;
 
         /////////////
         // METHODS //
@@ -532,6 +537,22 @@ namespace GiNaCRA
                 cadSettings.mSimplifyByRootcounting = true;
             if( setting & SQUAREFREEELIMINATION_CADSETTING )
                 cadSettings.mSimplifyBySquarefreeing = true;
+            if( setting & FACTORIZATION_CADSETTING )
+                cadSettings.mSimplifyByFactorization = true;
+            if( setting & GCDFREEBASIS_CADSETTING )
+                cadSettings.mSimplifyByGcdFreeBasis = true;
+            if( setting & LAZARDSSUBRESULTANTS_CADSETTING )
+                cadSettings.mSubresultantStrategy = UnivariatePolynomial::LAZARDS_SUBRESULTANTSTRATEGY;
+            if( setting & DUCOSSUBRESULTANTS_CADSETTING )
+                cadSettings.mSubresultantStrategy = UnivariatePolynomial::DUCOS_SUBRESULTANTSTRATEGY;
+            if( setting & MODULARSUBRESULTANTS_CADSETTING )
+                cadSettings.mSubresultantStrategy = UnivariatePolynomial::MODULAR_SUBRESULTANTSTRATEGY;
+            if( setting & MCCALLUMPROJECTION_CADSETTING )
+                cadSettings.mProjectionOperator = MCCALLUM_PROJECTIONOPERATOR;
+            if( setting & BROWNPROJECTION_CADSETTING )
+                cadSettings.mProjectionOperator = BROWN_PROJECTIONOPERATOR;
+            if( setting & LAZARDPROJECTION_CADSETTING )
+                cadSettings.mProjectionOperator = LAZARD_PROJECTIONOPERATOR;
             return cadSettings;
         }
 
@@ -544,6 +565,22 @@ namespace GiNaCRA
                 settingStrs.push_back( "Simplify the base elimination level by real root counting." );
             if( settings.mSimplifyBySquarefreeing )
                 settingStrs.push_back( "Simplify all elimination levels by replacing the polynomials by their square-free part." );
+            if( settings.mSimplifyByFactorization )
+                settingStrs.push_back( "Simplify all elimination levels by replacing the polynomials by their irreducible factors." );
+            if( settings.mSimplifyByGcdFreeBasis )
+                settingStrs.push_back( "Simplify all elimination levels by replacing the polynomials by a gcd-free basis." );
+            if( settings.mSubresultantStrategy == UnivariatePolynomial::LAZARDS_SUBRESULTANTSTRATEGY )
+                settingStrs.push_back( "Compute subresultants with Lazard's optimization." );
+            if( settings.mSubresultantStrategy == UnivariatePolynomial::DUCOS_SUBRESULTANTSTRATEGY )
+                settingStrs.push_back( "Compute subresultants with Lazard's and Ducos' optimizations." );
+            if( settings.mSubresultantStrategy == UnivariatePolynomial::MODULAR_SUBRESULTANTSTRATEGY )
+                settingStrs.push_back( "Compute principal subresultant coefficients modulo primes by evaluation and interpolation." );
+            if( settings.mProjectionOperator == MCCALLUM_PROJECTIONOPERATOR )
+                settingStrs.push_back( "Eliminate by McCallum's projection operator if the input is well-oriented." );
+            if( settings.mProjectionOperator == BROWN_PROJECTIONOPERATOR )
+                settingStrs.push_back( "Eliminate by Brown's projection operator in the last elimination, by McCallum's operator elsewhere." );
+            if( settings.mProjectionOperator == LAZARD_PROJECTIONOPERATOR )
+                settingStrs.push_back( "Eliminate by Lazard's projection operator and lift by Lazard's evaluation." );
             if( settings.mPreferNRSamples )
                 settingStrs.push_back( "Prefer numerics to interval representations for sample choice." );
             if( settings.mPreferSamplesByIsRoot && settings.mPreferNonrootSamples )
@@ -591,6 +628,26 @@ namespace GiNaCRA
             mSimplifyBySquarefreeing = b;
         }
 
+        bool simplifyByFactorization() const
+        {
+            return mSimplifyByFactorization;
+        }
+
+        void setSimplifyByFactorization( bool b )
+        {
+            mSimplifyByFactorization = b;
+        }
+
+        bool simplifyByGcdFreeBasis() const
+        {
+            return mSimplifyByGcdFreeBasis;
+        }
+
+        void setSimplifyByGcdFreeBasis( bool b )
+        {
+            mSimplifyByGcdFreeBasis = b;
+        }
+
         bool preferNRSamples() const
         {
             return mPreferNRSamples;
@@ -648,6 +705,10 @@ namespace GiNaCRA
             bool mSimplifyByRootcounting;
             /// flag indicating that the elimination uses square-free/separable polynomials in every level
             bool mSimplifyBySquarefreeing;
+            /// flag indicating that the elimination uses the irreducible factors of the polynomials in every level
+            bool mSimplifyByFactorization;
+            /// flag indicating that the elimination uses a gcd-free basis of the polynomials in every level
+            bool mSimplifyByGcdFreeBasis;
 
         private:
 
@@ -662,12 +723,16 @@ namespace GiNaCRA
             CADSettings():
                 mUP_isLess( UnivariatePolynomial::univariatePolynomialIsLess ),
                 mIsolationStrategy( RealAlgebraicNumberSettings::DEFAULT_ISOLATIONSTRATEGY ),
+                mSubresultantStrategy( UnivariatePolynomial::GENERIC_SUBRESULTANTSTRATEGY ),
+                mProjectionOperator( HONG_PROJECTIONOPERATOR ),
                 mPreferNRSamples( false ),
                 mPreferSamplesByIsRoot( false ),
                 mPreferNonrootSamples( false ),
                 mSimplifyByGroebner( false ),
                 mSimplifyByRootcounting( false ),
-                mSimplifyBySquarefreeing( false )
+                mSimplifyBySquarefreeing( false ),
+                mSimplifyByFactorization( false ),
+                mSimplifyByGcdFreeBasis( false )
             {}
 
     };
@@ -737,7 +802,17 @@ namespace GiNaCRA
                 mLiftingPositions( cad.mLiftingPositions ),
                 mIsComplete( cad.mIsComplete ),
                 mSetting( cad.mSetting )
-            {}
+            {
+                UnivariatePolynomialPool::acquire();
+            }
+
+            /*
+             * Destructor releasing the UnivariatePolynomialPool, which is cleared after the last CAD object is destroyed.
+             */
+            ~CAD()
+            {
+                UnivariatePolynomialPool::release();
+            }
 
             ///////////////
             // Selectors //
@@ -884,22 +959,54 @@ namespace GiNaCRA
                     newEliminationSets[i] = mEliminationSets[i - newVariableCount];
                 UnivariatePolynomialSet currentEliminationSet = UnivariatePolynomialSet( newEliminationSets[0].begin(), newEliminationSets[0].end() );
                 UnivariatePolynomialSet s                     = UnivariatePolynomialSet( first, last );    // collect the new polynomials
+                // *** CADSettings: simplifyByFactorization
+                if( mSetting.simplifyByFactorization() )
+                    s = factorization( s );
+                // *** /CADSettings: simplifyByFactorization
                 for( UnivariatePolynomialSet::const_iterator i = s.begin(); i != s.end(); ++i )
                 {    // add new polynomials to level 0, unifying their variables
                     UnivariatePolynomial pNewVar( *i, newVariables.front() );
                     newEliminationSets[0].push_back( pNewVar );
                     currentEliminationSet.insert( pNewVar );
                 }
+                // *** CADSettings: simplifyByGcdFreeBasis
+                if( mSetting.simplifyByGcdFreeBasis() )
+                {
+                    currentEliminationSet = gcdFreeBasis( currentEliminationSet );
+                    newEliminationSets[0] = vector<UnivariatePolynomial>( currentEliminationSet.begin(), currentEliminationSet.end() );
+                }
+                // *** /CADSettings: simplifyByGcdFreeBasis
                 // (3) and (4) [can be made more efficient by making use of the atomic elimination operators]
                 // Caution: The elimination is recomputed completely in case we have multivariate polynomials.
+                ProjectionOperator                    projection           = mSetting.mProjectionOperator;
+                UnivariatePolynomialSet               baseEliminationSet   = currentEliminationSet;
+                vector<vector<UnivariatePolynomial> > givenEliminationSets = newEliminationSets;
                 // this loop does nothing if we have univariate polynomials
                 for( unsigned i = 1; i != newVariables.size(); ++i )
                 {    // perform elimination of level i-1
+                    if( (projection == MCCALLUM_PROJECTIONOPERATOR || projection == BROWN_PROJECTIONOPERATOR)
+                            && !wellOriented( currentEliminationSet, newVariables.size() - i, i == 1 ))
+                    {    // the reduced operators are only applicable if every level is well-oriented, so the whole tower is recomputed by Hong's operator
+                        projection            = HONG_PROJECTIONOPERATOR;
+                        currentEliminationSet = baseEliminationSet;
+                        newEliminationSets    = givenEliminationSets;
+                        i                     = 0;
+                        continue;
+                    }
                     // position i of mEliminationSets corresponds to variable i-1 (current main variable) eliminated in position i-1 of mEliminationSets
-                    currentEliminationSet = eliminationSet( currentEliminationSet, newVariables[i] );
+                    currentEliminationSet = eliminationSet( currentEliminationSet, newVariables[i], mSetting.mSubresultantStrategy, projection,
+                                                            newVariables.size() - i );
+                    // *** CADSettings: simplifyByFactorization
+                    if( mSetting.simplifyByFactorization() )
+                        currentEliminationSet = factorization( currentEliminationSet );
+                    // *** /CADSettings: simplifyByFactorization
                     for( vector<UnivariatePolynomial>::const_iterator j = newEliminationSets[i].begin(); j != newEliminationSets[i].end();
                             ++j )    // insert possibly existing polynomials of the current level
                         currentEliminationSet.insert( *j );
+                    // *** CADSettings: simplifyByGcdFreeBasis
+                    if( mSetting.simplifyByGcdFreeBasis() )
+                        currentEliminationSet = gcdFreeBasis( currentEliminationSet );
+                    // *** /CADSettings: simplifyByGcdFreeBasis
                     vector<UnivariatePolynomial> currentEliminationList( currentEliminationSet.begin(), currentEliminationSet.end() );
                     // *** CADSettings: simplifyBySquarefreeing
                     if( mSetting.simplifyBySquarefreeing() )
@@ -953,15 +1060,48 @@ namespace GiNaCRA
 
             /**
              * Elimination/projection due to Hoon Hong ["An Improvement of the Projection Operator in Cylindrical Algebraic Decomposition", ACM, 1990.]
+             *
+             * The polynomials are interned in the UnivariatePolynomialPool, so that polynomials coinciding up to a rational factor are
+             * eliminated only once, and the eliminations of single polynomials and of pairs are cached across calls. A call outside of a CAD
+             * object does not register as a user of the pool, so the caller should clear the pool afterwards (see UnivariatePolynomialPool).
+             *
+             * With MCCALLUM_PROJECTIONOPERATOR, McCallum's projection operator is applied to a gcd-free basis of P instead, see mcCallumElimination.
+             * It is only correct if P and all sets eliminated from it are well-oriented, which the caller has to ensure (see wellOriented).
+             *
+             * With BROWN_PROJECTIONOPERATOR, Brown's operator is applied to a gcd-free basis of P if exactly one variable remains, see brownElimination.
+             * Then the leading coefficients only vanish at points. Over cells of positive dimension, Brown's method needs a check in the lifting
+             * whether a leading coefficient vanishes on the cell, which is not implemented. Hence, McCallum's operator is used in all other cases.
+             *
+             * With LAZARD_PROJECTIONOPERATOR, Lazard's operator is applied to a gcd-free basis of P, see lazardElimination. It is applicable to every
+             * input, provided that the samples are lifted by Lazard's evaluation (see samples), which is computed exactly at numeric and
+             * interval-represented sample components (see lazardEvaluation).
              * @param P set of polynomials in the variable to eliminate
              * @param nextVariable the new main variable for the returned set
+             * @param strategy the strategy for the subresultant computations (standard option is the generic algorithm)
+             * @param projection the projection operator (standard option is Hong's operator)
+             * @param dimension number of the remaining variables after the elimination, or 0 if unknown
              * @complexity O( m^2 * d^2 ) where m is the size of P and d the maximum degree of the polynomials in P
-             * @return A set of polynomials in which the main variable of P is eliminated
+             * @return A set of canonical representatives (see UnivariatePolynomialPool) in which the main variable of P is eliminated
              */
             static const UnivariatePolynomialSet eliminationSet( const UnivariatePolynomialSet& P,
-                                                                 const symbol& nextVariable )
+                                                                 const symbol& nextVariable,
+                                                                 UnivariatePolynomial::subresultantStrategy strategy = UnivariatePolynomial::GENERIC_SUBRESULTANTSTRATEGY,
+                                                                 ProjectionOperator projection = HONG_PROJECTIONOPERATOR,
+                                                                 unsigned dimension = 0 )
                     throw ( invalid_argument );
 
+            /**
+             * Checks whether McCallum's operator may be applied to P, i.e., whether no polynomial of a gcd-free basis of P vanishes identically
+             * on a cell of positive dimension in the space of the remaining variables. This is excluded for a polynomial not containing the main
+             * variable or having a non-zero constant coefficient. In the first elimination, the coefficients of a primitive polynomial may also vanish
+             * simultaneously at isolated points, which is the case if at most two variables remain.
+             * @param P set of polynomials in the variable to eliminate
+             * @param dimension number of the remaining variables after the elimination, or 0 if unknown
+             * @param first true if P is the input of the first elimination
+             * @return true if P is well-oriented, false if a polynomial of P might vanish identically on a cell of positive dimension
+             */
+            static bool wellOriented( const UnivariatePolynomialSet& P, unsigned dimension, bool first );
+
             /**
              * Constructs the samples at the base level of a CAD construction, provided a set of prevailing samples.
              * This method only returns samples which are new, i.e. not contained in currentSamples.
@@ -999,10 +1139,15 @@ namespace GiNaCRA
              * @param p input polynomial for the elimination procedure
              * @param variable the new main variable for the returned set
              * @param eliminated the set of eliminated polynomials to be augmented by the result of the elimination
+             * @param strategy the strategy for the subresultant computations (standard option is the generic algorithm)
              * @complexity O ( deg(P) ) subresultant computations. The degree of the output is bound by O(deg(P)^2)!
              * @return a list of polynomials in which the main variable of p is eliminated
              */
-            static void elimination( const UnivariatePolynomial& p, const symbol& variable, UnivariatePolynomialSet& eliminated ) throw ( invalid_argument );
+            static void elimination( const UnivariatePolynomial& p,
+                                     const symbol& variable,
+                                     UnivariatePolynomialSet& eliminated,
+                                     UnivariatePolynomial::subresultantStrategy strategy = UnivariatePolynomial::GENERIC_SUBRESULTANTSTRATEGY )
+                    throw ( invalid_argument );
 
             /**
              * Performs all steps of a CAD elimination/projection operator which are related to a pair of polynomials.
@@ -1013,15 +1158,68 @@ namespace GiNaCRA
              * @param q second input polynomial for the elimination procedure
              * @param variable the new main variable for the returned set
              * @param eliminated the set of eliminated polynomials to be augmented by the result of the elimination
+             * @param strategy the strategy for the subresultant computations (standard option is the generic algorithm)
              * @complexity O( deg(P)^2 ) subresultant computations. The degree of the output is bound by O(max(deg(P),deg(Q))^2)!
              * @return a list of polynomials in which the main variable of p1 and p2 is eliminated
              */
             static void elimination( const UnivariatePolynomial& p,
                                                                  const UnivariatePolynomial& q,
                                                                  const symbol& variable,
-                                                                 UnivariatePolynomialSet& eliminated )
+                                                                 UnivariatePolynomialSet& eliminated,
+                                                                 UnivariatePolynomial::subresultantStrategy strategy = UnivariatePolynomial::GENERIC_SUBRESULTANTSTRATEGY )
                     throw ( invalid_argument );
 
+            /**
+             * Performs the steps of McCallum's projection operator which are related to one single polynomial of a square-free basis.
+             *
+             * The coefficients of p are added from the leading one downwards until a non-zero constant is reached, since p cannot vanish
+             * identically where one of the added coefficients does not vanish. Additionally, the discriminant of p is added, given by the
+             * resultant of p and its derivative. A polynomial not containing the main variable is added itself.
+             *
+             * @param p input polynomial for the elimination procedure, which shall be primitive and square-free
+             * @param variable the new main variable for the returned set
+             * @param eliminated the set of eliminated polynomials to be augmented by the result of the elimination
+             * @see McCallum: An improved projection operation for cylindrical algebraic decomposition. In Quantifier Elimination and Cylindrical Algebraic Decomposition, Springer, 1998
+             */
+            static void mcCallumElimination( const UnivariatePolynomial& p, const symbol& variable, UnivariatePolynomialSet& eliminated );
+
+            /**
+             * Performs the step of McCallum's projection operator which is related to a pair of polynomials of a square-free basis, i.e., adds their resultant.
+             *
+             * @param p first input polynomial for the elimination procedure
+             * @param q second input polynomial for the elimination procedure, which shall be coprime to p
+             * @param variable the new main variable for the returned set
+             * @param eliminated the set of eliminated polynomials to be augmented by the result of the elimination
+             */
+            static void mcCallumElimination( const UnivariatePolynomial& p,
+                                             const UnivariatePolynomial& q,
+                                             const symbol& variable,
+                                             UnivariatePolynomialSet& eliminated );
+
+            /**
+             * Performs the steps of Brown's projection operator which are related to one single polynomial of a square-free basis, i.e., adds
+             * the leading coefficient and the discriminant of p. A polynomial not containing the main variable is added itself.
+             * The step related to a pair of polynomials is the same as for McCallum's operator, see mcCallumElimination.
+             *
+             * @param p input polynomial for the elimination procedure, which shall be primitive and square-free
+             * @param variable the new main variable for the returned set
+             * @param eliminated the set of eliminated polynomials to be augmented by the result of the elimination
+             * @see Brown: Improved projection for cylindrical algebraic decomposition. Journal of Symbolic Computation 32(5), 2001
+             */
+            static void brownElimination( const UnivariatePolynomial& p, const symbol& variable, UnivariatePolynomialSet& eliminated );
+
+            /**
+             * Performs the steps of Lazard's projection operator which are related to one single polynomial of a square-free basis, i.e., adds
+             * the leading and the trailing coefficient and the discriminant of p. A polynomial not containing the main variable is added itself.
+             * The step related to a pair of polynomials is the same as for McCallum's operator, see mcCallumElimination.
+             *
+             * @param p input polynomial for the elimination procedure, which shall be primitive and square-free
+             * @param variable the new main variable for the returned set
+             * @param eliminated the set of eliminated polynomials to be augmented by the result of the elimination
+             * @see McCallum, Parusinski, Paunescu: Validity proof of Lazard's method for CAD construction. Journal of Symbolic Computation 92, 2019
+             */
+            static void lazardElimination( const UnivariatePolynomial& p, const symbol& variable, UnivariatePolynomialSet& eliminated );
+
             /**
              * Constructs the samples at the base level of a CAD construction.
              *
@@ -1038,6 +1236,7 @@ namespace GiNaCRA
 
             /**
              * Constructs the samples for <code>p</code> given the sample values <code>sample</code> with their corresponding variables for the coefficient polynomials.
+             * If the settings select LAZARD_PROJECTIONOPERATOR, p is replaced by its Lazard evaluation at the sample first (see lazardEvaluation).
              * @param p univariate polynomial with coefficients in the given variables. <code>p</code> is univariate in a variable not contained in <code>variables</code>.
              * @param sample list of sample components in order corresponding to the variables
              * @param variables variables of the coefficients of p
@@ -1151,6 +1350,72 @@ namespace GiNaCRA
              * @return The set of truncations
              */
             static const UnivariatePolynomialSet truncation( const UnivariatePolynomialSet& P );
+
+            /**
+             * Replaces every polynomial of the set by its irreducible factors over the integers, given by their canonical representatives
+             * (see UnivariatePolynomialPool). Multiplicities and numeric factors are dropped, so that the factors have the same real zeros as the polynomials.
+             * @param P The polynomial set
+             * @return The set of irreducible factors
+             */
+            static const UnivariatePolynomialSet factorization( const UnivariatePolynomialSet& P );
+
+            /**
+             * Computes a gcd-free basis of the polynomial set, i.e., a set of square-free, pairwise coprime polynomials such that every
+             * polynomial of the set divides a product of basis polynomials and has the same real zeros as the product of the basis polynomials dividing it.
+             * A pair with a non-trivial common divisor g is replaced by g and the two cofactors until all pairs are coprime.
+             * @param P The polynomial set
+             * @complexity O( |P|^2 * d ) gcd computations where d is the maximum total degree of the polynomials in P
+             * @return The gcd-free basis, given by canonical representatives (see UnivariatePolynomialPool)
+             * @throws invalid_argument if a gcd does not divide the polynomials it was computed from, which cannot happen for rational coefficients
+             */
+            static const UnivariatePolynomialSet gcdFreeBasis( const UnivariatePolynomialSet& P ) throw ( invalid_argument );
+
+            /**
+             * Performs the elimination of one interned polynomial or of a pair of interned polynomials, using the cache of the
+             * UnivariatePolynomialPool.
+             * @param ids the id of a single polynomial or the ids of a pair of polynomials
+             * @param variable the new main variable for the eliminated polynomials
+             * @param eliminated the set of ids of eliminated polynomials to be augmented by the result of the elimination
+             * @param strategy the strategy for the subresultant computations
+             * @param projection the projection operator
+             */
+            static void cachedElimination( const vector<unsigned>& ids,
+                                           const symbol& variable,
+                                           std::set<unsigned>& eliminated,
+                                           UnivariatePolynomial::subresultantStrategy strategy,
+                                           ProjectionOperator projection )
+                    throw ( invalid_argument );
+
+
+            /**
+             * Computes a polynomial having the same roots as Lazard's evaluation of p at the given sample. The components of the sample are
+             * processed in the order of the lifting, i.e., from the last one to the first one. While p vanishes identically at the processed
+             * components, p is replaced by its derivative w.r.t. the variable of the current component, which is the division by the variable
+             * minus the component up to a non-zero factor. Then numeric components are substituted, while interval-represented components are
+             * kept as variables, so that the vanishing is decided exactly in the algebraic extension of all processed components (see
+             * vanishesIdentically).
+             * @param p univariate polynomial with coefficients in the given variables
+             * @param sample list of sample components in order corresponding to the variables
+             * @param variables variables of the coefficients of p
+             * @return a polynomial in the main variable of p and the variables of the interval-represented components
+             */
+            static const ex lazardEvaluation( const UnivariatePolynomial& p,
+                                              const list<RealAlgebraicNumberPtr>& sample,
+                                              const list<symbol>& variables );
+
+            /**
+             * Decides whether p vanishes identically at the given interval-represented components, i.e., whether all coefficients of p w.r.t.
+             * the free variables vanish there.
+             * @param p polynomial in the free variables and the variables of the components
+             * @param free variables of p which are not assigned by the components
+             * @param numbers interval-represented components
+             * @param variables variables of the components in the same order
+             * @return true if p vanishes identically at the components, false otherwise
+             */
+            static bool vanishesIdentically( const ex& p,
+                                             const list<symbol>& free,
+                                             const vector<RealAlgebraicNumberIRPtr>& numbers,
+                                             const vector<symbol>& variables );
     };
 }    // namespace GiNaC
 #endif /** GINACRA_CAD_H*/
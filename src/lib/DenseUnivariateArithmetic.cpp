@@ -0,0 +1,511 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+
+
+#include <algorithm>
+
+#include "DenseUnivariateArithmetic.h"
+#include "utilities.h"
+
+using GiNaC::numeric;
+using GiNaC::is_exactly_a;
+using GiNaC::ex_to;
+
+namespace GiNaCRA
+{
+    ////////////////////////////////////
+    // Conversion from/to Expressions //
+    ////////////////////////////////////
+
+    bool DenseUnivariateArithmetic::coefficients( const ex& p, const symbol& x, RationalPolynomial& coefficients )
+    {
+        std::vector<ex> c = GiNaC::denseCoefficients( p, x );
+        coefficients.clear();
+        coefficients.reserve( c.size() );
+        for( std::vector<ex>::const_iterator i = c.begin(); i != c.end(); ++i )
+        {
+            if( !is_exactly_a<numeric>( *i ) ||!ex_to<numeric>( *i ).is_rational() )
+                return false;
+            coefficients.push_back( cln::the<cln::cl_RA>( ex_to<numeric>( *i ).to_cl_N() ));
+        }
+        return true;
+    }
+
+    const ex DenseUnivariateArithmetic::expression( const RationalPolynomial& coefficients, const symbol& x )
+    {
+        ex result = 0;
+        for( unsigned i = 0; i < coefficients.size(); ++i )
+            if( !cln::zerop( coefficients[i] ))
+                result += numeric( coefficients[i] ) * GiNaC::pow( x, (int)i );
+        return result;
+    }
+
+    ////////////////////
+    // Multiplication //
+    ////////////////////
+
+    const DenseUnivariateArithmetic::IntegerPolynomial DenseUnivariateArithmetic::multiply( const IntegerPolynomial& a,
+                                                                                            const IntegerPolynomial& b )
+    {
+        unsigned length = std::min( a.size(), b.size() );
+        if( length < KARATSUBA_THRESHOLD )
+            return schoolbookMultiply( a, b );
+        if( length < NTT_THRESHOLD )
+            return karatsubaMultiply( a, b );
+        return nttMultiply( a, b );
+    }
+
+    const DenseUnivariateArithmetic::RationalPolynomial DenseUnivariateArithmetic::multiply( const RationalPolynomial& a,
+                                                                                             const RationalPolynomial& b )
+    {
+        if( a.empty() || b.empty() )
+            return RationalPolynomial();
+        // multiply the integer polynomials a*aDenominator and b*bDenominator
+        cln::cl_I         aDenominator = denominator( a );
+        cln::cl_I         bDenominator = denominator( b );
+        IntegerPolynomial aInteger     = IntegerPolynomial( a.size() );
+        IntegerPolynomial bInteger     = IntegerPolynomial( b.size() );
+        for( unsigned i = 0; i < a.size(); ++i )
+            aInteger[i] = cln::numerator( a[i] ) * cln::exquo( aDenominator, cln::denominator( a[i] ));
+        for( unsigned i = 0; i < b.size(); ++i )
+            bInteger[i] = cln::numerator( b[i] ) * cln::exquo( bDenominator, cln::denominator( b[i] ));
+        IntegerPolynomial  product     = multiply( aInteger, bInteger );
+        cln::cl_RA         denominator = aDenominator * bDenominator;
+        RationalPolynomial result      = RationalPolynomial( product.size() );
+        for( unsigned i = 0; i < product.size(); ++i )
+            result[i] = cln::cl_RA( product[i] ) / denominator;
+        normalize( result );
+        return result;
+    }
+
+    const DenseUnivariateArithmetic::IntegerPolynomial DenseUnivariateArithmetic::schoolbookMultiply( const IntegerPolynomial& a,
+                                                                                                      const IntegerPolynomial& b )
+    {
+        if( a.empty() || b.empty() )
+            return IntegerPolynomial();
+        IntegerPolynomial result = IntegerPolynomial( a.size() + b.size() - 1, 0 );
+        for( unsigned i = 0; i < a.size(); ++i )
+        {
+            if( cln::zerop( a[i] ))
+                continue;
+            for( unsigned j = 0; j < b.size(); ++j )
+                result[i + j] += a[i] * b[j];
+        }
+        return result;
+    }
+
+    const DenseUnivariateArithmetic::IntegerPolynomial DenseUnivariateArithmetic::karatsubaMultiply( const IntegerPolynomial& a,
+                                                                                                     const IntegerPolynomial& b )
+    {
+        const IntegerPolynomial& longer  = a.size() >= b.size() ? a : b;
+        const IntegerPolynomial& shorter = a.size() >= b.size() ? b : a;
+        if( shorter.size() < KARATSUBA_THRESHOLD )
+            return schoolbookMultiply( a, b );
+        IntegerPolynomial result = IntegerPolynomial( a.size() + b.size() - 1, 0 );
+        unsigned          half   = (longer.size() + 1) / 2;
+        if( shorter.size() <= half )
+        {
+            // unbalanced factors: multiply slices of the longer factor having the length of the shorter one
+            for( unsigned s = 0; s < longer.size(); s += shorter.size() )
+            {
+                IntegerPolynomial slice   = IntegerPolynomial( longer.begin() + s,
+                                                               longer.begin() + std::min( s + shorter.size(), longer.size() ));
+                IntegerPolynomial product = karatsubaMultiply( slice, shorter );
+                for( unsigned i = 0; i < product.size(); ++i )
+                    result[s + i] += product[i];
+            }
+            return result;
+        }
+        // a = a0 + a1*x^half and b = b0 + b1*x^half, so a*b = z0 + (z1 - z0 - z2)*x^half + z2*x^(2*half)
+        IntegerPolynomial a0 = IntegerPolynomial( a.begin(), a.begin() + half );
+        IntegerPolynomial a1 = IntegerPolynomial( a.begin() + half, a.end() );
+        IntegerPolynomial b0 = IntegerPolynomial( b.begin(), b.begin() + half );
+        IntegerPolynomial b1 = IntegerPolynomial( b.begin() + half, b.end() );
+        IntegerPolynomial z0 = karatsubaMultiply( a0, b0 );
+        IntegerPolynomial z2 = karatsubaMultiply( a1, b1 );
+        for( unsigned i = 0; i < a1.size(); ++i )
+            a0[i] += a1[i];
+        for( unsigned i = 0; i < b1.size(); ++i )
+            b0[i] += b1[i];
+        IntegerPolynomial z1 = karatsubaMultiply( a0, b0 );
+        for( unsigned i = 0; i < z0.size(); ++i )
+        {
+            result[i]        += z0[i];
+            result[i + half] -= z0[i];
+        }
+        for( unsigned i = 0; i < z2.size(); ++i )
+        {
+            result[i + 2 * half] += z2[i];
+            result[i + half]     -= z2[i];
+        }
+        for( unsigned i = 0; i < z1.size(); ++i )
+            result[i + half] += z1[i];
+        return result;
+    }
+
+    const DenseUnivariateArithmetic::IntegerPolynomial DenseUnivariateArithmetic::nttMultiply( const IntegerPolynomial& a,
+                                                                                               const IntegerPolynomial& b )
+    {
+        if( a.empty() || b.empty() )
+            return IntegerPolynomial();
+        unsigned length = a.size() + b.size() - 1;
+        unsigned k      = 0;
+        while( (1u << k) < length )
+            ++k;
+        // the coefficients of a*b are bounded by min(a.size(), b.size()) * |a| * |b| where |.| is the maximum norm
+        cln::cl_I bound = 2 * cln::cl_I( (unsigned long)std::min( a.size(), b.size() )) * maxNorm( a ) * maxNorm( b );
+
+        // combine the images modulo p_1, p_2, ... by the Chinese remainder theorem until p_1*p_2*... exceeds the bound
+        IntegerPolynomial result  = IntegerPolynomial( length, 0 );
+        cln::cl_I         modulus = 1;
+        unsigned          p       = 1u << 31;
+        unsigned          root;
+        while( modulus <= bound )
+        {
+            if( !nttPrime( k, p, root ))
+                return karatsubaMultiply( a, b );    // out of primes, which does not happen for reasonable lengths
+            cln::cl_I prime = cln::cl_I( p );
+            std::vector<unsigned> x = std::vector<unsigned>( 1u << k, 0 );
+            std::vector<unsigned> y = std::vector<unsigned>( 1u << k, 0 );
+            for( unsigned i = 0; i < a.size(); ++i )
+                x[i] = cln::cl_I_to_UL( cln::mod( a[i], prime ));
+            for( unsigned i = 0; i < b.size(); ++i )
+                y[i] = cln::cl_I_to_UL( cln::mod( b[i], prime ));
+            cyclicConvolution( x, y, p, root );
+            unsigned long long modulusInverse = power( cln::cl_I_to_UL( cln::mod( modulus, prime )), p - 2, p );
+            for( unsigned i = 0; i < length; ++i )
+            {
+                unsigned long long residue = cln::cl_I_to_UL( cln::mod( result[i], prime ));
+                unsigned long long factor  = ((x[i] + p - residue) % p) * modulusInverse % p;
+                result[i] = result[i] + modulus * cln::cl_I( (unsigned long)factor );
+            }
+            modulus = modulus * prime;
+        }
+        // choose the representatives of least absolute value
+        cln::cl_I halfModulus = cln::floor1( modulus, 2 );
+        for( unsigned i = 0; i < length; ++i )
+            if( result[i] > halfModulus )
+                result[i] = result[i] - modulus;
+        return result;
+    }
+
+    void DenseUnivariateArithmetic::cyclicConvolution( std::vector<unsigned>& a, std::vector<unsigned>& b, unsigned p, unsigned root )
+    {
+        transform( a, root, p );
+        transform( b, root, p );
+        for( unsigned i = 0; i < a.size(); ++i )
+            a[i] = (unsigned)(((unsigned long long)a[i] * b[i]) % p);
+        // the inverse transform is the transform with the inverse root, divided by the length
+        transform( a, power( root, p - 2, p ), p );
+        unsigned long long lengthInverse = power( a.size() % p, p - 2, p );
+        for( unsigned i = 0; i < a.size(); ++i )
+            a[i] = (unsigned)((a[i] * lengthInverse) % p);
+    }
+
+    //////////////
+    // Division //
+    //////////////
+
+    void DenseUnivariateArithmetic::divide( const RationalPolynomial& a,
+                                            const RationalPolynomial& b,
+                                            RationalPolynomial& quotient,
+                                            RationalPolynomial& remainder )
+            throw ( invalid_argument )
+    {
+        if( b.empty() )
+            throw invalid_argument( "Division by the zero polynomial." );
+        if( a.size() < b.size() )
+        {
+            quotient.clear();
+            remainder = a;
+            return;
+        }
+        unsigned n = a.size() - b.size() + 1;    // length of the quotient
+        if( n < NEWTON_DIVISION_THRESHOLD || b.size() < NEWTON_DIVISION_THRESHOLD )
+        {
+            remainder = a;
+            quotient  = RationalPolynomial( n, 0 );
+            cln::cl_RA leadingInverse = cln::recip( b.back() );
+            for( unsigned i = n; i-- > 0; )
+            {
+                quotient[i] = remainder[i + b.size() - 1] * leadingInverse;
+                if( cln::zerop( quotient[i] ))
+                    continue;
+                for( unsigned j = 0; j < b.size(); ++j )
+                    remainder[i + j] -= quotient[i] * b[j];
+            }
+            remainder.resize( b.size() - 1 );
+            normalize( remainder );
+            return;
+        }
+        // the reversed quotient x^(n-1)*quotient(1/x) is the reversed dividend times the inverse of the reversed divisor modulo x^n
+        quotient  = reverse( truncate( multiply( truncate( reverse( a, a.size() ), n ), inverseSeries( reverse( b, b.size() ), n )), n ), n );
+        remainder = truncate( add( a, multiply( b, quotient ), true ), b.size() - 1 );
+    }
+
+    const DenseUnivariateArithmetic::RationalPolynomial DenseUnivariateArithmetic::inverseSeries( const RationalPolynomial& f, unsigned n )
+            throw ( invalid_argument )
+    {
+        if( f.empty() || cln::zerop( f.front() ))
+            throw invalid_argument( "A power series with vanishing constant term is not invertible." );
+        RationalPolynomial g = RationalPolynomial( 1, cln::recip( f.front() ));
+        for( unsigned l = 1; l < n; )
+        {
+            // doubling the precision: g <- g*(2 - f*g) modulo x^l
+            l = 2 * l < n ? 2 * l : n;
+            g = truncate( multiply( g, add( RationalPolynomial( 1, 2 ), truncate( multiply( truncate( f, l ), g ), l ), true )), l );
+        }
+        return truncate( g, n );
+    }
+
+    //////////////////////////////
+    // Greatest Common Divisors //
+    //////////////////////////////
+
+    const DenseUnivariateArithmetic::RationalPolynomial DenseUnivariateArithmetic::gcd( const RationalPolynomial& a,
+                                                                                        const RationalPolynomial& b )
+    {
+        RationalPolynomial f = a.size() >= b.size() ? a : b;
+        RationalPolynomial g = a.size() >= b.size() ? b : a;
+        normalize( f );
+        normalize( g );
+        RationalPolynomial q, r;
+        while( !g.empty() )
+        {
+            // one Euclidean step makes the degree of f exceed the one of g, as required by the half-gcd algorithm
+            divide( f, g, q, r );
+            f.swap( g );
+            g.swap( r );
+            if( g.size() > HALFGCD_THRESHOLD )
+                apply( halfGcd( f, g ), f, g );
+        }
+        if( !f.empty() )
+        {
+            cln::cl_RA leadingInverse = cln::recip( f.back() );
+            for( unsigned i = 0; i < f.size(); ++i )
+                f[i] = f[i] * leadingInverse;
+        }
+        return f;
+    }
+
+    ///////////////////////
+    // Auxiliary Methods //
+    ///////////////////////
+
+    const DenseUnivariateArithmetic::TransitionMatrix DenseUnivariateArithmetic::halfGcd( const RationalPolynomial& a,
+                                                                                          const RationalPolynomial& b )
+    {
+        // the result maps (a, b) to the consecutive remainders (r_i, r_(i+1)) with deg(r_i) >= m > deg(r_(i+1))
+        unsigned         m      = a.size() / 2;    // ceil(deg(a)/2)
+        TransitionMatrix result = TransitionMatrix();
+        result.mEntries[0] = RationalPolynomial( 1, 1 );
+        result.mEntries[3] = RationalPolynomial( 1, 1 );
+        if( b.size() <= m )
+            return result;
+        RationalPolynomial q, r;
+        if( a.size() <= HALFGCD_THRESHOLD )
+        {
+            // classical Euclidean steps
+            RationalPolynomial f = a, g = b;
+            while( g.size() > m )
+            {
+                divide( f, g, q, r );
+                euclideanStep( result, q );
+                f.swap( g );
+                g.swap( r );
+            }
+            return result;
+        }
+        // the leading halves of a and b determine the first half of the quotients
+        result = halfGcd( shift( a, m ), shift( b, m ));
+        RationalPolynomial f = a, g = b;
+        apply( result, f, g );
+        if( g.size() <= m )
+            return result;
+        divide( f, g, q, r );
+        euclideanStep( result, q );
+        unsigned k = 2 * m + 1 - g.size();
+        return multiply( halfGcd( shift( g, k ), shift( r, k )), result );
+    }
+
+    const DenseUnivariateArithmetic::TransitionMatrix DenseUnivariateArithmetic::multiply( const TransitionMatrix& m, const TransitionMatrix& n )
+    {
+        TransitionMatrix result = TransitionMatrix();
+        for( unsigned i = 0; i < 2; ++i )
+            for( unsigned j = 0; j < 2; ++j )
+                result.mEntries[2 * i + j] = add( multiply( m.mEntries[2 * i], n.mEntries[j] ), multiply( m.mEntries[2 * i + 1], n.mEntries[2 + j] ));
+        return result;
+    }
+
+    void DenseUnivariateArithmetic::apply( const TransitionMatrix& m, RationalPolynomial& a, RationalPolynomial& b )
+    {
+        RationalPolynomial c = add( multiply( m.mEntries[0], a ), multiply( m.mEntries[1], b ));
+        b = add( multiply( m.mEntries[2], a ), multiply( m.mEntries[3], b ));
+        a.swap( c );
+    }
+
+    void DenseUnivariateArithmetic::euclideanStep( TransitionMatrix& m, const RationalPolynomial& q )
+    {
+        // multiply m by the matrix ((0, 1), (1, -q)) from the left
+        RationalPolynomial lowerLeft  = add( m.mEntries[0], multiply( q, m.mEntries[2] ), true );
+        RationalPolynomial lowerRight = add( m.mEntries[1], multiply( q, m.mEntries[3] ), true );
+        m.mEntries[0].swap( m.mEntries[2] );
+        m.mEntries[1].swap( m.mEntries[3] );
+        m.mEntries[2].swap( lowerLeft );
+        m.mEntries[3].swap( lowerRight );
+    }
+
+    const DenseUnivariateArithmetic::RationalPolynomial DenseUnivariateArithmetic::add( const RationalPolynomial& a,
+                                                                                        const RationalPolynomial& b,
+                                                                                        bool subtract )
+    {
+        RationalPolynomial result = a;
+        if( result.size() < b.size() )
+            result.resize( b.size(), 0 );
+        for( unsigned i = 0; i < b.size(); ++i )
+            result[i] = subtract ? result[i] - b[i] : result[i] + b[i];
+        normalize( result );
+        return result;
+    }
+
+    const DenseUnivariateArithmetic::RationalPolynomial DenseUnivariateArithmetic::truncate( const RationalPolynomial& a, unsigned n )
+    {
+        RationalPolynomial result = RationalPolynomial( a.begin(), a.begin() + std::min( (unsigned)a.size(), n ));
+        normalize( result );
+        return result;
+    }
+
+    const DenseUnivariateArithmetic::RationalPolynomial DenseUnivariateArithmetic::shift( const RationalPolynomial& a, unsigned n )
+    {
+        return n < a.size() ? RationalPolynomial( a.begin() + n, a.end() ) : RationalPolynomial();
+    }
+
+    const DenseUnivariateArithmetic::RationalPolynomial DenseUnivariateArithmetic::reverse( const RationalPolynomial& a, unsigned n )
+    {
+        RationalPolynomial result = RationalPolynomial( n, 0 );
+        for( unsigned i = 0; i < n && i < a.size(); ++i )
+            result[n - 1 - i] = a[i];
+        normalize( result );
+        return result;
+    }
+
+    void DenseUnivariateArithmetic::normalize( RationalPolynomial& a )
+    {
+        while( !a.empty() && cln::zerop( a.back() ))
+            a.pop_back();
+    }
+
+    void DenseUnivariateArithmetic::normalize( IntegerPolynomial& a )
+    {
+        while( !a.empty() && cln::zerop( a.back() ))
+            a.pop_back();
+    }
+
+    const cln::cl_I DenseUnivariateArithmetic::denominator( const RationalPolynomial& a )
+    {
+        cln::cl_I result = 1;
+        for( RationalPolynomial::const_iterator c = a.begin(); c != a.end(); ++c )
+            result = cln::lcm( result, cln::denominator( *c ));
+        return result;
+    }
+
+    const cln::cl_I DenseUnivariateArithmetic::maxNorm( const IntegerPolynomial& a )
+    {
+        cln::cl_I result = 0;
+        for( IntegerPolynomial::const_iterator c = a.begin(); c != a.end(); ++c )
+            if( cln::abs( *c ) > result )
+                result = cln::abs( *c );
+        return result;
+    }
+
+    void DenseUnivariateArithmetic::transform( std::vector<unsigned>& a, unsigned root, unsigned p )
+    {
+        // iterative Cooley-Tukey transform on the bit-reversed input
+        unsigned n = a.size();
+        for( unsigned i = 1, j = 0; i < n; ++i )
+        {
+            unsigned bit = n >> 1;
+            for( ; j & bit; bit >>= 1 )
+                j ^= bit;
+            j ^= bit;
+            if( i < j )
+                std::swap( a[i], a[j] );
+        }
+        for( unsigned length = 2; length <= n; length <<= 1 )
+        {
+            unsigned long long step = power( root, n / length, p );
+            for( unsigned i = 0; i < n; i += length )
+            {
+                unsigned long long w = 1;
+                for( unsigned j = 0; j < length / 2; ++j )
+                {
+                    unsigned u           = a[i + j];
+                    unsigned v           = (unsigned)((a[i + j + length / 2] * w) % p);
+                    a[i + j]             = (u + v) % p;
+                    a[i + j + length / 2] = (u + p - v) % p;
+                    w                    = (w * step) % p;
+                }
+            }
+        }
+    }
+
+    bool DenseUnivariateArithmetic::nttPrime( unsigned k, unsigned& p, unsigned& root )
+    {
+        // largest prime c*2^k+1 below p
+        for( unsigned c = (p - 2) >> k; c > 0; --c )
+        {
+            unsigned q       = (c << k) + 1;
+            bool     isPrime = q % 2 != 0 || q == 2;
+            for( unsigned d = 3; isPrime && d <= q / d; d += 2 )
+                isPrime = q % d != 0;
+            if( !isPrime || q < 3 )
+                continue;
+            // a^c has order 2^k exactly if a is a quadratic non-residue
+            for( unsigned a = 2; a < q; ++a )
+            {
+                if( power( a, (q - 1) / 2, q ) == q - 1 )
+                {
+                    p    = q;
+                    root = power( a, c, q );
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    unsigned DenseUnivariateArithmetic::power( unsigned a, unsigned long e, unsigned p )
+    {
+        unsigned long long result = 1;
+        unsigned long long base   = a % p;
+        for( ; e > 0; e >>= 1 )
+        {
+            if( e & 1 )
+                result = (result * base) % p;
+            base = (base * base) % p;
+        }
+        return (unsigned)result;
+    }
+
+}    // namespace GiNaCRA
@@ -0,0 +1,220 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+
+#ifndef GINACRA_DENSEUNIVARIATEARITHMETIC_H
+#define GINACRA_DENSEUNIVARIATEARITHMETIC_H
+
+#include <vector>
+#include <stdexcept>
+#include <ginac/ginac.h>
+#include <cln/cln.h>
+
+using std::invalid_argument;
+using GiNaC::ex;
+using GiNaC::symbol;
+
+namespace GiNaCRA
+{
+    /**
+     * Asymptotically fast arithmetic for dense univariate polynomials with rational coefficients.
+     *
+     * A polynomial is represented by the vector of its coefficients, the one of degree i at position i, without vanishing
+     * leading entries. The zero polynomial is the empty vector.
+     *
+     * Integer polynomials are multiplied by the schoolbook method, by Karatsuba's method or, for large degrees, by number
+     * theoretic transforms modulo word-size primes of the form c*2^k+1 whose images are combined by the Chinese remainder
+     * theorem. Rational polynomials are multiplied after clearing denominators. Division with remainder computes the
+     * reversed quotient as the product of the reversed dividend with the power series inverse of the reversed divisor,
+     * obtained by Newton iteration. The greatest common divisor is computed by the half-gcd algorithm, which jumps to the
+     * middle of the Euclidean remainder sequence by a recursive call on the leading halves of the coefficients.
+     *
+     * UnivariatePolynomial uses these methods for rational polynomials of degree at least DEGREE_THRESHOLD.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     * @see Karatsuba, Ofman: Multiplication of many-digital numbers by automatic computers. Doklady Akad. Nauk SSSR 145, 1962
+     * @see von zur Gathen, Gerhard: Modern Computer Algebra, Chapters 8, 9 and 11. Cambridge University Press, 2003
+     * @see Thull, Yap: A unified approach to HGCD algorithms for polynomials and integers. Manuscript, 1990
+     */
+    class DenseUnivariateArithmetic
+    {
+        public:
+
+            /// dense polynomial with integer coefficients
+            typedef std::vector<cln::cl_I> IntegerPolynomial;
+            /// dense polynomial with rational coefficients
+            typedef std::vector<cln::cl_RA> RationalPolynomial;
+
+            /// minimal degree of both operands for which UnivariatePolynomial uses the methods of this class
+            static const int DEGREE_THRESHOLD = 64;
+            /// minimal length of both factors for which Karatsuba's method is used
+            static const unsigned KARATSUBA_THRESHOLD = 32;
+            /// minimal length of both factors for which number theoretic transforms are used
+            static const unsigned NTT_THRESHOLD = 256;
+            /// minimal length of quotient and divisor for which Newton iteration is used
+            static const unsigned NEWTON_DIVISION_THRESHOLD = 64;
+            /// minimal degree for which the half-gcd algorithm is applied recursively
+            static const unsigned HALFGCD_THRESHOLD = 48;
+
+            ////////////////////////////////////
+            // Conversion from/to Expressions //
+            ////////////////////////////////////
+
+            /**
+             * Extracts the dense coefficient vector of a polynomial in x.
+             * @param p
+             * @param x
+             * @param coefficients receives the coefficients of p
+             * @return true if all coefficients of p are rational numbers, false otherwise
+             */
+            static bool coefficients( const ex& p, const symbol& x, RationalPolynomial& coefficients );
+
+            /**
+             * @param coefficients
+             * @param x
+             * @return the polynomial in x with the given coefficients
+             */
+            static const ex expression( const RationalPolynomial& coefficients, const symbol& x );
+
+            ////////////////////
+            // Multiplication //
+            ////////////////////
+
+            /**
+             * Multiplies two integer polynomials, choosing the method by the lengths of the factors.
+             * @param a
+             * @param b
+             * @return a*b
+             * @complexity O( n^1.59 ) for medium and O( k*n*log(n) + k^2*n ) operations for large n, k being the number of primes
+             */
+            static const IntegerPolynomial multiply( const IntegerPolynomial& a, const IntegerPolynomial& b );
+
+            /**
+             * Multiplies two rational polynomials by multiplying their integer multiples.
+             * @param a
+             * @param b
+             * @return a*b
+             */
+            static const RationalPolynomial multiply( const RationalPolynomial& a, const RationalPolynomial& b );
+
+            /**
+             * @param a
+             * @param b
+             * @return a*b, computed by the schoolbook method
+             * @complexity O( a.size()*b.size() )
+             */
+            static const IntegerPolynomial schoolbookMultiply( const IntegerPolynomial& a, const IntegerPolynomial& b );
+
+            /**
+             * @param a
+             * @param b
+             * @return a*b, computed by Karatsuba's method down to KARATSUBA_THRESHOLD
+             * @complexity O( n^1.59 )
+             */
+            static const IntegerPolynomial karatsubaMultiply( const IntegerPolynomial& a, const IntegerPolynomial& b );
+
+            /**
+             * @param a
+             * @param b
+             * @return a*b, computed by number theoretic transforms modulo sufficiently many primes
+             * @complexity O( k*n*log(n) + k^2*n ) word operations, k being the number of primes
+             */
+            static const IntegerPolynomial nttMultiply( const IntegerPolynomial& a, const IntegerPolynomial& b );
+
+            /**
+             * Computes the cyclic convolution of a and b over Z/pZ in place of a.
+             * @param a values of length 2^k
+             * @param b values of length 2^k
+             * @param p a prime below 2^31 with 2^k dividing p-1
+             * @param root a primitive 2^k-th root of unity modulo p
+             */
+            static void cyclicConvolution( std::vector<unsigned>& a, std::vector<unsigned>& b, unsigned p, unsigned root );
+
+            //////////////
+            // Division //
+            //////////////
+
+            /**
+             * Divides a by b with remainder.
+             * @param a
+             * @param b
+             * @param quotient receives the polynomial q with a = q*b + r
+             * @param remainder receives the polynomial r with a = q*b + r and r.size() < b.size()
+             * @throw invalid_argument if b is zero
+             * @complexity O( M(n) ) operations if quotient and divisor are long, O( (a.size()-b.size())*b.size() ) otherwise
+             */
+            static void divide( const RationalPolynomial& a,
+                                const RationalPolynomial& b,
+                                RationalPolynomial& quotient,
+                                RationalPolynomial& remainder )
+                    throw ( invalid_argument );
+
+            /**
+             * Computes the inverse of the power series f modulo x^n by Newton iteration.
+             * @param f power series with nonzero constant term
+             * @param n
+             * @return g with f*g = 1 modulo x^n
+             * @throw invalid_argument if the constant term of f is zero
+             */
+            static const RationalPolynomial inverseSeries( const RationalPolynomial& f, unsigned n ) throw ( invalid_argument );
+
+            //////////////////////////////
+            // Greatest Common Divisors //
+            //////////////////////////////
+
+            /**
+             * @param a
+             * @param b
+             * @return the monic greatest common divisor of a and b, or zero if both are zero
+             * @complexity O( M(n)*log(n) ) operations
+             */
+            static const RationalPolynomial gcd( const RationalPolynomial& a, const RationalPolynomial& b );
+
+        private:
+
+            /// 2x2 matrix of polynomials, entries in row-major order
+            struct TransitionMatrix
+            {
+                RationalPolynomial mEntries[4];
+            };
+
+            static const TransitionMatrix halfGcd( const RationalPolynomial& a, const RationalPolynomial& b );
+            static const TransitionMatrix multiply( const TransitionMatrix& m, const TransitionMatrix& n );
+            static void apply( const TransitionMatrix& m, RationalPolynomial& a, RationalPolynomial& b );
+            static void euclideanStep( TransitionMatrix& m, const RationalPolynomial& q );
+            static const RationalPolynomial add( const RationalPolynomial& a, const RationalPolynomial& b, bool subtract = false );
+            static const RationalPolynomial truncate( const RationalPolynomial& a, unsigned n );
+            static const RationalPolynomial shift( const RationalPolynomial& a, unsigned n );
+            static const RationalPolynomial reverse( const RationalPolynomial& a, unsigned n );
+            static void normalize( RationalPolynomial& a );
+            static void normalize( IntegerPolynomial& a );
+            static const cln::cl_I denominator( const RationalPolynomial& a );
+            static const cln::cl_I maxNorm( const IntegerPolynomial& a );
+            static void transform( std::vector<unsigned>& a, unsigned root, unsigned p );
+            static bool nttPrime( unsigned k, unsigned& p, unsigned& root );
+            static unsigned power( unsigned a, unsigned long e, unsigned p );
+    };
+
+}
+#endif   /** GINACRA_DENSEUNIVARIATEARITHMETIC_H */
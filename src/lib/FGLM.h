@@ -0,0 +1,111 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+
+#ifndef GINACRA_FGLM_H
+#define GINACRA_FGLM_H
+
+#include <list>
+#include <set>
+#include <stdexcept>
+
+#include "Groebner.h"
+
+namespace GiNaCRA
+{
+    /**
+     * Change of ordering for Groebner bases of zero-dimensional ideals by the algorithm of Faugere, Gianni, Lazard and
+     * Mora (FGLM).
+     *
+     * The quotient ring of a zero-dimensional ideal is a finite-dimensional vector space. The monomials are enumerated
+     * by increasing order with respect to the target order, and the normal form of each monomial with respect to the
+     * given basis is tested for linear dependence on the normal forms of the standard monomials found so far. A
+     * dependence yields an element of the new basis, otherwise the monomial is a new standard monomial. The normal
+     * form of a monomial is obtained from the one of a standard monomial by multiplying with a single variable.
+     *
+     * Computing a basis with respect to GrRevLexCompare and converting it is usually much faster than computing a
+     * lexicographical basis directly, see lexBasis. The lexicographical basis is triangular, i.e., it eliminates the
+     * variables successively.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     * @see Faugere, Gianni, Lazard, Mora: Efficient computation of zero-dimensional Groebner bases by change of ordering. J. Symb. Comput. 16(4), 1993
+     * @param Coeff the coefficient domain of the polynomials, which has to be a field, see MultivariateTermMRT
+     */
+    template<class Coeff>
+    class FGLMT
+    {
+        public:
+            typedef MultivariatePolynomialMRT<Coeff>                   PolynomialType;
+            typedef typename std::list<PolynomialType>::const_iterator lpol_cIt;
+
+            /**
+             * Converts a reduced Groebner basis of a zero-dimensional ideal to the reduced Groebner basis of the same
+             * ideal with respect to another order.
+             * @param basis a reduced Groebner basis, all polynomials using the same order
+             * @param order the target order
+             * @return the reduced Groebner basis with respect to order, sorted by increasing leading monomials
+             * @throws invalid_argument if the ideal is not zero-dimensional
+             * @throws domain_error if the coefficient domain is no field
+             */
+            static std::list<PolynomialType> convert( const std::list<PolynomialType>& basis, const MonomMRCompare& order )
+                    throw ( std::invalid_argument, std::domain_error );
+
+            /**
+             * Computes the reduced lexicographical Groebner basis of a zero-dimensional ideal, using a basis with respect
+             * to GrRevLexCompare and its conversion.
+             * @param begin_generatingset
+             * @param end_generatingset
+             * @return the reduced Groebner basis with respect to LexCompare, sorted by increasing leading monomials
+             * @throws invalid_argument if the ideal is not zero-dimensional
+             * @throws domain_error if the coefficient domain is no field
+             */
+            static std::list<PolynomialType> lexBasis( lpol_cIt begin_generatingset, lpol_cIt end_generatingset )
+                    throw ( std::invalid_argument, std::domain_error );
+
+            /**
+             * @param basis a Groebner basis
+             * @return true iff the ideal generated by the basis is zero-dimensional in the variables occurring in it,
+             * i.e., for each of these variables a pure power is a leading monomial
+             */
+            static bool isZeroDimensional( const std::list<PolynomialType>& basis );
+
+            /**
+             * @param basis
+             * @return the indices of the variables occurring in the polynomials
+             */
+            static std::set<unsigned> variablesOf( const std::list<PolynomialType>& basis );
+    };
+
+    /// Change of ordering over the symbolic coefficients of MultivariateCoefficientMR.
+    typedef FGLMT<MultivariateCoefficientMR> FGLM;
+    /// Change of ordering over the rational numbers.
+    typedef FGLMT<RationalCoefficientMR> FGLMQ;
+    /// Change of ordering over the prime field given by ModularCoefficientMR::modulus().
+    typedef FGLMT<ModularCoefficientMR> FGLMZp;
+
+}
+
+#include "FGLM.tpp"
+
+#endif   /** GINACRA_FGLM_H */
@@ -0,0 +1,160 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+
+
+/**
+ * Implementation of the class template FGLMT. Included by FGLM.h.
+ */
+
+#include <map>
+#include <algorithm>
+#include <vector>
+
+namespace GiNaCRA
+{
+    template<class Coeff>
+    std::list<MultivariatePolynomialMRT<Coeff> > FGLMT<Coeff>::convert( const std::list<PolynomialType>& basis, const MonomMRCompare& order )
+            throw ( std::invalid_argument, std::domain_error )
+    {
+        typedef typename PolynomialType::Term Term;
+        // a monomial waiting to be processed: the index of the standard monomial and the variable it is a multiple of
+        typedef std::map<MultivariateMonomialMR, std::pair<unsigned, unsigned>, MonomMRCompare> CandidateMap;
+
+        if( !Coeff::isField )
+            throw std::domain_error( "The change of ordering requires coefficients from a field." );
+        if( !isZeroDimensional( basis ))
+            throw std::invalid_argument( "The ideal is not zero-dimensional." );
+
+        const std::set<unsigned> variables = variablesOf( basis );
+        const MonomMRCompare     source    = basis.empty() ? order : basis.front().getMonomOrder();
+
+        std::list<PolynomialType>        result;
+        MonomialDivisorIndex             resultLeading;
+        PolynomialDivisorIndex<lpol_cIt> basisLeading( basis.begin(), basis.end() );
+        // the normal forms of the standard monomials, in the order they were found
+        std::vector<PolynomialType> normalForms;
+        // an echelon form of the normal forms: each row is a linear combination of them with a distinct leading monomial,
+        // the combination is stored as the same combination of the standard monomials, which are ordered by the target order
+        std::vector<PolynomialType>                                rows;
+        std::vector<PolynomialType>                                rowCombinations;
+        std::map<MultivariateMonomialMR, unsigned, MonomMRCompare> pivots( source );
+
+        CandidateMap candidates( order );
+        candidates.insert( std::make_pair( MultivariateMonomialMR(), std::make_pair( 0, 0 )));
+        while( !candidates.empty() )
+        {
+            // the smallest candidate; the candidates added later are bigger, so no monomial is processed twice
+            MultivariateMonomialMR           m           = candidates.begin()->first;
+            std::pair<unsigned, unsigned>    predecessor = candidates.begin()->second;
+            candidates.erase( candidates.begin() );
+            if( resultLeading.findDivisor( m ) < resultLeading.size() )
+                continue;
+
+            PolynomialType normalForm = PolynomialType( Term( Coeff( 1 )), source );
+            if( m.tdeg() > 0 )
+                normalForm = normalForms[predecessor.first].multiply( MultivariateMonomialMR( predecessor.second, 1 ));
+            normalForm = normalForm.CalculateRemainder( basisLeading );
+
+            // reduce the normal form by the rows, keeping track of the combination of monomials it is the normal form of
+            PolynomialType                   rest        = normalForm;
+            PolynomialType                   combination = PolynomialType( Term( m, Coeff( 1 )), order );
+            typename PolynomialType::TermSet remainder( source );
+            while( !rest.isZero() )
+            {
+                typename std::map<MultivariateMonomialMR, unsigned, MonomMRCompare>::const_iterator pivot = pivots.find( rest.lmon() );
+                if( pivot != pivots.end() )
+                {
+                    Term factor = Term( rest.lcoeff() );
+                    rest        = rest - rows[pivot->second].multiply( factor );
+                    combination = combination - rowCombinations[pivot->second].multiply( factor );
+                }
+                else
+                {
+                    remainder.insert( remainder.begin(), rest.lterm() );
+                    rest = rest.truncLT();
+                }
+            }
+
+            if( remainder.empty() )
+            {
+                // the combination lies in the ideal, its leading monomial is m and all other monomials are standard
+                result.push_back( combination );
+                resultLeading.push_back( m );
+            }
+            else
+            {
+                normalForms.push_back( normalForm );
+                PolynomialType row    = PolynomialType( remainder.begin(), remainder.end(), source );
+                Term           factor = Term( Coeff( 1 ) / row.lcoeff() );
+                pivots[row.lmon()] = rows.size();
+                rows.push_back( row.multiply( factor ));
+                rowCombinations.push_back( combination.multiply( factor ));
+                for( std::set<unsigned>::const_iterator v = variables.begin(); v != variables.end(); ++v )
+                    candidates.insert( std::make_pair( m * MultivariateMonomialMR( *v, 1 ), std::make_pair( normalForms.size() - 1, *v )));
+            }
+        }
+        return result;
+    }
+
+    template<class Coeff>
+    std::list<MultivariatePolynomialMRT<Coeff> > FGLMT<Coeff>::lexBasis( lpol_cIt begin_generatingset, lpol_cIt end_generatingset )
+            throw ( std::invalid_argument, std::domain_error )
+    {
+        MonomMRCompare            grevlex = MonomMRCompare( MultivariateMonomialMR::GrRevLexCompare );
+        std::list<PolynomialType> generators;
+        for( lpol_cIt p = begin_generatingset; p != end_generatingset; ++p )
+            generators.push_back( PolynomialType( p->begin(), p->end(), grevlex ));
+        GroebnerT<Coeff> g = GroebnerT<Coeff>( generators.begin(), generators.end() );
+        g.solve();
+        g.reduce();
+        return convert( g.getBase(), MonomMRCompare( MultivariateMonomialMR::LexCompare ));
+    }
+
+    template<class Coeff>
+    bool FGLMT<Coeff>::isZeroDimensional( const std::list<PolynomialType>& basis )
+    {
+        std::set<unsigned> pure;
+        for( lpol_cIt p = basis.begin(); p != basis.end(); ++p )
+        {
+            MultivariateMonomialMR lm = p->lmon();
+            if( lm.constant() )
+                return true;
+            if( lm.end() - lm.begin() == 1 )
+                pure.insert( lm.begin()->first );
+        }
+        std::set<unsigned> variables = variablesOf( basis );
+        return std::includes( pure.begin(), pure.end(), variables.begin(), variables.end() );
+    }
+
+    template<class Coeff>
+    std::set<unsigned> FGLMT<Coeff>::variablesOf( const std::list<PolynomialType>& basis )
+    {
+        std::set<unsigned> variables;
+        for( lpol_cIt p = basis.begin(); p != basis.end(); ++p )
+            for( typename PolynomialType::TermcIt t = p->begin(); t != p->end(); ++t )
+                for( vui_cIt e = t->begin(); e != t->end(); ++e )
+                    variables.insert( e->first );
+        return variables;
+    }
+}
@@ -23,35 +23,100 @@
 #ifndef GROEBNER_H
 #define GROEBNER_H
 
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include "MacaulayMatrix.h"
 #include "MultivariatePolynomialMR.h"
+#include "settings.h"
 
 namespace GiNaCRA
 {
+    /**
+     * Transfers the state of a coefficient domain which is specific to a thread, such as the modulus of
+     * ModularCoefficientMR, to the worker threads of a computation. Thread-safe domains (Coeff::isThreadSafe) provide
+     * a type Coeff::ThreadState and the static methods threadState() and setThreadState( ThreadState ).
+     * @since 2026-10-18
+     * @version 2026-10-18
+     * @param Coeff the coefficient domain
+     */
+    template<class Coeff, bool threadSafe = Coeff::isThreadSafe>
+    struct CoefficientThreadState
+    {
+        typedef typename Coeff::ThreadState Type;
+
+        static Type get()
+        {
+            return Coeff::threadState();
+        }
+
+        static void set( Type state )
+        {
+            Coeff::setThreadState( state );
+        }
+    };
+
+    /**
+     * Domains which are not thread-safe are never used by several threads, so there is no state to transfer.
+     */
+    template<class Coeff>
+    struct CoefficientThreadState<Coeff, false>
+    {
+        typedef bool Type;
+
+        static Type get()
+        {
+            return false;
+        }
+
+        static void set( Type )
+        {}
+    };
+
     /**
     * Class encapsulating the calculation of Groebner bases.
     *
+    * The critical pairs are installed by the Gebauer-Moeller update, which discards pairs by Buchberger's product and
+    * chain criteria, and are processed in the order given by a GroebnerSettings::PairSelectionStrategy. Over fields, the
+    * pairs can alternatively be reduced in batches by the F4 algorithm or by a signature-based algorithm, see
+    * GroebnerSettings::Engine. Buchberger's algorithm can reduce the pairs of the lowest degree concurrently, see setThreads.
+    *
+    * The state of the computation can be saved by push and restored by pop. All changes in between are recorded in a
+    * trail, so restoring takes time proportional to the changes and not to the size of the basis.
+    *
+    * Every element of the basis knows the generators it was computed from (its origins), so an inconsistent ideal
+    * can be explained by a subset of the generators, see getInfeasibleSubset.
+    *
     * @author Sebastian Junges
     * @since 2011-12-05
-    * @version 2012-01-19
+    * @version 2026-10-18
+    * @param Coeff the coefficient domain of the polynomials, see MultivariateTermMRT
     */
-    class Groebner
+    template<class Coeff>
+    class GroebnerT
     {
         public:
+            typedef MultivariatePolynomialMRT<Coeff>                   PolynomialType;
+            typedef typename std::list<PolynomialType>::iterator       lpol_It;
+            typedef typename std::list<PolynomialType>::const_iterator lpol_cIt;
+            /// A flag for each generator, see getGenerators
+            typedef std::vector<bool>                                  Origins;
 
-            Groebner();
+            GroebnerT();
 
             /**
              * Creates an ideal with 1 polynomial
              * @param p1
              */
-            Groebner( const MultivariatePolynomialMR& p1 );
+            GroebnerT( const PolynomialType& p1 );
 
             /**
              * Creates an ideal with 2 polynomials
              * @param p1
              * @param p2
              */
-            Groebner( const MultivariatePolynomialMR& p1, const MultivariatePolynomialMR& p2 );
+            GroebnerT( const PolynomialType& p1, const PolynomialType& p2 );
 
             /**
              * Creates an ideal with 3 polynomials
@@ -59,23 +124,36 @@ namespace GiNaCRA
              * @param p2
              * @param p3
              */
-            Groebner( const MultivariatePolynomialMR& p1, const MultivariatePolynomialMR& p2, const MultivariatePolynomialMR& p3 );
+            GroebnerT( const PolynomialType& p1, const PolynomialType& p2, const PolynomialType& p3 );
 
             /**
              * Creates an ideal by the list of polynomials
              * @param begin_generatingset
              * @param end_generatingset
              */
-            Groebner( std::list<MultivariatePolynomialMR>::iterator begin_generatingset,
-                      std::list<MultivariatePolynomialMR>::iterator end_generatingset );
+            GroebnerT( typename std::list<PolynomialType>::iterator begin_generatingset,
+                       typename std::list<PolynomialType>::iterator end_generatingset );
 
-            void addPolynomial( const MultivariatePolynomialMR& p1 );
+            /**
+             * Copies the state of the computation. The checkpoints are not copied.
+             * @param g
+             */
+            GroebnerT( const GroebnerT& g );
+
+            GroebnerT& operator =( const GroebnerT& g );
+
+            void addPolynomial( const PolynomialType& p1 );
 
             /**
              * Reduce the input-ideal to a Groebner basis.
              *
-             * This method implements the original Buchberger algorithm.
+             * This method implements the Buchberger algorithm with the criteria installed by the Gebauer-Moeller update,
+             * or the F4 or the signature-based algorithm if it is chosen by setEngine and the coefficients form a field.
              * @see ISBN-10: 0387946802, Ch, 2, §7
+             * @see ISBN-10: 0387979719, Ch. 5.5 (algorithm GROEBNERNEW2)
+             * @see DOI 10.1016/S0022-4049(99)00005-5
+             * @see DOI 10.1145/780506.780516
+             * @see DOI 10.1016/j.jsc.2015.06.003
              */
             void solve();
 
@@ -90,10 +168,10 @@ namespace GiNaCRA
              * @param rhs
              * @return
              */
-            friend std::ostream& operator <<( std::ostream& os, const Groebner& rhs )
+            friend std::ostream& operator <<( std::ostream& os, const GroebnerT& rhs )
             {
                 os << "{";
-                for( lpol_cIt i = rhs.mGB.begin(); i != rhs.mGB.end(); ++i )
+                for( lbasis_cIt i = rhs.mGB.begin(); i != rhs.mGB.end(); ++i )
                 {
                     os << *i << std::endl;
                 }
@@ -106,18 +184,39 @@ namespace GiNaCRA
             void print() const
             {
                 std::cout << "{" << std::endl;
-                for( lpol_cIt i = mGB.begin(); i != mGB.end(); ++i )
+                for( lbasis_cIt i = mGB.begin(); i != mGB.end(); ++i )
                 {
                     std::cout << i->toEx() << std::endl;
                 }
                 std::cout << "}";
             }
 
-            std::list<MultivariatePolynomialMR> getBase()
+            std::list<PolynomialType> getBase() const
             {
-                return mGB;
+                return std::list<PolynomialType>( mGB.begin(), mGB.end() );
             }
 
+            /**
+             * @return the generators of the ideal in the order they were added, the constructors sort them by their leading terms
+             */
+            inline const std::vector<PolynomialType>& getGenerators() const
+            {
+                return mGenerators;
+            }
+
+            /**
+             * @return for each polynomial of getBase the generators it was computed from
+             */
+            std::list<Origins> getOrigins() const;
+
+            /**
+             * Explains why the ideal contains 1.
+             * @param minimize if true, generators are removed from the subset as long as the remaining ones still
+             * generate 1, which requires further Groebner basis computations
+             * @return generators whose ideal contains 1, or an empty list if solve has not found a constant
+             */
+            std::list<PolynomialType> getInfeasibleSubset( bool minimize = false ) const;
+
             inline bool isConstant() const
             {
                 return mGB.size() == 1 && mGB.begin()->isConstant();
@@ -153,22 +252,270 @@ namespace GiNaCRA
 
             bool hasBeenReduced() const;
 
+            inline GroebnerSettings::PairSelectionStrategy pairSelectionStrategy() const
+            {
+                return pairsToBeChecked.key_comp().mStrategy;
+            }
+
+            /**
+             * Sets the order in which the remaining critical pairs are processed.
+             * @param strategy
+             */
+            void setPairSelectionStrategy( GroebnerSettings::PairSelectionStrategy strategy );
+
+            /**
+             * @return the number of critical pairs which remain to be processed by solve
+             */
+            inline unsigned nrOfPendingPairs() const
+            {
+                return pairsToBeChecked.size();
+            }
+
+            /**
+             * @return the least common multiple of the leading monomials of the critical pair which solve processes next,
+             * or the constant monomial if there is no pair left
+             */
+            inline MultivariateMonomialMR nextPairLcm() const
+            {
+                return pairsToBeChecked.empty() ? MultivariateMonomialMR() : pairsToBeChecked.begin()->mLcm;
+            }
+
+            inline GroebnerSettings::Engine engine() const
+            {
+                return mEngine;
+            }
+
+            /**
+             * Sets the algorithm used by solve. The F4 and the signature engine are ignored if the coefficients do not form a field.
+             * @param engine
+             */
+            inline void setEngine( GroebnerSettings::Engine engine )
+            {
+                mEngine = engine;
+            }
+
+            /**
+             * @return the number of S-polynomials reduced to zero by solve so far, the F4 engine does not count its rows
+             */
+            inline unsigned nrOfZeroReductions() const
+            {
+                return mNrOfZeroReductions;
+            }
+
+            inline unsigned threads() const
+            {
+                return mThreads;
+            }
+
+            /**
+             * Sets the number of threads reducing the S-polynomials in Buchberger's algorithm. All pairs of the lowest
+             * degree are reduced concurrently with respect to the current basis, and the non-zero remainders are added
+             * in the order of the pairs, so the result does not depend on the number of threads. The setting is ignored
+             * if the coefficient domain is not thread-safe (Coeff::isThreadSafe).
+             * @param threads the number of threads, 0 means one per hardware thread
+             */
+            void setThreads( unsigned threads );
+
+            /**
+             * Saves the current state, i.e., the ideal, the basis and the remaining critical pairs, as a checkpoint.
+             */
+            void push();
+
+            /**
+             * Restores the state of the latest checkpoint and removes it. Polynomials added, pairs processed and
+             * reductions performed after the corresponding push are undone.
+             */
+            void pop() throw ( std::runtime_error );
+
+            /**
+             * @return the number of checkpoints which can be restored by pop
+             */
+            inline unsigned nrOfCheckpoints() const
+            {
+                return mCheckpoints.size();
+            }
+
         private:
-            void fillB();
+            /// A polynomial of the basis together with the data needed for the pair management.
+            struct BasisElement:
+                public PolynomialType
+            {
+                BasisElement( const PolynomialType& p, unsigned sugar, const Origins& origins ):
+                    PolynomialType( p ),
+                    mSugar( sugar ),
+                    mIsRedundant( false ),
+                    mOrigins( origins )
+                {}
+
+                /// the sugar degree, an estimate of the degree the polynomial would have in a homogeneous computation
+                unsigned mSugar;
+                /// the leading monomial is divisible by the one of a later basis element, so no new pairs are formed with this element
+                bool mIsRedundant;
+                /// the generators which contributed to the polynomial, shorter than the number of generators if the later ones did not
+                Origins mOrigins;
+            };
 
-            std::list<MultivariatePolynomialMR>                         mIdeal;
-            std::list<MultivariatePolynomialMR>                         mGB;
-            typedef std::list<MultivariatePolynomialMR>::iterator       lpol_It;
-            typedef std::list<MultivariatePolynomialMR>::const_iterator lpol_cIt;
+            typedef typename std::list<BasisElement>::iterator       lbasis_It;
+            typedef typename std::list<BasisElement>::const_iterator lbasis_cIt;
 
-            /// A list of pairs to be checked
-            std::list<std::pair<lpol_cIt, lpol_cIt> > pairsToBeChecked;
+            /// A pair of basis elements whose S-polynomial still has to be reduced.
+            struct CriticalPair
+            {
+                CriticalPair():
+                    mSugar( 0 ),
+                    mIsCoprime( false )
+                {}
+
+                CriticalPair( lbasis_cIt first, lbasis_cIt second );
+
+                lbasis_cIt             mFirst;
+                lbasis_cIt             mSecond;
+                /// the least common multiple of the leading monomials
+                MultivariateMonomialMR mLcm;
+                /// the sugar degree of the S-polynomial
+                unsigned               mSugar;
+                /// the leading monomials are coprime
+                bool                   mIsCoprime;
+            };
+
+            /// Strict weak ordering of the critical pairs according to a pair selection strategy.
+            struct CriticalPairCompare
+            {
+                CriticalPairCompare( GroebnerSettings::PairSelectionStrategy strategy = GroebnerSettings::DEFAULT_PAIRSELECTIONSTRATEGY ):
+                    mStrategy( strategy )
+                {}
+
+                bool operator ()( const CriticalPair& p1, const CriticalPair& p2 ) const;
+
+                GroebnerSettings::PairSelectionStrategy mStrategy;
+            };
+
+            typedef std::multiset<CriticalPair, CriticalPairCompare> PairQueue;
+
+            /// A change of the state which is undone by pop.
+            struct Change
+            {
+                enum Kind
+                {
+                    BASIS_INSERTION,
+                    IDEAL_INSERTION,
+                    GENERATOR_INSERTION,
+                    PAIR_INSERTION,
+                    PAIR_REMOVAL,
+                    REDUNDANCY,
+                    /// the basis and the pairs were replaced as a whole, the old ones are kept in mReplacedBases and mReplacedPairs
+                    BASIS_REPLACEMENT
+                };
+
+                Change( Kind kind ):
+                    mKind( kind )
+                {}
+
+                Kind         mKind;
+                /// the element inserted or marked as redundant
+                lbasis_It    mElement;
+                lpol_It      mIdealElement;
+                /// the pair inserted or removed
+                CriticalPair mPair;
+            };
+
+            /// A polynomial of the signature-based engine, whose signature is mSignature times the generator currently added.
+            struct LabeledPolynomial
+            {
+                LabeledPolynomial( const PolynomialType& p, const MultivariateMonomialMR& signature, const Origins& origins ):
+                    mPolynomial( p ),
+                    mSignature( signature ),
+                    mOrigins( origins )
+                {}
+
+                PolynomialType         mPolynomial;
+                MultivariateMonomialMR mSignature;
+                Origins                mOrigins;
+            };
+
+            /// The signatures of the J-pairs of the signature-based engine, i.e., of the multiples of labeled polynomials forming S-polynomials.
+            typedef std::set<MultivariateMonomialMR, MonomMRCompare> JPairQueue;
+
+            /// The data saved by push.
+            struct Checkpoint
+            {
+                Checkpoint( unsigned trailSize, bool isSolved, bool isReduced ):
+                    mTrailSize( trailSize ),
+                    mIsSolved( isSolved ),
+                    mIsReduced( isReduced )
+                {}
+
+                unsigned mTrailSize;
+                bool     mIsSolved;
+                bool     mIsReduced;
+            };
+
+            void initialize();
+            void fillB( const std::list<BasisElement>& elements );
+            void addPolynomial( const PolynomialType& p1, unsigned sugar, const Origins& origins );
+            void update( lbasis_It h );
+            void insertPair( const CriticalPair& p );
+            typename PairQueue::iterator erasePair( typename PairQueue::iterator p );
+            void markRedundant( lbasis_It g );
+            void replaceBasis();
+            void setConstantBasis( const PolynomialType& constant, const Origins& origins );
+            static void unite( Origins& origins, const Origins& other );
+            Origins originsOf( const std::vector<bool>& used, const Origins& origins ) const;
+            Origins originsOf( const CriticalPair& p, const std::vector<bool>& used ) const;
+            unsigned selectionDegree( const CriticalPair& p ) const;
+            void solveBuchberger();
+            void solveParallelBuchberger();
+            void solveF4();
+            void solveSignature();
+            bool regularReduce( PolynomialType& p, const MultivariateMonomialMR& signature, const std::list<BasisElement>& previous,
+                                const std::vector<LabeledPolynomial>& labeled, Origins& origins ) const;
+            void insertJPairs( unsigned r, const std::list<BasisElement>& previous, const std::vector<LabeledPolynomial>& labeled,
+                               const std::list<MultivariateMonomialMR>& syzygies, JPairQueue& jpairs ) const;
+            static bool isSyzygySignature( const MultivariateMonomialMR& signature, const std::list<BasisElement>& previous,
+                                           const std::list<MultivariateMonomialMR>& syzygies );
+            static std::list<BasisElement> reducedBasis( const std::list<BasisElement>& basis );
+            static void reducePairs( const std::vector<CriticalPair>& pairs, const PolynomialDivisorIndex<lbasis_cIt>& basis,
+                                     std::vector<PolynomialType>& remainders, std::vector<std::vector<bool> >& used, unsigned first,
+                                     unsigned step );
+            static void reducePairsInThread( typename CoefficientThreadState<Coeff>::Type state, const std::vector<CriticalPair>& pairs,
+                                             const PolynomialDivisorIndex<lbasis_cIt>& basis, std::vector<PolynomialType>& remainders,
+                                             std::vector<std::vector<bool> >& used, unsigned first, unsigned step );
+
+            std::list<PolynomialType>   mIdeal;
+            std::vector<PolynomialType> mGenerators;
+            std::list<BasisElement>     mGB;
+
+            /// The pairs to be checked, ordered by the pair selection strategy
+            PairQueue pairsToBeChecked;
 
             /// A flag whether the basis is solved already
             bool mIsSolved;
             /// A flag whether the basis is reduced already
             bool mIsReduced;
+            /// The algorithm used by solve
+            GroebnerSettings::Engine mEngine;
+            /// The number of threads used by solveParallelBuchberger
+            unsigned mThreads;
+            unsigned mNrOfZeroReductions;
+
+            /// The changes since the first checkpoint, empty if there is no checkpoint
+            std::vector<Change>                  mTrail;
+            std::vector<Checkpoint>              mCheckpoints;
+            std::list<std::list<BasisElement> >  mReplacedBases;
+            std::list<PairQueue>                 mReplacedPairs;
     };
 
+    /// Groebner bases over the symbolic coefficients of MultivariateCoefficientMR.
+    typedef GroebnerT<MultivariateCoefficientMR> Groebner;
+    /// Groebner bases over the rational numbers.
+    typedef GroebnerT<RationalCoefficientMR> GroebnerQ;
+    /// Groebner bases over the integers, computed fraction-free.
+    typedef GroebnerT<IntegerCoefficientMR> GroebnerZ;
+    /// Groebner bases over the prime field given by ModularCoefficientMR::modulus().
+    typedef GroebnerT<ModularCoefficientMR> GroebnerZp;
+
 }
+
+#include "Groebner.tpp"
+
 #endif   /** GROEBNER_H */
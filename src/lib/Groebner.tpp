@@ -0,0 +1,1029 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+/**
+ * Implementation of the class template GroebnerT. Included by Groebner.h.
+ */
+
+#include <algorithm>
+#include <list>
+#include <functional>
+#include <map>
+#include <thread>
+#include <vector>
+
+namespace GiNaCRA
+{
+    template<class Coeff>
+    GroebnerT<Coeff>::GroebnerT():
+        mIsSolved( true ),
+        mIsReduced( true ),
+        mEngine( GroebnerSettings::DEFAULT_ENGINE ),
+        mThreads( GroebnerSettings::DEFAULT_THREADS ),
+        mNrOfZeroReductions( 0 )
+    {}
+
+    template<class Coeff>
+    GroebnerT<Coeff>::GroebnerT( const PolynomialType& p1 ):
+        mIsSolved( true ),
+        mIsReduced( false ),
+        mEngine( GroebnerSettings::DEFAULT_ENGINE ),
+        mThreads( GroebnerSettings::DEFAULT_THREADS ),
+        mNrOfZeroReductions( 0 )
+    {
+        mIdeal.push_back( p1 );
+        initialize();
+    }
+
+    template<class Coeff>
+    GroebnerT<Coeff>::GroebnerT( const PolynomialType& p1, const PolynomialType& p2 ):
+        mIsSolved( false ),
+        mIsReduced( false ),
+        mEngine( GroebnerSettings::DEFAULT_ENGINE ),
+        mThreads( GroebnerSettings::DEFAULT_THREADS ),
+        mNrOfZeroReductions( 0 )
+    {
+        mIdeal.push_back( p1 );
+        mIdeal.push_back( p2 );
+        mIdeal.sort( PolynomialType::sortByLeadingTerm );
+        initialize();
+    }
+
+    template<class Coeff>
+    GroebnerT<Coeff>::GroebnerT( const PolynomialType& p1, const PolynomialType& p2, const PolynomialType& p3 ):
+        mIsSolved( false ),
+        mIsReduced( false ),
+        mEngine( GroebnerSettings::DEFAULT_ENGINE ),
+        mThreads( GroebnerSettings::DEFAULT_THREADS ),
+        mNrOfZeroReductions( 0 )
+    {
+        mIdeal.push_back( p1 );
+        mIdeal.push_back( p2 );
+        mIdeal.push_back( p3 );
+        mIdeal.sort( PolynomialType::sortByLeadingTerm );
+        initialize();
+    }
+
+    template<class Coeff>
+    GroebnerT<Coeff>::GroebnerT( typename std::list<PolynomialType>::iterator begin_generatingset,
+                                 typename std::list<PolynomialType>::iterator end_generatingset ):
+        mIsSolved( false ),
+        mIsReduced( false ),
+        mEngine( GroebnerSettings::DEFAULT_ENGINE ),
+        mThreads( GroebnerSettings::DEFAULT_THREADS ),
+        mNrOfZeroReductions( 0 )
+    {
+        mIdeal = std::list<PolynomialType>( begin_generatingset, end_generatingset );
+        mIdeal.sort( PolynomialType::sortByLeadingTerm );
+        initialize();
+    }
+
+    template<class Coeff>
+    GroebnerT<Coeff>::GroebnerT( const GroebnerT& g ):
+        mIdeal( g.mIdeal ),
+        mGenerators( g.mGenerators ),
+        mGB( g.mGB ),
+        pairsToBeChecked( g.pairsToBeChecked.key_comp() ),
+        mIsSolved( g.mIsSolved ),
+        mIsReduced( g.mIsReduced ),
+        mEngine( g.mEngine ),
+        mThreads( g.mThreads ),
+        mNrOfZeroReductions( g.mNrOfZeroReductions )
+    {
+        // the pairs of g refer to the elements of g
+        std::map<const BasisElement*, lbasis_cIt> elements;
+        lbasis_cIt                                copy = mGB.begin();
+        for( lbasis_cIt e = g.mGB.begin(); e != g.mGB.end(); ++e, ++copy )
+            elements[&*e] = copy;
+        for( typename PairQueue::const_iterator p = g.pairsToBeChecked.begin(); p != g.pairsToBeChecked.end(); ++p )
+        {
+            CriticalPair q = *p;
+            q.mFirst       = elements[&*p->mFirst];
+            q.mSecond      = elements[&*p->mSecond];
+            pairsToBeChecked.insert( pairsToBeChecked.end(), q );
+        }
+    }
+
+    template<class Coeff>
+    GroebnerT<Coeff>& GroebnerT<Coeff>::operator =( const GroebnerT& g )
+    {
+        if( this == &g )
+            return *this;
+        GroebnerT copy( g );
+        mIdeal.swap( copy.mIdeal );
+        mGenerators.swap( copy.mGenerators );
+        mGB.swap( copy.mGB );
+        pairsToBeChecked.swap( copy.pairsToBeChecked );
+        mIsSolved  = copy.mIsSolved;
+        mIsReduced = copy.mIsReduced;
+        mEngine    = copy.mEngine;
+        mThreads   = copy.mThreads;
+        mNrOfZeroReductions = copy.mNrOfZeroReductions;
+        mTrail.clear();
+        mCheckpoints.clear();
+        mReplacedBases.clear();
+        mReplacedPairs.clear();
+        return *this;
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::addPolynomial( const PolynomialType& p1 )
+    {
+        Origins origins( mGenerators.size() + 1, false );
+        origins.back() = true;
+        mGenerators.push_back( p1 );
+        if( !mCheckpoints.empty() )
+            mTrail.push_back( Change( Change::GENERATOR_INSERTION ));
+        if( !p1.isZero() )
+            addPolynomial( p1, p1.tdeg(), origins );
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::addPolynomial( const PolynomialType& p1, unsigned sugar, const Origins& origins )
+    {
+        lbasis_It inputloc = std::lower_bound( mGB.begin(), mGB.end(), p1, PolynomialType::sortByLeadingTerm );
+        inputloc           = mGB.insert( inputloc, BasisElement( p1, sugar, origins ));
+        if( !mCheckpoints.empty() )
+        {
+            mTrail.push_back( Change( Change::BASIS_INSERTION ));
+            mTrail.back().mElement = inputloc;
+        }
+        update( inputloc );
+
+        lpol_It inputlocIdeal = std::lower_bound( mIdeal.begin(), mIdeal.end(), p1, PolynomialType::sortByLeadingTerm );
+        inputlocIdeal         = mIdeal.insert( inputlocIdeal, p1 );
+        if( !mCheckpoints.empty() )
+        {
+            mTrail.push_back( Change( Change::IDEAL_INSERTION ));
+            mTrail.back().mIdealElement = inputlocIdeal;
+        }
+
+        mIsReduced = false;
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::solve()
+    {
+        if( mEngine == GroebnerSettings::F4_ENGINE && Coeff::isField )
+            solveF4();
+        else if( mEngine == GroebnerSettings::SIGNATURE_ENGINE && Coeff::isField )
+            solveSignature();
+        else if( mThreads > 1 && Coeff::isThreadSafe )
+            solveParallelBuchberger();
+        else
+            solveBuchberger();
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::solveBuchberger()
+    {
+        // the index is rebuilt whenever a remainder is added to the basis
+        PolynomialDivisorIndex<lbasis_cIt> divisors( mGB.begin(), mGB.end() );
+        while( !pairsToBeChecked.empty() )
+        {
+            CriticalPair p = *pairsToBeChecked.begin();
+            erasePair( pairsToBeChecked.begin() );
+
+            std::vector<bool> used;
+            PolynomialType    rem = PolynomialType::SPol( *(p.mFirst), *(p.mSecond) ).CalculateRemainder( divisors, used );
+
+            // If the remainder is not zero, we will add it to the ideal
+            if( rem.isConstant() )
+            {
+                setConstantBasis( rem, originsOf( p, used ));
+                return;
+            }
+
+            if( !rem.isZero() )
+            {
+                addPolynomial( rem, std::max( p.mSugar, rem.tdeg() ), originsOf( p, used ));
+                divisors = PolynomialDivisorIndex<lbasis_cIt>( mGB.begin(), mGB.end() );
+            }
+            else
+                ++mNrOfZeroReductions;
+
+        }
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::solveParallelBuchberger()
+    {
+        while( !pairsToBeChecked.empty() )
+        {
+            // the pairs of the lowest degree, the basis is not changed while they are reduced
+            std::vector<CriticalPair> batch;
+            const unsigned            degree = selectionDegree( *pairsToBeChecked.begin() );
+            while( !pairsToBeChecked.empty() && selectionDegree( *pairsToBeChecked.begin() ) == degree )
+            {
+                batch.push_back( *pairsToBeChecked.begin() );
+                erasePair( pairsToBeChecked.begin() );
+            }
+
+            PolynomialDivisorIndex<lbasis_cIt> divisors( mGB.begin(), mGB.end() );
+            std::vector<PolynomialType>        remainders( batch.size() );
+            std::vector<std::vector<bool> >    used( batch.size() );
+            unsigned                           nrOfThreads = std::min<unsigned>( mThreads, batch.size() );
+            std::vector<std::thread>           workers;
+            for( unsigned t = 1; t < nrOfThreads; ++t )
+                workers.push_back( std::thread( &GroebnerT::reducePairsInThread, CoefficientThreadState<Coeff>::get(), std::cref( batch ), std::cref( divisors ),
+                                                std::ref( remainders ), std::ref( used ), t, nrOfThreads ));
+            reducePairs( batch, divisors, remainders, used, 0, nrOfThreads );
+            for( typename std::vector<std::thread>::iterator w = workers.begin(); w != workers.end(); ++w )
+                w->join();
+
+            // the flags refer to the positions in the basis, which change by adding remainders
+            std::vector<Origins> origins( batch.size() );
+            for( unsigned i = 0; i < batch.size(); ++i )
+                origins[i] = originsOf( batch[i], used[i] );
+
+            for( unsigned i = 0; i < batch.size(); ++i )
+            {
+                // remainders added before might reduce this one further
+                PolynomialType rem = remainders[i];
+                if( i > 0 && !rem.isZero() )
+                {
+                    std::vector<bool> usedLater;
+                    rem        = rem.CalculateRemainder( divisors, usedLater );
+                    origins[i] = originsOf( usedLater, origins[i] );
+                }
+                if( rem.isConstant() )
+                {
+                    setConstantBasis( rem, origins[i] );
+                    return;
+                }
+
+                if( !rem.isZero() )
+                {
+                    addPolynomial( rem, std::max( batch[i].mSugar, rem.tdeg() ), origins[i] );
+                    divisors = PolynomialDivisorIndex<lbasis_cIt>( mGB.begin(), mGB.end() );
+                }
+                else
+                    ++mNrOfZeroReductions;
+            }
+        }
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::reducePairs( const std::vector<CriticalPair>& pairs, const PolynomialDivisorIndex<lbasis_cIt>& basis,
+                                        std::vector<PolynomialType>& remainders, std::vector<std::vector<bool> >& used,
+                                        unsigned first, unsigned step )
+    {
+        for( unsigned i = first; i < pairs.size(); i += step )
+            remainders[i] = PolynomialType::SPol( *(pairs[i].mFirst), *(pairs[i].mSecond) ).CalculateRemainder( basis, used[i] );
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::reducePairsInThread( typename CoefficientThreadState<Coeff>::Type state, const std::vector<CriticalPair>& pairs,
+                                                const PolynomialDivisorIndex<lbasis_cIt>& basis, std::vector<PolynomialType>& remainders,
+                                                std::vector<std::vector<bool> >& used, unsigned first, unsigned step )
+    {
+        CoefficientThreadState<Coeff>::set( state );
+        reducePairs( pairs, basis, remainders, used, first, step );
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::solveF4()
+    {
+        typedef std::set<MultivariateMonomialMR, MonomMRCompare>                     MonomialSet;
+        typedef std::map<MultivariateMonomialMR, std::list<lbasis_cIt>, MonomMRCompare> MultiplierMap;
+        typedef typename MacaulayMatrix<Coeff>::Row                                   Row;
+
+        while( !pairsToBeChecked.empty() )
+        {
+            const MonomMRCompare order  = mGB.begin()->getMonomOrder();
+            const unsigned       degree = selectionDegree( *pairsToBeChecked.begin() );
+
+            // select all pairs of the lowest degree, each contributing the two multiples of its elements with leading monomial lcm
+            std::list<PolynomialType> rows;
+            std::vector<lbasis_cIt>   rowElements;
+            MonomialSet               monomials( order );
+            MultiplierMap             multiples( order );
+            unsigned                  sugar = 0;
+            while( !pairsToBeChecked.empty() && selectionDegree( *pairsToBeChecked.begin() ) == degree )
+            {
+                CriticalPair p = *pairsToBeChecked.begin();
+                erasePair( pairsToBeChecked.begin() );
+                sugar = std::max( sugar, p.mSugar );
+                monomials.insert( p.mLcm );
+                std::list<lbasis_cIt>& used = multiples[p.mLcm];
+                if( std::find( used.begin(), used.end(), p.mFirst ) == used.end() )
+                {
+                    used.push_back( p.mFirst );
+                    rows.push_back( p.mFirst->multiply( p.mLcm / p.mFirst->lmon() ));
+                    rowElements.push_back( p.mFirst );
+                }
+                if( std::find( used.begin(), used.end(), p.mSecond ) == used.end() )
+                {
+                    used.push_back( p.mSecond );
+                    rows.push_back( p.mSecond->multiply( p.mLcm / p.mSecond->lmon() ));
+                    rowElements.push_back( p.mSecond );
+                }
+            }
+
+            // symbolic preprocessing: add a reducer for every monomial divisible by a leading monomial of the basis
+            MonomialDivisorIndex    leading;
+            std::vector<lbasis_cIt> elements;
+            for( lbasis_cIt g = mGB.begin(); g != mGB.end(); ++g )
+            {
+                leading.push_back( g->lmon() );
+                elements.push_back( g );
+            }
+            for( lpol_cIt row = rows.begin(); row != rows.end(); ++row )
+            {
+                for( typename PolynomialType::TermcIt t = row->begin(); t != row->end(); ++t )
+                {
+                    const MultivariateMonomialMR& m = *t;
+                    if( !monomials.insert( m ).second )
+                        continue;
+                    unsigned g = leading.findDivisor( m );
+                    if( g < leading.size() )
+                    {
+                        rows.push_back( elements[g]->multiply( m / leading[g] ));
+                        rowElements.push_back( elements[g] );
+                    }
+                }
+            }
+
+            // column 0 belongs to the greatest monomial
+            std::vector<MultivariateMonomialMR>                        columnMonomials( monomials.rbegin(), monomials.rend() );
+            std::map<MultivariateMonomialMR, unsigned, MonomMRCompare> columns( order );
+            for( unsigned c = 0; c < columnMonomials.size(); ++c )
+                columns[columnMonomials[c]] = c;
+
+            // the rows are labeled by the basis elements they are multiples of, for tracking the origins
+            std::vector<lbasis_cIt>                   sources;
+            std::map<const BasisElement*, unsigned>   sourceIndices;
+            for( typename std::vector<lbasis_cIt>::const_iterator g = rowElements.begin(); g != rowElements.end(); ++g )
+            {
+                if( sourceIndices.insert( std::pair<const BasisElement*, unsigned>( &**g, sources.size() )).second )
+                    sources.push_back( *g );
+            }
+
+            MacaulayMatrix<Coeff> matrix( columnMonomials.size(), sources.size() );
+            typename std::vector<lbasis_cIt>::const_iterator g = rowElements.begin();
+            for( lpol_cIt row = rows.begin(); row != rows.end(); ++row, ++g )
+            {
+                Row entries;
+                entries.reserve( row->nrOfTerms() );
+                for( typename PolynomialType::TermcrIt t = row->rbegin(); t != row->rend(); ++t )
+                    entries.push_back( typename MacaulayMatrix<Coeff>::Entry( columns[*t], t->getCoeff() ));
+                matrix.addRow( entries, sourceIndices[&**g] );
+            }
+
+            // the new rows have leading monomials which are not divisible by the leading monomials of the basis
+            std::vector<Row> newRows = matrix.echelonize();
+            for( typename std::vector<Row>::const_iterator row = newRows.begin(); row != newRows.end(); ++row )
+            {
+                typename PolynomialType::TermSet terms( order );
+                for( typename Row::const_iterator entry = row->begin(); entry != row->end(); ++entry )
+                    terms.insert( typename PolynomialType::Term( columnMonomials[entry->first], entry->second ));
+                PolynomialType p( terms.begin(), terms.end(), order );
+                Origins origins;
+                const std::vector<bool>& rowSources = matrix.sources( row->front().first );
+                for( unsigned s = 0; s < sources.size(); ++s )
+                {
+                    if( rowSources[s] )
+                        unite( origins, sources[s]->mOrigins );
+                }
+                if( p.isConstant() )
+                {
+                    setConstantBasis( p, origins );
+                    return;
+                }
+                addPolynomial( p, std::max( sugar, p.tdeg() ), origins );
+            }
+        }
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::reduce()
+    {
+        bool solved = false;
+        if( pairsToBeChecked.empty() )
+            solved = true;
+        if( mIsReduced )
+            return;
+        // the basis itself is kept for the checkpoints
+        std::list<BasisElement> reduced = reducedBasis( mGB );
+
+        if( solved )
+        {
+            replaceBasis();
+            mGB.splice( mGB.end(), reduced );
+            mIsReduced = true;
+        }
+        else
+        {
+            fillB( reduced );
+        }
+    }
+
+    template<class Coeff>
+    std::list<typename GroebnerT<Coeff>::BasisElement> GroebnerT<Coeff>::reducedBasis( const std::list<BasisElement>& basis )
+    {
+        // Minimize (faster than the reduction algorithm)
+        std::list<lbasis_cIt> minimal;
+        MonomialDivisorIndex  leading, minimalLeading;
+        for( lbasis_cIt i = basis.begin(); i != basis.end(); ++i )
+            leading.push_back( i->lmon() );
+        unsigned position = 0;
+        for( lbasis_cIt i = basis.begin(); i != basis.end(); ++i, ++position )
+        {
+            const MultivariateMonomialMR& lm   = leading[position];
+            DivisorMask                   mask = lm.divisorMask();
+            bool div = minimalLeading.findDivisor( lm, mask, 0 ) < minimalLeading.size()
+                       || leading.findDivisor( lm, mask, position + 1 ) < leading.size();
+
+            if( !div )
+            {
+                minimal.push_back( i );
+                minimalLeading.push_back( lm );
+            }
+        }
+        // Calculate reduction
+        // The number of polynomials will not change anymore!
+        std::list<BasisElement> reduced;
+        typename std::list<lbasis_cIt>::const_iterator i = minimal.begin();
+        reduced.push_back( BasisElement( (*i)->normalized(), (*i)->tdeg(), (*i)->mOrigins ));
+        for( ++i; i != minimal.end(); ++i )
+        {
+            std::vector<bool> used;
+            PolynomialType    rem     = (*i)->CalculateRemainder( reduced.begin(), reduced.end(), used ).normalized();
+            Origins           origins = (*i)->mOrigins;
+            unsigned          index   = 0;
+            for( lbasis_cIt r = reduced.begin(); r != reduced.end(); ++r, ++index )
+            {
+                if( used[index] )
+                    unite( origins, r->mOrigins );
+            }
+            reduced.push_back( BasisElement( rem, rem.tdeg(), origins ));
+        }
+        return reduced;
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::solveSignature()
+    {
+        if( pairsToBeChecked.empty() )
+            return;
+        const MonomMRCompare order = mGB.begin()->getMonomOrder();
+
+        // the elements of the basis are added one by one, by increasing degrees
+        std::multimap<unsigned, lbasis_cIt> input;
+        for( lbasis_cIt g = mGB.begin(); g != mGB.end(); ++g )
+            input.insert( std::make_pair( g->tdeg(), g ));
+
+        // the reduced Groebner basis of the elements added so far, their signatures are smaller than the ones of the current generator
+        std::list<BasisElement> previous;
+        for( typename std::multimap<unsigned, lbasis_cIt>::const_iterator f = input.begin(); f != input.end(); ++f )
+        {
+            // the polynomials with signatures m*e for the generator e = f->second, sorted by the time they were added
+            std::vector<LabeledPolynomial>    labeled;
+            // the signature monomials of the syzygies found by reductions to zero
+            std::list<MultivariateMonomialMR> syzygies;
+            JPairQueue                        jpairs( order );
+            jpairs.insert( MultivariateMonomialMR() );
+            while( !jpairs.empty() )
+            {
+                // all multiples with the same signature are equivalent modulo polynomials of smaller signatures
+                MultivariateMonomialMR signature = *jpairs.begin();
+                jpairs.erase( jpairs.begin() );
+                if( isSyzygySignature( signature, previous, syzygies ))
+                    continue;
+
+                // rewrite criterion: the multiple of the latest polynomial whose signature divides the signature is
+                // reduced instead, the others are discarded without a reduction
+                PolynomialType p( order );
+                Origins        origins;
+                if( labeled.empty() )
+                {
+                    p       = *f->second;
+                    origins = f->second->mOrigins;
+                }
+                else
+                {
+                    unsigned rewriter = labeled.size() - 1;
+                    while( !signature.dividable( labeled[rewriter].mSignature ))
+                        --rewriter;
+                    p       = labeled[rewriter].mPolynomial.multiply( signature / labeled[rewriter].mSignature );
+                    origins = labeled[rewriter].mOrigins;
+                }
+
+                if( !regularReduce( p, signature, previous, labeled, origins ))
+                    continue;
+                if( p.isZero() )
+                {
+                    ++mNrOfZeroReductions;
+                    syzygies.push_back( signature );
+                    continue;
+                }
+                if( p.isConstant() )
+                {
+                    setConstantBasis( p, origins );
+                    return;
+                }
+                labeled.push_back( LabeledPolynomial( p.normalized(), signature, origins ));
+                insertJPairs( labeled.size() - 1, previous, labeled, syzygies, jpairs );
+            }
+
+            for( typename std::vector<LabeledPolynomial>::const_iterator l = labeled.begin(); l != labeled.end(); ++l )
+            {
+                lbasis_It position = std::lower_bound( previous.begin(), previous.end(), l->mPolynomial, PolynomialType::sortByLeadingTerm );
+                previous.insert( position, BasisElement( l->mPolynomial, l->mPolynomial.tdeg(), l->mOrigins ));
+            }
+            if( !labeled.empty() )
+                previous = reducedBasis( previous );
+        }
+
+        replaceBasis();
+        mGB.splice( mGB.end(), previous );
+        mIsReduced = true;
+    }
+
+    template<class Coeff>
+    bool GroebnerT<Coeff>::regularReduce( PolynomialType& p, const MultivariateMonomialMR& signature, const std::list<BasisElement>& previous,
+                                          const std::vector<LabeledPolynomial>& labeled, Origins& origins ) const
+    {
+        typedef typename PolynomialType::Term Term;
+
+        PolynomialType                   rest = p;
+        // the terms which are not reducible, found in decreasing order
+        typename PolynomialType::TermSet r( p.getMonomOrder() );
+        const MonomMRCompare&            less = p.getMonomOrder();
+        MonomialDivisorIndex             previousLeading, labeledLeading;
+        std::vector<lbasis_cIt>          previousElements;
+        for( lbasis_cIt g = previous.begin(); g != previous.end(); ++g )
+        {
+            previousLeading.push_back( g->lmon() );
+            previousElements.push_back( g );
+        }
+        for( unsigned l = 0; l < labeled.size(); ++l )
+            labeledLeading.push_back( labeled[l].mPolynomial.lmon() );
+        while( !rest.isZero() )
+        {
+            MultivariateMonomialMR lm      = rest.lmon();
+            DivisorMask            lmMask  = lm.divisorMask();
+            const PolynomialType*  reducer = NULL;
+            // the polynomials of the previous generators have smaller signatures than all multiples of the current one
+            unsigned g = previousLeading.findDivisor( lm, lmMask, 0 );
+            if( g < previousLeading.size() )
+            {
+                reducer = &*previousElements[g];
+                unite( origins, previousElements[g]->mOrigins );
+            }
+            bool singular = false;
+            for( unsigned l = labeledLeading.findDivisor( lm, lmMask, 0 ); l < labeled.size() && reducer == NULL;
+                 l = labeledLeading.findDivisor( lm, lmMask, l + 1 ))
+            {
+                MultivariateMonomialMR reducerSignature = (lm / labeledLeading[l]) * labeled[l].mSignature;
+                if( less( reducerSignature, signature ))
+                {
+                    reducer = &labeled[l].mPolynomial;
+                    unite( origins, labeled[l].mOrigins );
+                }
+                else if( reducerSignature == signature )
+                    singular = true;
+            }
+            if( reducer != NULL )
+                rest = rest - reducer->multiply( Term( lm / reducer->lmon(), rest.lcoeff() / reducer->lcoeff() ));
+            else if( singular && r.empty() )
+                // a polynomial with the same signature and a smaller leading monomial is known already
+                return false;
+            else
+            {
+                r.insert( r.begin(), rest.lterm() );
+                rest = rest.truncLT();
+            }
+        }
+        p = PolynomialType( r.begin(), r.end(), p.getMonomOrder() );
+        return true;
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::insertJPairs( unsigned r, const std::list<BasisElement>& previous, const std::vector<LabeledPolynomial>& labeled,
+                                         const std::list<MultivariateMonomialMR>& syzygies, JPairQueue& jpairs ) const
+    {
+        const MonomMRCompare&         less = labeled[r].mPolynomial.getMonomOrder();
+        const MultivariateMonomialMR& lmr  = labeled[r].mPolynomial.lmon();
+        // the S-polynomial of r and a polynomial with a smaller signature has the signature of the multiple of r
+        std::list<MultivariateMonomialMR> signatures;
+        for( lbasis_cIt g = previous.begin(); g != previous.end(); ++g )
+        {
+            MultivariateMonomialMR ur = MultivariateMonomialMR::lcm( lmr, g->lmon() ) / lmr;
+            if( ur.tdeg() > 0 )
+                signatures.push_back( ur * labeled[r].mSignature );
+        }
+        // S-polynomials whose multiples have the same signature are not regular
+        for( unsigned c = 0; c < r; ++c )
+        {
+            MultivariateMonomialMR lcm = MultivariateMonomialMR::lcm( lmr, labeled[c].mPolynomial.lmon() );
+            MultivariateMonomialMR sr  = (lcm / lmr) * labeled[r].mSignature;
+            MultivariateMonomialMR sc  = (lcm / labeled[c].mPolynomial.lmon()) * labeled[c].mSignature;
+            if( less( sc, sr ))
+                signatures.push_back( sr );
+            else if( less( sr, sc ))
+                signatures.push_back( sc );
+        }
+        for( std::list<MultivariateMonomialMR>::const_iterator s = signatures.begin(); s != signatures.end(); ++s )
+        {
+            if( !isSyzygySignature( *s, previous, syzygies ))
+                jpairs.insert( *s );
+        }
+    }
+
+    template<class Coeff>
+    bool GroebnerT<Coeff>::isSyzygySignature( const MultivariateMonomialMR& signature, const std::list<BasisElement>& previous,
+                                              const std::list<MultivariateMonomialMR>& syzygies )
+    {
+        // g*e - f*e_g is a syzygy with signature lm(g)*e for every polynomial g of the previous generators
+        for( lbasis_cIt g = previous.begin(); g != previous.end(); ++g )
+        {
+            if( signature.dividable( g->lmon() ))
+                return true;
+        }
+        for( std::list<MultivariateMonomialMR>::const_iterator s = syzygies.begin(); s != syzygies.end(); ++s )
+        {
+            if( signature.dividable( *s ))
+                return true;
+        }
+        return false;
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::setPairSelectionStrategy( GroebnerSettings::PairSelectionStrategy strategy )
+    {
+        PairQueue pairs( pairsToBeChecked.begin(), pairsToBeChecked.end(), CriticalPairCompare( strategy ));
+        pairsToBeChecked.swap( pairs );
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::setThreads( unsigned threads )
+    {
+        if( threads == 0 )
+            threads = std::max<unsigned>( std::thread::hardware_concurrency(), 1 );
+        mThreads = threads;
+    }
+
+    template<class Coeff>
+    unsigned GroebnerT<Coeff>::selectionDegree( const CriticalPair& p ) const
+    {
+        return pairSelectionStrategy() == GroebnerSettings::SUGAR_PAIRSELECTIONSTRATEGY ? p.mSugar : p.mLcm.tdeg();
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::initialize()
+    {
+        mGenerators.assign( mIdeal.begin(), mIdeal.end() );
+        std::list<BasisElement> elements;
+        for( unsigned i = 0; i < mGenerators.size(); ++i )
+        {
+            Origins origins( mGenerators.size(), false );
+            origins[i] = true;
+            elements.push_back( BasisElement( mGenerators[i], mGenerators[i].tdeg(), origins ));
+        }
+        fillB( elements );
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::fillB( const std::list<BasisElement>& elements )
+    {
+        replaceBasis();
+        for( lbasis_cIt i = elements.begin(); i != elements.end(); ++i )
+        {
+            if( i->isZero() )
+                continue;
+            mGB.push_back( BasisElement( *i, i->tdeg(), i->mOrigins ));
+            update( --mGB.end() );
+        }
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::update( lbasis_It h )
+    {
+        // the pairs of h with the elements which are not redundant
+        std::list<CriticalPair> newPairs;
+        for( lbasis_cIt g = mGB.begin(); g != mGB.end(); ++g )
+        {
+            if( g != lbasis_cIt( h ) && !g->mIsRedundant )
+                newPairs.push_back( CriticalPair( g, h ));
+        }
+
+        // chain criterion among the new pairs: keep a pair only if no other lcm divides its lcm, and only one pair per lcm
+        std::list<CriticalPair> chainFree;
+        while( !newPairs.empty() )
+        {
+            CriticalPair p = newPairs.front();
+            newPairs.pop_front();
+            bool keep = p.mIsCoprime;
+            if( !keep )
+            {
+                keep = true;
+                for( typename std::list<CriticalPair>::const_iterator q = newPairs.begin(); keep && q != newPairs.end(); ++q )
+                    keep = !p.mLcm.dividable( q->mLcm );
+                for( typename std::list<CriticalPair>::const_iterator q = chainFree.begin(); keep && q != chainFree.end(); ++q )
+                    keep = !p.mLcm.dividable( q->mLcm );
+            }
+            if( keep )
+                chainFree.push_back( p );
+        }
+
+        // chain criterion for the old pairs: lm(h) divides their lcm and h forms pairs with a strictly smaller lcm
+        MultivariateMonomialMR lmh = h->lmon();
+        for( typename PairQueue::iterator p = pairsToBeChecked.begin(); p != pairsToBeChecked.end(); )
+        {
+            if( p->mLcm.dividable( lmh ) && MultivariateMonomialMR::lcm( p->mFirst->lmon(), lmh ) != p->mLcm
+                    && MultivariateMonomialMR::lcm( p->mSecond->lmon(), lmh ) != p->mLcm )
+                p = erasePair( p );
+            else
+                ++p;
+        }
+
+        // product criterion: pairs with coprime leading monomials reduce to zero
+        for( typename std::list<CriticalPair>::const_iterator p = chainFree.begin(); p != chainFree.end(); ++p )
+        {
+            if( !p->mIsCoprime )
+                insertPair( *p );
+        }
+
+        // elements whose leading monomial is divisible by lm(h) do not form new pairs
+        for( lbasis_It g = mGB.begin(); g != mGB.end(); ++g )
+        {
+            if( g != h &&!g->mIsRedundant && g->lmon().dividable( lmh ))
+                markRedundant( g );
+        }
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::push()
+    {
+        mCheckpoints.push_back( Checkpoint( mTrail.size(), mIsSolved, mIsReduced ));
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::pop() throw ( std::runtime_error )
+    {
+        if( mCheckpoints.empty() )
+            throw std::runtime_error( "There is no checkpoint to be restored." );
+        const Checkpoint& checkpoint = mCheckpoints.back();
+        while( mTrail.size() > checkpoint.mTrailSize )
+        {
+            const Change& change = mTrail.back();
+            switch( change.mKind )
+            {
+                case Change::BASIS_INSERTION:
+                    mGB.erase( change.mElement );
+                    break;
+                case Change::IDEAL_INSERTION:
+                    mIdeal.erase( change.mIdealElement );
+                    break;
+                case Change::GENERATOR_INSERTION:
+                    mGenerators.pop_back();
+                    break;
+                case Change::PAIR_INSERTION:
+                {
+                    // the pair may have been removed and inserted again in between, so it is searched by value
+                    std::pair<typename PairQueue::iterator, typename PairQueue::iterator> range = pairsToBeChecked.equal_range( change.mPair );
+                    for( typename PairQueue::iterator p = range.first; p != range.second; ++p )
+                    {
+                        if( p->mFirst == change.mPair.mFirst && p->mSecond == change.mPair.mSecond )
+                        {
+                            pairsToBeChecked.erase( p );
+                            break;
+                        }
+                    }
+                    break;
+                }
+                case Change::PAIR_REMOVAL:
+                    pairsToBeChecked.insert( change.mPair );
+                    break;
+                case Change::REDUNDANCY:
+                    change.mElement->mIsRedundant = false;
+                    break;
+                case Change::BASIS_REPLACEMENT:
+                {
+                    GroebnerSettings::PairSelectionStrategy strategy = pairSelectionStrategy();
+                    mGB.swap( mReplacedBases.back() );
+                    pairsToBeChecked.swap( mReplacedPairs.back() );
+                    mReplacedBases.pop_back();
+                    mReplacedPairs.pop_back();
+                    if( pairSelectionStrategy() != strategy )
+                        setPairSelectionStrategy( strategy );
+                    break;
+                }
+            }
+            mTrail.pop_back();
+        }
+        mIsSolved  = checkpoint.mIsSolved;
+        mIsReduced = checkpoint.mIsReduced;
+        mCheckpoints.pop_back();
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::insertPair( const CriticalPair& p )
+    {
+        pairsToBeChecked.insert( p );
+        if( !mCheckpoints.empty() )
+        {
+            mTrail.push_back( Change( Change::PAIR_INSERTION ));
+            mTrail.back().mPair = p;
+        }
+    }
+
+    template<class Coeff>
+    typename GroebnerT<Coeff>::PairQueue::iterator GroebnerT<Coeff>::erasePair( typename PairQueue::iterator p )
+    {
+        if( !mCheckpoints.empty() )
+        {
+            mTrail.push_back( Change( Change::PAIR_REMOVAL ));
+            mTrail.back().mPair = *p;
+        }
+        pairsToBeChecked.erase( p++ );
+        return p;
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::markRedundant( lbasis_It g )
+    {
+        g->mIsRedundant = true;
+        if( !mCheckpoints.empty() )
+        {
+            mTrail.push_back( Change( Change::REDUNDANCY ));
+            mTrail.back().mElement = g;
+        }
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::replaceBasis()
+    {
+        if( mCheckpoints.empty() )
+        {
+            mGB.clear();
+            pairsToBeChecked.clear();
+            return;
+        }
+        // swapping keeps the iterators stored in the trail valid
+        mReplacedBases.push_back( std::list<BasisElement>() );
+        mReplacedBases.back().swap( mGB );
+        mReplacedPairs.push_back( PairQueue( pairsToBeChecked.key_comp() ));
+        mReplacedPairs.back().swap( pairsToBeChecked );
+        mTrail.push_back( Change( Change::BASIS_REPLACEMENT ));
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::setConstantBasis( const PolynomialType& constant, const Origins& origins )
+    {
+        replaceBasis();
+        mGB.push_back( BasisElement( constant.normalized(), 0, origins ));
+        mIsSolved  = true;
+        mIsReduced = true;
+    }
+
+    template<class Coeff>
+    std::list<typename GroebnerT<Coeff>::Origins> GroebnerT<Coeff>::getOrigins() const
+    {
+        std::list<Origins> result;
+        for( lbasis_cIt g = mGB.begin(); g != mGB.end(); ++g )
+        {
+            result.push_back( g->mOrigins );
+            result.back().resize( mGenerators.size(), false );
+        }
+        return result;
+    }
+
+    template<class Coeff>
+    std::list<typename GroebnerT<Coeff>::PolynomialType> GroebnerT<Coeff>::getInfeasibleSubset( bool minimize ) const
+    {
+        std::list<PolynomialType> subset;
+        if( !isConstant() )
+            return subset;
+        const Origins& origins = mGB.begin()->mOrigins;
+        for( unsigned i = 0; i < origins.size(); ++i )
+        {
+            if( origins[i] )
+                subset.push_back( mGenerators[i] );
+        }
+        if( !minimize )
+            return subset;
+
+        // deletion filter: a generator is necessary iff the others are consistent, the explanation of an inconsistent rest
+        // can exclude further generators
+        std::list<PolynomialType> necessary;
+        while( !subset.empty() )
+        {
+            PolynomialType candidate = subset.front();
+            subset.pop_front();
+            std::list<PolynomialType> rest( necessary );
+            rest.insert( rest.end(), subset.begin(), subset.end() );
+            if( rest.empty() )
+            {
+                necessary.push_back( candidate );
+                continue;
+            }
+            GroebnerT g( rest.begin(), rest.end() );
+            g.setEngine( mEngine );
+            g.setThreads( mThreads );
+            g.setPairSelectionStrategy( pairSelectionStrategy() );
+            g.solve();
+            if( g.isConstant() )
+            {
+                subset = g.getInfeasibleSubset( false );
+                for( lpol_cIt n = necessary.begin(); n != necessary.end(); ++n )
+                    subset.remove( *n );
+            }
+            else
+                necessary.push_back( candidate );
+        }
+        return necessary;
+    }
+
+    template<class Coeff>
+    void GroebnerT<Coeff>::unite( Origins& origins, const Origins& other )
+    {
+        if( origins.size() < other.size() )
+            origins.resize( other.size(), false );
+        for( unsigned i = 0; i < other.size(); ++i )
+        {
+            if( other[i] )
+                origins[i] = true;
+        }
+    }
+
+    template<class Coeff>
+    typename GroebnerT<Coeff>::Origins GroebnerT<Coeff>::originsOf( const std::vector<bool>& used, const Origins& origins ) const
+    {
+        Origins  result = origins;
+        unsigned index  = 0;
+        for( lbasis_cIt g = mGB.begin(); g != mGB.end(); ++g, ++index )
+        {
+            if( used[index] )
+                unite( result, g->mOrigins );
+        }
+        return result;
+    }
+
+    template<class Coeff>
+    typename GroebnerT<Coeff>::Origins GroebnerT<Coeff>::originsOf( const CriticalPair& p, const std::vector<bool>& used ) const
+    {
+        Origins origins = p.mFirst->mOrigins;
+        unite( origins, p.mSecond->mOrigins );
+        return originsOf( used, origins );
+    }
+
+    /**
+     *
+     * @return true, if the GroebnerBase is not equal to the initial ideal
+     */
+    template<class Coeff>
+    bool GroebnerT<Coeff>::hasBeenReduced() const
+    {
+        if( mIdeal.size() != mGB.size() )
+            return true;
+
+        return !std::equal( mIdeal.begin(), mIdeal.end(), mGB.begin() );
+
+    }
+
+    template<class Coeff>
+    GroebnerT<Coeff>::CriticalPair::CriticalPair( lbasis_cIt first, lbasis_cIt second ):
+        mFirst( first ),
+        mSecond( second ),
+        mLcm( MultivariateMonomialMR::lcm( first->lmon(), second->lmon() ))
+    {
+        unsigned firstDeg  = first->lmon().tdeg();
+        unsigned secondDeg = second->lmon().tdeg();
+        // sugar(t*f) = deg(t) + sugar(f) for the cofactors t = lcm / lm(f)
+        mSugar     = mLcm.tdeg() + std::max( first->mSugar - firstDeg, second->mSugar - secondDeg );
+        mIsCoprime = mLcm.tdeg() == firstDeg + secondDeg;
+    }
+
+    template<class Coeff>
+    bool GroebnerT<Coeff>::CriticalPairCompare::operator ()( const CriticalPair& p1, const CriticalPair& p2 ) const
+    {
+        if( mStrategy == GroebnerSettings::SUGAR_PAIRSELECTIONSTRATEGY && p1.mSugar != p2.mSugar )
+            return p1.mSugar < p2.mSugar;
+        if( p1.mLcm.tdeg() != p2.mLcm.tdeg() )
+            return p1.mLcm.tdeg() < p2.mLcm.tdeg();
+        return p1.mFirst->getMonomOrder()( p1.mLcm, p2.mLcm );
+    }
+
+}
@@ -0,0 +1,158 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef GINACRA_INTEGERCOEFFICIENTMR_H
+#define GINACRA_INTEGERCOEFFICIENTMR_H
+
+#include <ginac/ginac.h>
+#include <cln/cln.h>
+#include <iostream>
+#include <stdexcept>
+
+namespace GiNaCRA
+{
+    /**
+     * Class encapsulating integers as coefficients of the terms.
+     *
+     * The integers do not form a field, so polynomial arithmetic over this domain is done fraction-free:
+     * S-polynomials and reductions are scaled by the leading coefficients instead of dividing by them.
+     * Division is only defined if it is exact.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     */
+    class IntegerCoefficientMR
+    {
+        public:
+            /// Polynomial algorithms have to use the fraction-free variants for this domain.
+            static const bool isField = false;
+            static const bool isOrdered = true;
+            /// The reference counting of CLN numbers is not synchronized.
+            static const bool isThreadSafe = false;
+
+            IntegerCoefficientMR():
+                mValue( 0 )
+            {}
+
+            explicit IntegerCoefficientMR( long value ):
+                mValue( value )
+            {}
+
+            explicit IntegerCoefficientMR( const cln::cl_I& value ):
+                mValue( value )
+            {}
+
+            /**
+             * @param expr an integer numeric
+             * @throws std::domain_error if the expression is no integer
+             */
+            explicit IntegerCoefficientMR( const GiNaC::ex& expr );
+
+            friend bool operator ==( const IntegerCoefficientMR& c1, const IntegerCoefficientMR& c2 )
+            {
+                return c1.mValue == c2.mValue;
+            }
+
+            friend const IntegerCoefficientMR operator *( const IntegerCoefficientMR& c1, const IntegerCoefficientMR& c2 )
+            {
+                return IntegerCoefficientMR( c1.mValue * c2.mValue );
+            }
+
+            friend const IntegerCoefficientMR operator +( const IntegerCoefficientMR& c1, const IntegerCoefficientMR& c2 )
+            {
+                return IntegerCoefficientMR( c1.mValue + c2.mValue );
+            }
+
+            friend const IntegerCoefficientMR operator -( const IntegerCoefficientMR& c1 )
+            {
+                return IntegerCoefficientMR( -c1.mValue );
+            }
+
+            friend const IntegerCoefficientMR operator -( const IntegerCoefficientMR& c1, const IntegerCoefficientMR& c2 )
+            {
+                return IntegerCoefficientMR( c1.mValue - c2.mValue );
+            }
+
+            /**
+             * Exact division.
+             * @param c1
+             * @param c2 a divisor of c1
+             * @return c1 / c2
+             */
+            friend const IntegerCoefficientMR operator /( const IntegerCoefficientMR& c1, const IntegerCoefficientMR& c2 )
+            {
+                return IntegerCoefficientMR( cln::exquo( c1.mValue, c2.mValue ));
+            }
+
+            friend std::ostream& operator <<( std::ostream& os, const IntegerCoefficientMR& c1 )
+            {
+                return os << c1.mValue;
+            }
+
+            /**
+             * @param c1
+             * @param c2
+             * @return the non-negative greatest common divisor of c1 and c2
+             */
+            static IntegerCoefficientMR gcd( const IntegerCoefficientMR& c1, const IntegerCoefficientMR& c2 )
+            {
+                return IntegerCoefficientMR( cln::gcd( c1.mValue, c2.mValue ));
+            }
+
+            inline bool isZero() const
+            {
+                return cln::zerop( mValue );
+            }
+
+            inline bool isNegative() const
+            {
+                return cln::minusp( mValue );
+            }
+
+            inline const cln::cl_I& getValue() const
+            {
+                return mValue;
+            }
+
+            inline GiNaC::ex getExpression() const
+            {
+                return GiNaC::numeric( mValue );
+            }
+
+            /**
+             * @return the multiplicative inverse of a unit
+             * @throws std::domain_error if the coefficient is not a unit
+             */
+            inline IntegerCoefficientMR inverse() const
+            {
+                if( mValue == 1 || mValue == -1 )
+                    return *this;
+                throw (std::domain_error( "Only the units 1 and -1 are invertible over the integers" ));
+            }
+
+        protected:
+            cln::cl_I mValue;
+    };
+
+}
+#endif   /** GINACRA_INTEGERCOEFFICIENTMR_H */
@@ -0,0 +1,178 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef GINACRA_JANETBASIS_H
+#define GINACRA_JANETBASIS_H
+
+#include <list>
+#include <vector>
+
+#include "MultivariatePolynomialMR.h"
+
+namespace GiNaCRA
+{
+    /**
+     * Class encapsulating the calculation of Janet bases, an alternative to GroebnerT.
+     *
+     * A Janet basis is an involutive basis with respect to Janet division: for a set U of leading monomials and
+     * u in U, the variable x_i is multiplicative for u if the exponent of x_i in u is maximal among all v in U which
+     * agree with u in the exponents of x_0, ..., x_{i-1}. Every monomial of the ideal of leading monomials is divisible
+     * by exactly one u in U using only multiplicative variables of u. Instead of the S-polynomials of all pairs, only
+     * the prolongations of each basis element by its non-multiplicative variables are reduced, each of them once.
+     * Every Janet basis is a Groebner basis. Prolongations are skipped by Gerdt's involutive versions of Buchberger's
+     * criteria, which compare the ancestors of the polynomials, i.e., the leading monomials of the basis elements they
+     * were derived from by prolongations.
+     *
+     * The algorithm processes the polynomials by increasing leading monomials and works incrementally, so further
+     * polynomials can be added to a solved basis.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     * @see Gerdt, Blinkov: Involutive bases of polynomial ideals. Math. Comput. Simul. 45(5-6), 1998
+     * @see Gerdt: Involutive algorithms for computing Groebner bases. Comput. Commut. Non-Commut. Algebr. Geom., 2005
+     * @param Coeff the coefficient domain of the polynomials, see MultivariateTermMRT
+     */
+    template<class Coeff>
+    class JanetBasisT
+    {
+        public:
+            typedef MultivariatePolynomialMRT<Coeff>                   PolynomialType;
+            typedef typename std::list<PolynomialType>::const_iterator lpol_cIt;
+
+            JanetBasisT();
+
+            /**
+             * Creates the ideal generated by the given polynomials.
+             * @param begin_generatingset
+             * @param end_generatingset
+             */
+            JanetBasisT( lpol_cIt begin_generatingset, lpol_cIt end_generatingset );
+
+            void addPolynomial( const PolynomialType& p1 );
+
+            /**
+             * Completes the basis to a Janet basis.
+             */
+            void solve();
+
+            /**
+             * @return the Janet basis, sorted by increasing leading monomials
+             */
+            std::list<PolynomialType> getBase() const;
+
+            /**
+             * @return the reduced Groebner basis of the ideal, computed from the Janet basis
+             */
+            std::list<PolynomialType> getReducedGroebnerBase() const;
+
+            /**
+             * @return how many polynomials are in the basis
+             */
+            inline unsigned size() const
+            {
+                return mBasis.size();
+            }
+
+            inline bool isConstant() const
+            {
+                return mBasis.size() == 1 && mBasis.begin()->isConstant();
+            }
+
+            inline bool isSolved() const
+            {
+                return mQueue.empty();
+            }
+
+            /**
+             * @return the number of polynomials whose involutive normal form was computed so far
+             */
+            inline unsigned nrOfReductions() const
+            {
+                return mNrOfReductions;
+            }
+
+            /**
+             * @return the number of involutive normal forms which were zero
+             */
+            inline unsigned nrOfZeroReductions() const
+            {
+                return mNrOfZeroReductions;
+            }
+
+        private:
+            /// A polynomial of the basis or of the queue together with the data of the involutive completion.
+            struct Element:
+                public PolynomialType
+            {
+                Element( const PolynomialType& p, const MultivariateMonomialMR& ancestor ):
+                    PolynomialType( p ),
+                    mLeading( p.lmon() ),
+                    mAncestor( ancestor )
+                {}
+
+                MultivariateMonomialMR mLeading;
+                /// the leading monomial of the polynomial this one was derived from by prolongations
+                MultivariateMonomialMR mAncestor;
+                /// the exponents of the leading monomial for the variables considered for the Janet division
+                std::vector<unsigned>  mExponents;
+                /// the variables which are multiplicative for the leading monomial with respect to the basis
+                std::vector<bool>      mMultiplicative;
+                /// the non-multiplicative variables for which the prolongation was queued already
+                std::vector<bool>      mProlonged;
+            };
+
+            typedef typename std::list<Element>::iterator       lelem_It;
+            typedef typename std::list<Element>::const_iterator lelem_cIt;
+
+            void updateMultiplicativeVariables();
+            void assignMultiplicativeVariables( const std::vector<Element*>& sorted, unsigned begin, unsigned end, unsigned x );
+            lelem_cIt involutiveDivisor( const MultivariateMonomialMR& m ) const;
+            bool criteria( const Element& p, const Element& g ) const;
+            static bool exponentsLess( const Element* g, const Element* h )
+            {
+                return g->mExponents < h->mExponents;
+            }
+            PolynomialType involutiveNormalForm( const PolynomialType& p ) const;
+
+            std::list<Element> mBasis;
+            std::list<Element> mQueue;
+            /// the number of variables considered for the Janet division
+            unsigned           mNrOfVariables;
+            unsigned           mNrOfReductions;
+            unsigned           mNrOfZeroReductions;
+    };
+
+    /// Janet bases over the symbolic coefficients of MultivariateCoefficientMR.
+    typedef JanetBasisT<MultivariateCoefficientMR> JanetBasis;
+    /// Janet bases over the rational numbers.
+    typedef JanetBasisT<RationalCoefficientMR> JanetBasisQ;
+    /// Janet bases over the integers, computed fraction-free.
+    typedef JanetBasisT<IntegerCoefficientMR> JanetBasisZ;
+    /// Janet bases over the prime field given by ModularCoefficientMR::modulus().
+    typedef JanetBasisT<ModularCoefficientMR> JanetBasisZp;
+
+}
+
+#include "JanetBasis.tpp"
+
+#endif   /** GINACRA_JANETBASIS_H */
@@ -0,0 +1,253 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+
+/**
+ * Implementation of the class template JanetBasisT. Included by JanetBasis.h.
+ */
+
+#include <algorithm>
+
+namespace GiNaCRA
+{
+    template<class Coeff>
+    JanetBasisT<Coeff>::JanetBasisT():
+        mNrOfVariables( 0 ),
+        mNrOfReductions( 0 ),
+        mNrOfZeroReductions( 0 )
+    {}
+
+    template<class Coeff>
+    JanetBasisT<Coeff>::JanetBasisT( lpol_cIt begin_generatingset, lpol_cIt end_generatingset ):
+        mNrOfVariables( 0 ),
+        mNrOfReductions( 0 ),
+        mNrOfZeroReductions( 0 )
+    {
+        for( lpol_cIt i = begin_generatingset; i != end_generatingset; ++i )
+            addPolynomial( *i );
+    }
+
+    template<class Coeff>
+    void JanetBasisT<Coeff>::addPolynomial( const PolynomialType& p1 )
+    {
+        if( !p1.isZero() )
+            mQueue.push_back( Element( p1, p1.lmon() ));
+    }
+
+    template<class Coeff>
+    void JanetBasisT<Coeff>::solve()
+    {
+        while( !mQueue.empty() )
+        {
+            // the polynomials are processed by increasing leading monomials
+            lelem_It p = mQueue.begin();
+            for( lelem_It q = ++mQueue.begin(); q != mQueue.end(); ++q )
+            {
+                if( PolynomialType::sortByLeadingTerm( *q, *p ))
+                    p = q;
+            }
+            Element candidate = *p;
+            mQueue.erase( p );
+
+            lelem_cIt divisor = involutiveDivisor( candidate.mLeading );
+            if( divisor != mBasis.end() && criteria( candidate, *divisor ))
+                continue;
+            ++mNrOfReductions;
+            PolynomialType h = involutiveNormalForm( candidate ).normalized();
+            if( h.isZero() )
+            {
+                ++mNrOfZeroReductions;
+                continue;
+            }
+            if( h.isConstant() )
+            {
+                mBasis.clear();
+                mQueue.clear();
+                mBasis.push_back( Element( h, h.lmon() ));
+                updateMultiplicativeVariables();
+                return;
+            }
+
+            // a polynomial with the same leading monomial keeps the ancestor and the prolongations done so far
+            MultivariateMonomialMR lmh = h.lmon();
+            Element                element( h, lmh == candidate.mLeading ? candidate.mAncestor : lmh );
+            if( lmh == candidate.mLeading )
+                element.mProlonged = candidate.mProlonged;
+
+            // the elements whose leading monomials are multiples of lm(h) are reduced again
+            for( lelem_It g = mBasis.begin(); g != mBasis.end(); )
+            {
+                if( g->mLeading.dividable( lmh ))
+                {
+                    mQueue.push_back( *g );
+                    g = mBasis.erase( g );
+                }
+                else
+                    ++g;
+            }
+            lelem_It position = mBasis.begin();
+            while( position != mBasis.end() && PolynomialType::sortByLeadingTerm( *position, h ))
+                ++position;
+            mBasis.insert( position, element );
+            updateMultiplicativeVariables();
+
+            // queue the prolongations by the non-multiplicative variables, each of them only once
+            for( lelem_It g = mBasis.begin(); g != mBasis.end(); ++g )
+            {
+                g->mProlonged.resize( mNrOfVariables, false );
+                for( unsigned x = 0; x < mNrOfVariables; ++x )
+                {
+                    if( !g->mMultiplicative[x] && !g->mProlonged[x] )
+                    {
+                        mQueue.push_back( Element( g->multiply( MultivariateMonomialMR( x, 1 )), g->mAncestor ));
+                        g->mProlonged[x] = true;
+                    }
+                }
+            }
+        }
+    }
+
+    template<class Coeff>
+    std::list<typename JanetBasisT<Coeff>::PolynomialType> JanetBasisT<Coeff>::getBase() const
+    {
+        return std::list<PolynomialType>( mBasis.begin(), mBasis.end() );
+    }
+
+    template<class Coeff>
+    std::list<typename JanetBasisT<Coeff>::PolynomialType> JanetBasisT<Coeff>::getReducedGroebnerBase() const
+    {
+        // the leading monomials of a Janet basis are distinct, the minimal basis consists of the elements whose leading
+        // monomials are not divisible by the other ones
+        std::list<PolynomialType> reduced;
+        for( lelem_cIt g = mBasis.begin(); g != mBasis.end(); ++g )
+        {
+            bool div = false;
+            for( lelem_cIt h = mBasis.begin(); h != mBasis.end() &&!div; ++h )
+                div = h != g && g->mLeading.dividable( h->mLeading );
+            // only the smaller leading monomials can divide terms of g
+            if( !div )
+                reduced.push_back( g->CalculateRemainder( reduced.begin(), reduced.end() ).normalized() );
+        }
+        return reduced;
+    }
+
+    template<class Coeff>
+    void JanetBasisT<Coeff>::updateMultiplicativeVariables()
+    {
+        mNrOfVariables = 0;
+        for( lelem_cIt g = mBasis.begin(); g != mBasis.end(); ++g )
+            mNrOfVariables = std::max( mNrOfVariables, g->mLeading.nrOfVariables() );
+
+        std::vector<Element*> sorted;
+        for( lelem_It g = mBasis.begin(); g != mBasis.end(); ++g )
+        {
+            g->mExponents.resize( mNrOfVariables );
+            for( unsigned x = 0; x < mNrOfVariables; ++x )
+                g->mExponents[x] = g->mLeading.exponentOf( x );
+            g->mMultiplicative.assign( mNrOfVariables, false );
+            sorted.push_back( &*g );
+        }
+        // lexicographic sorting of the exponent vectors makes the elements agreeing in x_0, ..., x_{i-1} contiguous
+        std::sort( sorted.begin(), sorted.end(), exponentsLess );
+        assignMultiplicativeVariables( sorted, 0, sorted.size(), 0 );
+    }
+
+    template<class Coeff>
+    void JanetBasisT<Coeff>::assignMultiplicativeVariables( const std::vector<Element*>& sorted, unsigned begin, unsigned end, unsigned x )
+    {
+        if( x == mNrOfVariables )
+            return;
+        // x is multiplicative for the elements of the range with the maximal degree in x, which are the last ones
+        unsigned maxDeg = sorted[end - 1]->mExponents[x];
+        for( unsigned i = begin; i < end; )
+        {
+            unsigned deg = sorted[i]->mExponents[x];
+            unsigned j   = i;
+            for( ; j < end && sorted[j]->mExponents[x] == deg; ++j )
+                sorted[j]->mMultiplicative[x] = deg == maxDeg;
+            assignMultiplicativeVariables( sorted, i, j, x + 1 );
+            i = j;
+        }
+    }
+
+    template<class Coeff>
+    typename JanetBasisT<Coeff>::lelem_cIt JanetBasisT<Coeff>::involutiveDivisor( const MultivariateMonomialMR& m ) const
+    {
+        std::vector<unsigned> exponents( mNrOfVariables );
+        for( unsigned x = 0; x < mNrOfVariables; ++x )
+            exponents[x] = m.exponentOf( x );
+        for( lelem_cIt g = mBasis.begin(); g != mBasis.end(); ++g )
+        {
+            // the variables beyond mNrOfVariables do not occur in any leading monomial and are multiplicative
+            bool div = true;
+            for( unsigned x = 0; x < mNrOfVariables && div; ++x )
+                div = exponents[x] == g->mExponents[x] || (exponents[x] > g->mExponents[x] && g->mMultiplicative[x]);
+            if( div )
+                return g;
+        }
+        return mBasis.end();
+    }
+
+    template<class Coeff>
+    bool JanetBasisT<Coeff>::criteria( const Element& p, const Element& g ) const
+    {
+        // C1: the ancestors are coprime and their product is the leading monomial, as in Buchberger's product criterion
+        if( p.mAncestor * g.mAncestor == p.mLeading )
+            return true;
+        // C2: the lcm of the ancestors properly divides the leading monomial
+        return MultivariateMonomialMR::lcm( p.mAncestor, g.mAncestor ).tdeg() < p.mLeading.tdeg();
+    }
+
+    template<class Coeff>
+    typename JanetBasisT<Coeff>::PolynomialType JanetBasisT<Coeff>::involutiveNormalForm( const PolynomialType& p ) const
+    {
+        typedef typename PolynomialType::Term Term;
+
+        PolynomialType rest = p;
+        PolynomialType r( p.getMonomOrder() );
+        while( !rest.isZero() )
+        {
+            MultivariateMonomialMR lm = rest.lmon();
+            lelem_cIt              g  = involutiveDivisor( lm );
+            if( g == mBasis.end() )
+            {
+                r    = r + rest.lterm();
+                rest = rest.truncLT();
+            }
+            else if( Coeff::isField )
+            {
+                rest = rest - g->multiply( Term( lm / g->mLeading, rest.lcoeff() / g->lcoeff() ));
+            }
+            else
+            {
+                // fraction-free as in MultivariatePolynomialMRT::CalculateRemainder
+                Coeff gcd   = Coeff::gcd( rest.lcoeff(), g->lcoeff() );
+                Coeff scale = g->lcoeff() / gcd;
+                rest = rest.multiply( Term( scale )) - g->multiply( Term( lm / g->mLeading, rest.lcoeff() / gcd ));
+                r    = r.multiply( Term( scale ));
+            }
+        }
+        return r;
+    }
+
+}
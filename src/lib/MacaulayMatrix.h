@@ -0,0 +1,111 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef GINACRA_MACAULAYMATRIX_H
+#define GINACRA_MACAULAYMATRIX_H
+
+#include <utility>
+#include <vector>
+
+namespace GiNaCRA
+{
+    /**
+     * A sparse Macaulay matrix as used by the F4 algorithm. The columns correspond to monomials in decreasing order, so
+     * that the leading term of a row is its first entry.
+     *
+     * The elimination is structured: every row whose leading column is not yet occupied becomes a pivot row, which
+     * is never modified. The remaining rows are reduced by the pivot rows one after another using a dense accumulator,
+     * and every non-zero result becomes a further pivot row. Only these results are returned, since their leading
+     * columns differ from the leading columns of all input rows.
+     *
+     * Every row can be labeled with a source, e.g., the polynomial it is a multiple of. The matrix keeps track of the
+     * sources of the rows which are combined into each pivot row.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     * @param Coeff a field, see MultivariateTermMRT
+     */
+    template<class Coeff>
+    class MacaulayMatrix
+    {
+        public:
+            typedef std::pair<unsigned, Coeff> Entry;
+            /// the non-zero entries of a row with strictly increasing columns
+            typedef std::vector<Entry>         Row;
+
+            /**
+             * Creates an empty matrix.
+             * @param columns the number of columns
+             * @param sources the number of different sources of the rows
+             */
+            MacaulayMatrix( unsigned columns, unsigned sources = 1 );
+
+            /**
+             * Adds a row. If no other row has the same leading column, the row becomes a pivot row.
+             * @param row non-empty row with strictly increasing columns
+             * @param source the source of the row, less than the number of sources
+             */
+            void addRow( const Row& row, unsigned source = 0 );
+
+            /**
+             * Reduces all rows which are not pivot rows.
+             * @return the non-zero reduced rows, normalized to the leading coefficient 1
+             */
+            std::vector<Row> echelonize();
+
+            inline unsigned columns() const
+            {
+                return mPivots.size();
+            }
+
+            inline unsigned rows() const
+            {
+                return mNrOfPivots + mRowsToReduce.size();
+            }
+
+            /**
+             * @param column
+             * @return a flag for each source, which is true iff a row of this source was combined into the pivot row of the column
+             */
+            inline const std::vector<bool>& sources( unsigned column ) const
+            {
+                return mPivotSources[column];
+            }
+
+        private:
+            void setPivot( const Row& row, const std::vector<bool>& sources );
+
+            /// the pivot row for each column, empty if there is none
+            std::vector<Row>                mPivots;
+            std::vector<std::vector<bool> > mPivotSources;
+            unsigned                        mNrOfPivots;
+            unsigned                        mNrOfSources;
+            std::vector<Row>                mRowsToReduce;
+            std::vector<unsigned>           mRowsToReduceSources;
+    };
+
+}
+
+#include "MacaulayMatrix.tpp"
+
+#endif   /** GINACRA_MACAULAYMATRIX_H */
@@ -0,0 +1,116 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+/**
+ * Implementation of the class template MacaulayMatrix. Included by MacaulayMatrix.h.
+ */
+
+namespace GiNaCRA
+{
+    template<class Coeff>
+    MacaulayMatrix<Coeff>::MacaulayMatrix( unsigned columns, unsigned sources ):
+        mPivots( columns ),
+        mPivotSources( columns ),
+        mNrOfPivots( 0 ),
+        mNrOfSources( sources ),
+        mRowsToReduce(),
+        mRowsToReduceSources()
+    {}
+
+    template<class Coeff>
+    void MacaulayMatrix<Coeff>::addRow( const Row& row, unsigned source )
+    {
+        if( mPivots[row.front().first].empty() )
+        {
+            std::vector<bool> sources( mNrOfSources, false );
+            sources[source] = true;
+            setPivot( row, sources );
+        }
+        else
+        {
+            mRowsToReduce.push_back( row );
+            mRowsToReduceSources.push_back( source );
+        }
+    }
+
+    template<class Coeff>
+    std::vector<typename MacaulayMatrix<Coeff>::Row> MacaulayMatrix<Coeff>::echelonize()
+    {
+        std::vector<Row>   result;
+        std::vector<Coeff> dense( mPivots.size(), Coeff( 0 ));
+        for( unsigned r = 0; r < mRowsToReduce.size(); ++r )
+        {
+            const Row&        row = mRowsToReduce[r];
+            std::vector<bool> sources( mNrOfSources, false );
+            sources[mRowsToReduceSources[r]] = true;
+            for( typename Row::const_iterator entry = row.begin(); entry != row.end(); ++entry )
+                dense[entry->first] = entry->second;
+            // eliminate from left to right, pivot rows only contribute to columns right of their leading column
+            Row reduced;
+            for( unsigned column = row.front().first; column < dense.size(); ++column )
+            {
+                if( dense[column].isZero() )
+                    continue;
+                const Row& pivot = mPivots[column];
+                if( pivot.empty() )
+                {
+                    reduced.push_back( Entry( column, dense[column] ));
+                }
+                else
+                {
+                    Coeff factor = dense[column];
+                    for( typename Row::const_iterator entry = pivot.begin() + 1; entry != pivot.end(); ++entry )
+                        dense[entry->first] = dense[entry->first] - factor * entry->second;
+                    const std::vector<bool>& pivotSources = mPivotSources[column];
+                    for( unsigned s = 0; s < mNrOfSources; ++s )
+                        sources[s] = sources[s] || pivotSources[s];
+                }
+                dense[column] = Coeff( 0 );
+            }
+            if( !reduced.empty() )
+            {
+                setPivot( reduced, sources );
+                result.push_back( mPivots[reduced.front().first] );
+            }
+        }
+        mRowsToReduce.clear();
+        mRowsToReduceSources.clear();
+        return result;
+    }
+
+    template<class Coeff>
+    void MacaulayMatrix<Coeff>::setPivot( const Row& row, const std::vector<bool>& sources )
+    {
+        Row& pivot = mPivots[row.front().first];
+        pivot      = row;
+        mPivotSources[row.front().first] = sources;
+        if( !(pivot.front().second == Coeff( 1 )))
+        {
+            Coeff lead = pivot.front().second;
+            for( typename Row::iterator entry = pivot.begin(); entry != pivot.end(); ++entry )
+                entry->second = entry->second / lead;
+        }
+        ++mNrOfPivots;
+    }
+
+}
@@ -0,0 +1,83 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#include "ModularCoefficientMR.h"
+
+namespace GiNaCRA
+{
+    __thread unsigned ModularCoefficientMR::mModulus = 2147483647;
+
+    ModularCoefficientMR::ModularCoefficientMR( const RationalCoefficientMR& c ):
+        mValue( reduce( cln::numerator( c.getValue() )))
+    {
+        unsigned denominator = reduce( cln::denominator( c.getValue() ));
+        if( denominator == 0 )
+            throw (std::domain_error( "The denominator vanishes modulo the current prime" ));
+        if( denominator != 1 )
+            mValue = (*this / fromValue( denominator )).mValue;
+    }
+
+    ModularCoefficientMR::ModularCoefficientMR( const GiNaC::ex& expr ):
+        mValue( 0 )
+    {
+        mValue = ModularCoefficientMR( RationalCoefficientMR( expr )).mValue;
+    }
+
+    void ModularCoefficientMR::setModulus( unsigned p )
+    {
+        if( p < 2 || p >= 2147483648u )
+            throw (std::invalid_argument( "The modulus has to be a prime below 2^31" ));
+        mModulus = p;
+    }
+
+    ModularCoefficientMR ModularCoefficientMR::inverse() const
+    {
+        if( mValue == 0 )
+            throw (std::domain_error( "Zero is not invertible" ));
+        long r0 = mModulus, r1 = mValue;
+        long s0 = 0, s1 = 1;
+        while( r1 != 0 )
+        {
+            long q = r0 / r1;
+            long r = r0 - q * r1;
+            r0     = r1;
+            r1     = r;
+            long s = s0 - q * s1;
+            s0     = s1;
+            s1     = s;
+        }
+        // r0 == 1 since the modulus is prime
+        return fromValue( (unsigned)(s0 < 0 ? s0 + (long)mModulus : s0 ));
+    }
+
+    unsigned ModularCoefficientMR::reduce( long value )
+    {
+        long r = value % (long)mModulus;
+        return (unsigned)(r < 0 ? r + (long)mModulus : r);
+    }
+
+    unsigned ModularCoefficientMR::reduce( const cln::cl_I& value )
+    {
+        return (unsigned)cln::cl_I_to_long( cln::mod( value, cln::cl_I( (long)mModulus )));
+    }
+}
@@ -0,0 +1,207 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef GINACRA_MODULARCOEFFICIENTMR_H
+#define GINACRA_MODULARCOEFFICIENTMR_H
+
+#include <ginac/ginac.h>
+#include <cln/cln.h>
+#include <iostream>
+#include <stdexcept>
+
+#include "IntegerCoefficientMR.h"
+#include "RationalCoefficientMR.h"
+
+namespace GiNaCRA
+{
+    /**
+     * Class encapsulating elements of the prime field Z/pZ as coefficients of the terms.
+     *
+     * The elements are stored as machine words in the range [0, p). The modulus p is shared by all objects of this
+     * class used by one thread and must be a prime below 2^31, so that every product fits into 64 bits. Changing the
+     * modulus invalidates all existing objects of the thread. Each thread has its own modulus, so computations modulo
+     * different primes may run concurrently.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     */
+    class ModularCoefficientMR
+    {
+        public:
+            static const bool isField = true;
+            /// There is no ordering of Z/pZ compatible with the arithmetic, isNegative() is always false.
+            static const bool isOrdered = false;
+            /// Copies share no data, so different threads may compute with different objects after adopting the same modulus (see ThreadState).
+            static const bool isThreadSafe = true;
+            /// The state a thread has to adopt for computing with the objects of another thread, i.e., the modulus.
+            typedef unsigned ThreadState;
+
+            ModularCoefficientMR():
+                mValue( 0 )
+            {}
+
+            explicit ModularCoefficientMR( long value ):
+                mValue( reduce( value ))
+            {}
+
+            explicit ModularCoefficientMR( const cln::cl_I& value ):
+                mValue( reduce( value ))
+            {}
+
+            explicit ModularCoefficientMR( const IntegerCoefficientMR& c ):
+                mValue( reduce( c.getValue() ))
+            {}
+
+            /**
+             * @param c
+             * @throws std::domain_error if the denominator of c vanishes modulo p
+             */
+            explicit ModularCoefficientMR( const RationalCoefficientMR& c );
+
+            /**
+             * @param expr a rational numeric
+             * @throws std::domain_error if the expression is no rational number or its denominator vanishes modulo p
+             */
+            explicit ModularCoefficientMR( const GiNaC::ex& expr );
+
+            /**
+             * Sets the modulus for all modular coefficients of the calling thread.
+             * @param p a prime below 2^31
+             * @throws std::invalid_argument if p is out of range
+             */
+            static void setModulus( unsigned p );
+
+            inline static unsigned modulus()
+            {
+                return mModulus;
+            }
+
+            inline static ThreadState threadState()
+            {
+                return mModulus;
+            }
+
+            inline static void setThreadState( ThreadState state )
+            {
+                mModulus = state;
+            }
+
+            friend bool operator ==( const ModularCoefficientMR& c1, const ModularCoefficientMR& c2 )
+            {
+                return c1.mValue == c2.mValue;
+            }
+
+            friend const ModularCoefficientMR operator *( const ModularCoefficientMR& c1, const ModularCoefficientMR& c2 )
+            {
+                return fromValue( (unsigned)(((unsigned long long)c1.mValue * c2.mValue) % mModulus ));
+            }
+
+            friend const ModularCoefficientMR operator +( const ModularCoefficientMR& c1, const ModularCoefficientMR& c2 )
+            {
+                unsigned sum = c1.mValue + c2.mValue;
+                return fromValue( sum >= mModulus ? sum - mModulus : sum );
+            }
+
+            friend const ModularCoefficientMR operator -( const ModularCoefficientMR& c1 )
+            {
+                return fromValue( c1.mValue == 0 ? 0 : mModulus - c1.mValue );
+            }
+
+            friend const ModularCoefficientMR operator -( const ModularCoefficientMR& c1, const ModularCoefficientMR& c2 )
+            {
+                return fromValue( c1.mValue >= c2.mValue ? c1.mValue - c2.mValue : c1.mValue + mModulus - c2.mValue );
+            }
+
+            friend const ModularCoefficientMR operator /( const ModularCoefficientMR& c1, const ModularCoefficientMR& c2 )
+            {
+                return c1 * c2.inverse();
+            }
+
+            friend std::ostream& operator <<( std::ostream& os, const ModularCoefficientMR& c1 )
+            {
+                return os << c1.mValue;
+            }
+
+            /**
+             * @param c1
+             * @param c2
+             * @return 1 unless both coefficients are zero
+             */
+            static ModularCoefficientMR gcd( const ModularCoefficientMR& c1, const ModularCoefficientMR& c2 )
+            {
+                return fromValue( c1.isZero() && c2.isZero() ? 0 : 1 );
+            }
+
+            inline bool isZero() const
+            {
+                return mValue == 0;
+            }
+
+            /**
+             * @return false, as there is no compatible ordering on Z/pZ
+             */
+            inline bool isNegative() const
+            {
+                return false;
+            }
+
+            inline unsigned getValue() const
+            {
+                return mValue;
+            }
+
+            /**
+             * @return the representative in [0, p) as numeric
+             */
+            inline GiNaC::ex getExpression() const
+            {
+                return GiNaC::numeric( (long)mValue );
+            }
+
+            /**
+             * @return the multiplicative inverse computed by the extended Euclidean algorithm
+             * @throws std::domain_error if the coefficient is zero
+             */
+            ModularCoefficientMR inverse() const;
+
+            /**
+             * @param value
+             * @return the coefficient with the given representative, which must be in the range [0, p)
+             */
+            inline static ModularCoefficientMR fromValue( unsigned value )
+            {
+                ModularCoefficientMR c;
+                c.mValue = value;
+                return c;
+            }
+
+        protected:
+            static unsigned reduce( long value );
+            static unsigned reduce( const cln::cl_I& value );
+
+            unsigned                 mValue;
+            static __thread unsigned mModulus;
+    };
+
+}
+#endif   /** GINACRA_MODULARCOEFFICIENTMR_H */
@@ -0,0 +1,728 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+
+
+#include <algorithm>
+
+#include "ModularGcd.h"
+#include "ModularGroebner.h"
+#include "utilities.h"
+
+using GiNaC::numeric;
+using GiNaC::is_a;
+using GiNaC::is_exactly_a;
+using GiNaC::ex_to;
+
+namespace GiNaCRA
+{
+    const ex ModularGcd::gcd( const ex& a, const ex& b )
+    {
+        std::set<ex, GiNaC::ex_is_less> symbols;
+        collectSymbols( a, symbols );
+        collectSymbols( b, symbols );
+        vector<symbol> variables;
+        for( std::set<ex, GiNaC::ex_is_less>::const_iterator s = symbols.begin(); s != symbols.end(); ++s )
+            variables.push_back( ex_to<symbol>( *s ));
+        IntegerPolynomial     aPolynomial, bPolynomial;
+        std::vector<unsigned> exponents = std::vector<unsigned>( variables.size(), 0 );
+        if( variables.empty() ||!decompose( a.expand(), variables, 0, exponents, aPolynomial )
+                ||!decompose( b.expand(), variables, 0, exponents, bPolynomial ))
+            return GiNaC::gcd( a, b );
+        IntegerPolynomial result = gcd( aPolynomial, bPolynomial );
+        if( result.empty() && !(aPolynomial.empty() && bPolynomial.empty()) )
+            return GiNaC::gcd( a, b );
+        return expression( result, variables );
+    }
+
+    const ex ModularGcd::content( const ex& p, const symbol& x )
+    {
+        ex e = p.expand();
+        if( e.is_zero() )
+            return 0;
+        if( is_exactly_a<numeric>( e ))
+            return GiNaC::abs( ex_to<numeric>( e ));
+        // the integer content is cheap; if the leading coefficient of the rest is an integer, we are done
+        numeric c      = e.integer_content();
+        ex      r      = (e / c).expand();
+        int     deg    = r.degree( x );
+        int     ldeg   = r.ldegree( x );
+        ex      lcoeff = r.coeff( x, deg );
+        if( is_exactly_a<numeric>( lcoeff ) && ex_to<numeric>( lcoeff ).is_integer() )
+            return c;
+        if( deg == ldeg )
+            return lcoeff * c / lcoeff.unit( x );
+        ex result = 0;
+        for( int i = ldeg; i <= deg; ++i )
+            result = gcd( r.coeff( x, i ), result );
+        return result * c;
+    }
+
+    const ModularGcd::IntegerPolynomial ModularGcd::gcd( const IntegerPolynomial& a, const IntegerPolynomial& b )
+    {
+        if( a.empty() || b.empty() )
+        {
+            IntegerPolynomial result = a.empty() ? b : a;
+            if( !result.empty() && cln::minusp( result.rbegin()->second ))
+                for( IntegerPolynomial::iterator t = result.begin(); t != result.end(); ++t )
+                    t->second = -t->second;
+            return result;
+        }
+        // the gcd of a and b is c times the gcd of their primitive parts
+        cln::cl_I         aContent   = integerContent( a );
+        cln::cl_I         bContent   = integerContent( b );
+        cln::cl_I         c          = cln::gcd( aContent, bContent );
+        IntegerPolynomial aPrimitive = IntegerPolynomial();
+        IntegerPolynomial bPrimitive = IntegerPolynomial();
+        for( IntegerPolynomial::const_iterator t = a.begin(); t != a.end(); ++t )
+            aPrimitive[t->first] = cln::exquo( t->second, aContent );
+        for( IntegerPolynomial::const_iterator t = b.begin(); t != b.end(); ++t )
+            bPrimitive[t->first] = cln::exquo( t->second, bContent );
+        unsigned          nrOfVariables = a.begin()->first.size();
+        IntegerPolynomial constant      = IntegerPolynomial();
+        constant[std::vector<unsigned>( nrOfVariables, 0 )] = c;
+        if( isConstant( aPrimitive.rbegin()->first ) || isConstant( bPrimitive.rbegin()->first ))
+            return constant;
+
+        // every image is scaled such that its leading coefficient is the gcd of the leading coefficients of a and b
+        cln::cl_I                           aLeading   = aPrimitive.rbegin()->second;
+        cln::cl_I                           bLeading   = bPrimitive.rbegin()->second;
+        cln::cl_I                           leading    = cln::gcd( aLeading, bLeading );
+        IntegerPolynomial                   image      = IntegerPolynomial();    // residues modulo modulus
+        IntegerPolynomial                   lifted     = IntegerPolynomial();    // the same in the symmetric range
+        cln::cl_I                           modulus    = 1;
+        std::vector<std::vector<unsigned> > skeleton;    // monomials of the current image
+        bool                                useSparse  = true;
+        unsigned                            prime      = 2147483648u;    // start with the largest primes below 2^31
+        while( (prime = ModularGroebner::previousPrime( prime )) != 0 )
+        {
+            cln::cl_I bigPrime = cln::cl_I( prime );
+            if( cln::zerop( cln::mod( aLeading, bigPrime )) || cln::zerop( cln::mod( bLeading, bigPrime )))
+                continue;
+            ModularPolynomial aImage       = reduce( aPrimitive, prime );
+            ModularPolynomial bImage       = reduce( bPrimitive, prime );
+            unsigned          leadingImage = cln::cl_I_to_UL( cln::mod( leading, bigPrime ));
+            ModularPolynomial gcdImage;
+            if( !useSparse || skeleton.empty() ||!sparseGcd( aImage, bImage, skeleton, leadingImage, prime, gcdImage ))
+            {
+                gcdImage = denseGcd( aImage, bImage, nrOfVariables, prime );
+                if( gcdImage.empty() )
+                    continue;
+                for( ModularPolynomial::iterator t = gcdImage.begin(); t != gcdImage.end(); ++t )
+                    t->second = (unsigned)(((unsigned long long)t->second * leadingImage) % prime);
+            }
+            const std::vector<unsigned>& leadingMonomial = gcdImage.rbegin()->first;
+            if( isConstant( leadingMonomial ))
+                return constant;
+            if( skeleton.empty() || leadingMonomial < skeleton.back() )
+            {
+                // first image, or all previous primes were unlucky
+                image.clear();
+                skeleton.clear();
+                for( ModularPolynomial::const_iterator t = gcdImage.begin(); t != gcdImage.end(); ++t )
+                {
+                    image[t->first] = cln::cl_I( t->second );
+                    skeleton.push_back( t->first );
+                }
+                modulus = bigPrime;
+                lifted  = symmetric( image, modulus );
+                continue;
+            }
+            if( skeleton.back() < leadingMonomial )
+                continue;    // unlucky prime
+            for( ModularPolynomial::const_iterator t = gcdImage.begin(); t != gcdImage.end(); ++t )
+                if( image.find( t->first ) == image.end() )
+                    image[t->first] = 0;
+            for( IntegerPolynomial::iterator t = image.begin(); t != image.end(); ++t )
+            {
+                ModularPolynomial::const_iterator residue = gcdImage.find( t->first );
+                t->second = GiNaC::chineseRemainder( t->second, modulus, residue == gcdImage.end() ? 0 : residue->second, bigPrime );
+            }
+            modulus = modulus * bigPrime;
+            IntegerPolynomial next = symmetric( image, modulus );
+            if( !(next == lifted) )
+            {
+                lifted = next;
+                continue;
+            }
+            // the image did not change by the last prime, so it is probably the scaled gcd
+            cln::cl_I         liftedContent = integerContent( lifted );
+            IntegerPolynomial candidate     = IntegerPolynomial();
+            for( IntegerPolynomial::const_iterator t = lifted.begin(); t != lifted.end(); ++t )
+                candidate[t->first] = cln::exquo( t->second, liftedContent );
+            if( divides( aPrimitive, candidate ) && divides( bPrimitive, candidate ))
+            {
+                bool negate = cln::minusp( candidate.rbegin()->second );
+                for( IntegerPolynomial::iterator t = candidate.begin(); t != candidate.end(); ++t )
+                    t->second = negate ? -t->second * c : t->second * c;
+                return candidate;
+            }
+            if( useSparse )
+            {
+                // a sparse image might have been wrong: start over with dense images only
+                useSparse = false;
+                skeleton.clear();
+            }
+        }
+        return IntegerPolynomial();
+    }
+
+    const ModularGcd::ModularPolynomial ModularGcd::denseGcd( const ModularPolynomial& a,
+                                                              const ModularPolynomial& b,
+                                                              unsigned nrOfVariables,
+                                                              unsigned p )
+    {
+        if( a.empty() || b.empty() )
+        {
+            ModularPolynomial result = a.empty() ? b : a;
+            makeMonic( result, p );
+            return result;
+        }
+        if( nrOfVariables == 1 )
+        {
+            CoefficientMap result = coefficients( a, 0 );
+            result.begin()->second = univariateGcd( result.begin()->second, coefficients( b, 0 ).begin()->second, p );
+            return combine( result, 0 );
+        }
+        // view a and b as polynomials in the variables before v with coefficients in Z/pZ[v]
+        unsigned       v             = nrOfVariables - 1;
+        CoefficientMap aCoefficients = coefficients( a, v );
+        CoefficientMap bCoefficients = coefficients( b, v );
+        Univariate     aContent      = univariateContent( aCoefficients, p );
+        Univariate     bContent      = univariateContent( bCoefficients, p );
+        Univariate     c             = univariateGcd( aContent, bContent, p );
+        unsigned       aDegree       = 0;
+        unsigned       bDegree       = 0;
+        for( CoefficientMap::iterator i = aCoefficients.begin(); i != aCoefficients.end(); ++i )
+        {
+            i->second = univariateQuotient( i->second, aContent, p );
+            aDegree   = std::max( aDegree, (unsigned)i->second.size() - 1 );
+        }
+        for( CoefficientMap::iterator i = bCoefficients.begin(); i != bCoefficients.end(); ++i )
+        {
+            i->second = univariateQuotient( i->second, bContent, p );
+            bDegree   = std::max( bDegree, (unsigned)i->second.size() - 1 );
+        }
+        ModularPolynomial aPrimitive = combine( aCoefficients, v );
+        ModularPolynomial bPrimitive = combine( bCoefficients, v );
+        // the images are scaled to the leading coefficient g(alpha)
+        Univariate g     = univariateGcd( aCoefficients.rbegin()->second, bCoefficients.rbegin()->second, p );
+        unsigned   bound = g.size() - 1 + std::min( aDegree, bDegree );
+
+        ModularPolynomial     interpolant = ModularPolynomial();
+        Univariate            q           = Univariate( 1, 1 );    // product of the x_v - alpha of the points used
+        std::vector<unsigned> leadingMonomial;
+        unsigned              nrOfPoints  = 0;
+        for( unsigned alpha = 0; alpha < p; ++alpha )
+        {
+            unsigned long long gAlpha = univariateEvaluate( g, alpha, p );
+            if( gAlpha == 0 )
+                continue;
+            ModularPolynomial image = denseGcd( evaluate( aPrimitive, v, alpha, p ), evaluate( bPrimitive, v, alpha, p ), v, p );
+            if( image.empty() )
+                continue;
+            if( isConstant( image.rbegin()->first ))
+            {
+                CoefficientMap content = CoefficientMap();
+                content[image.rbegin()->first] = c;
+                ModularPolynomial result = combine( content, v );
+                makeMonic( result, p );
+                return result;
+            }
+            for( ModularPolynomial::iterator t = image.begin(); t != image.end(); ++t )
+                t->second = (unsigned)((t->second * gAlpha) % p);
+            Univariate linear = Univariate( 2, 1 );
+            linear[0] = (p - alpha) % p;
+            if( nrOfPoints == 0 || image.rbegin()->first < leadingMonomial )
+            {
+                // first point, or all previous points were unlucky
+                interpolant     = image;
+                q               = linear;
+                leadingMonomial = image.rbegin()->first;
+                nrOfPoints      = 1;
+            }
+            else if( leadingMonomial < image.rbegin()->first )
+                continue;    // unlucky point
+            else
+            {
+                // Newton interpolation: add (image - interpolant(alpha)) / q(alpha) * q
+                ModularPolynomial difference = image;
+                ModularPolynomial value      = evaluate( interpolant, v, alpha, p );
+                for( ModularPolynomial::const_iterator t = value.begin(); t != value.end(); ++t )
+                    difference[t->first] = (difference[t->first] + p - t->second) % p;
+                unsigned long long factor = inverse( univariateEvaluate( q, alpha, p ), p );
+                for( ModularPolynomial::const_iterator t = difference.begin(); t != difference.end(); ++t )
+                {
+                    std::vector<unsigned> monomial = t->first;
+                    unsigned long long    scaled   = (t->second * factor) % p;
+                    for( unsigned i = 0; scaled != 0 && i < q.size(); ++i )
+                    {
+                        monomial[v] = i;
+                        unsigned sum = (unsigned)((interpolant[monomial] + scaled * q[i]) % p);
+                        if( sum == 0 )
+                            interpolant.erase( monomial );
+                        else
+                            interpolant[monomial] = sum;
+                    }
+                }
+                q = univariateMultiply( q, linear, p );
+                ++nrOfPoints;
+            }
+            if( nrOfPoints > bound )
+            {
+                // enough points for the degree bound: the primitive part of the interpolant is the gcd if it divides a and b
+                CoefficientMap candidateCoefficients = coefficients( interpolant, v );
+                Univariate     candidateContent      = univariateContent( candidateCoefficients, p );
+                for( CoefficientMap::iterator i = candidateCoefficients.begin(); i != candidateCoefficients.end(); ++i )
+                    i->second = univariateQuotient( i->second, candidateContent, p );
+                ModularPolynomial candidate = combine( candidateCoefficients, v );
+                if( divides( aPrimitive, candidate, p ) && divides( bPrimitive, candidate, p ))
+                {
+                    for( CoefficientMap::iterator i = candidateCoefficients.begin(); i != candidateCoefficients.end(); ++i )
+                        i->second = univariateMultiply( i->second, c, p );
+                    ModularPolynomial result = combine( candidateCoefficients, v );
+                    makeMonic( result, p );
+                    return result;
+                }
+            }
+        }
+        return ModularPolynomial();
+    }
+
+    bool ModularGcd::sparseGcd( const ModularPolynomial& a,
+                                const ModularPolynomial& b,
+                                const std::vector<std::vector<unsigned> >& skeleton,
+                                unsigned lead,
+                                unsigned p,
+                                ModularPolynomial& result )
+    {
+        unsigned                     nrOfVariables  = skeleton.back().size();
+        unsigned                     degree         = 0;    // in the first variable
+        std::map<unsigned, unsigned> termsPerDegree = std::map<unsigned, unsigned>();
+        unsigned                     maxTerms       = 0;
+        for( std::vector<std::vector<unsigned> >::const_iterator s = skeleton.begin(); s != skeleton.end(); ++s )
+        {
+            degree   = std::max( degree, (*s)[0] );
+            maxTerms = std::max( maxTerms, ++termsPerDegree[(*s)[0]] );
+        }
+        if( nrOfVariables < 2 || degree == 0 )
+            return false;
+        // enough points such that every coefficient of the first variable and the scaling are determined
+        unsigned nrOfPoints   = std::max( maxTerms + 1, (unsigned)(skeleton.size() + degree - 1) / degree + 1 );
+        unsigned nrOfUnknowns = skeleton.size() + nrOfPoints;
+
+        // unknowns: the coefficients of the skeleton, then the factors m_j with gcd(a, b)(x, point_j) = m_j * monic univariate gcd
+        std::vector<std::vector<unsigned> > system;
+        unsigned long long                  seed = p;
+        for( unsigned j = 0; j < nrOfPoints; ++j )
+        {
+            std::vector<unsigned> point = std::vector<unsigned>( nrOfVariables, 0 );
+            for( unsigned k = 1; k < nrOfVariables; ++k )
+            {
+                seed     = seed * 6364136223846793005ull + 1442695040888963407ull;
+                point[k] = 1 + (unsigned)((seed >> 33) % (p - 1));
+            }
+            Univariate g = univariateGcd( evaluate( a, point, p ), evaluate( b, point, p ), p );
+            if( g.size() != degree + 1 )
+                return false;    // unlucky point or wrong skeleton
+            for( unsigned d = 0; d <= degree; ++d )
+            {
+                std::vector<unsigned> row = std::vector<unsigned>( nrOfUnknowns + 1, 0 );
+                for( unsigned i = 0; i < skeleton.size(); ++i )
+                {
+                    if( skeleton[i][0] != d )
+                        continue;
+                    unsigned long long value = 1;
+                    for( unsigned k = 1; k < nrOfVariables; ++k )
+                        value = (value * power( point[k], skeleton[i][k], p )) % p;
+                    row[i] = (unsigned)value;
+                }
+                row[skeleton.size() + j] = (p - g[d]) % p;
+                system.push_back( row );
+            }
+        }
+        // normalization of the leading coefficient
+        std::vector<unsigned> row = std::vector<unsigned>( nrOfUnknowns + 1, 0 );
+        row[skeleton.size() - 1] = 1;
+        row[nrOfUnknowns]        = lead;
+        system.push_back( row );
+
+        std::vector<unsigned> solution;
+        if( !solve( system, nrOfUnknowns, p, solution ))
+            return false;
+        result.clear();
+        for( unsigned i = 0; i < skeleton.size(); ++i )
+            if( solution[i] != 0 )
+                result[skeleton[i]] = solution[i];
+        return !result.empty() && result.rbegin()->first == skeleton.back();
+    }
+
+    ///////////////////////
+    // Auxiliary Methods //
+    ///////////////////////
+
+    void ModularGcd::collectSymbols( const ex& p, std::set<ex, GiNaC::ex_is_less>& symbols )
+    {
+        if( is_a<symbol>( p ))
+            symbols.insert( p );
+        else
+            for( size_t i = 0; i < p.nops(); ++i )
+                collectSymbols( p.op( i ), symbols );
+    }
+
+    bool ModularGcd::decompose( const ex& p, const vector<symbol>& variables, unsigned k, std::vector<unsigned>& exponents, IntegerPolynomial& result )
+    {
+        if( k == variables.size() )
+        {
+            if( !is_exactly_a<numeric>( p ) ||!ex_to<numeric>( p ).is_integer() )
+                return false;
+            if( !ex_to<numeric>( p ).is_zero() )
+                result[exponents] = cln::the<cln::cl_I>( ex_to<numeric>( p ).to_cl_N() );
+            return true;
+        }
+        if( p.ldegree( variables[k] ) < 0 )
+            return false;
+        for( int d = 0; d <= p.degree( variables[k] ); ++d )
+        {
+            exponents[k] = d;
+            if( !decompose( p.coeff( variables[k], d ), variables, k + 1, exponents, result ))
+                return false;
+        }
+        exponents[k] = 0;
+        return true;
+    }
+
+    const ex ModularGcd::expression( const IntegerPolynomial& p, const vector<symbol>& variables )
+    {
+        ex result = 0;
+        for( IntegerPolynomial::const_iterator t = p.begin(); t != p.end(); ++t )
+        {
+            ex monomial = numeric( t->second );
+            for( unsigned k = 0; k < variables.size(); ++k )
+                monomial *= GiNaC::pow( variables[k], t->first[k] );
+            result += monomial;
+        }
+        return result;
+    }
+
+    const cln::cl_I ModularGcd::integerContent( const IntegerPolynomial& a )
+    {
+        cln::cl_I result = 0;
+        for( IntegerPolynomial::const_iterator t = a.begin(); t != a.end(); ++t )
+            result = cln::gcd( result, t->second );
+        return result;
+    }
+
+    bool ModularGcd::divides( const IntegerPolynomial& a, const IntegerPolynomial& b )
+    {
+        // division by the leading terms of b, which have to divide the leading terms of the remainder
+        IntegerPolynomial                   r       = a;
+        const std::vector<unsigned>&        bLeader = b.rbegin()->first;
+        while( !r.empty() )
+        {
+            std::vector<unsigned> shift = r.rbegin()->first;
+            for( unsigned k = 0; k < shift.size(); ++k )
+            {
+                if( shift[k] < bLeader[k] )
+                    return false;
+                shift[k] -= bLeader[k];
+            }
+            if( !cln::zerop( cln::mod( r.rbegin()->second, b.rbegin()->second )))
+                return false;
+            cln::cl_I factor = cln::exquo( r.rbegin()->second, b.rbegin()->second );
+            for( IntegerPolynomial::const_iterator t = b.begin(); t != b.end(); ++t )
+            {
+                std::vector<unsigned> monomial = t->first;
+                for( unsigned k = 0; k < monomial.size(); ++k )
+                    monomial[k] += shift[k];
+                cln::cl_I difference = r[monomial] - factor * t->second;
+                if( cln::zerop( difference ))
+                    r.erase( monomial );
+                else
+                    r[monomial] = difference;
+            }
+        }
+        return true;
+    }
+
+    const ModularGcd::IntegerPolynomial ModularGcd::symmetric( const IntegerPolynomial& a, const cln::cl_I& modulus )
+    {
+        cln::cl_I         halfModulus = cln::floor1( modulus, 2 );
+        IntegerPolynomial result      = IntegerPolynomial();
+        for( IntegerPolynomial::const_iterator t = a.begin(); t != a.end(); ++t )
+            if( !cln::zerop( t->second ))
+                result[t->first] = t->second > halfModulus ? t->second - modulus : t->second;
+        return result;
+    }
+
+    const ModularGcd::ModularPolynomial ModularGcd::reduce( const IntegerPolynomial& a, unsigned p )
+    {
+        ModularPolynomial result = ModularPolynomial();
+        for( IntegerPolynomial::const_iterator t = a.begin(); t != a.end(); ++t )
+        {
+            unsigned c = cln::cl_I_to_UL( cln::mod( t->second, cln::cl_I( p )));
+            if( c != 0 )
+                result[t->first] = c;
+        }
+        return result;
+    }
+
+    const ModularGcd::CoefficientMap ModularGcd::coefficients( const ModularPolynomial& a, unsigned v )
+    {
+        CoefficientMap result = CoefficientMap();
+        for( ModularPolynomial::const_iterator t = a.begin(); t != a.end(); ++t )
+        {
+            std::vector<unsigned> monomial = t->first;
+            unsigned              e        = monomial[v];
+            monomial[v] = 0;
+            Univariate& c = result[monomial];
+            if( c.size() <= e )
+                c.resize( e + 1, 0 );
+            c[e] = t->second;
+        }
+        return result;
+    }
+
+    const ModularGcd::ModularPolynomial ModularGcd::combine( const CoefficientMap& c, unsigned v )
+    {
+        ModularPolynomial result = ModularPolynomial();
+        for( CoefficientMap::const_iterator i = c.begin(); i != c.end(); ++i )
+        {
+            std::vector<unsigned> monomial = i->first;
+            for( unsigned e = 0; e < i->second.size(); ++e )
+            {
+                if( i->second[e] == 0 )
+                    continue;
+                monomial[v]      = e;
+                result[monomial] = i->second[e];
+            }
+        }
+        return result;
+    }
+
+    const ModularGcd::ModularPolynomial ModularGcd::evaluate( const ModularPolynomial& a, unsigned v, unsigned alpha, unsigned p )
+    {
+        ModularPolynomial result = ModularPolynomial();
+        for( ModularPolynomial::const_iterator t = a.begin(); t != a.end(); ++t )
+        {
+            std::vector<unsigned> monomial = t->first;
+            unsigned long long    value    = ((unsigned long long)t->second * power( alpha, monomial[v], p )) % p;
+            monomial[v] = 0;
+            value       = (result[monomial] + value) % p;
+            if( value == 0 )
+                result.erase( monomial );
+            else
+                result[monomial] = (unsigned)value;
+        }
+        return result;
+    }
+
+    const ModularGcd::Univariate ModularGcd::evaluate( const ModularPolynomial& a, const std::vector<unsigned>& point, unsigned p )
+    {
+        // all variables but the first are specialized
+        Univariate result = Univariate();
+        for( ModularPolynomial::const_iterator t = a.begin(); t != a.end(); ++t )
+        {
+            unsigned long long value = t->second;
+            for( unsigned k = 1; k < point.size(); ++k )
+                value = (value * power( point[k], t->first[k], p )) % p;
+            if( result.size() <= t->first[0] )
+                result.resize( t->first[0] + 1, 0 );
+            result[t->first[0]] = (unsigned)((result[t->first[0]] + value) % p);
+        }
+        while( !result.empty() && result.back() == 0 )
+            result.pop_back();
+        return result;
+    }
+
+    void ModularGcd::makeMonic( ModularPolynomial& a, unsigned p )
+    {
+        if( a.empty() )
+            return;
+        unsigned long long leadingInverse = inverse( a.rbegin()->second, p );
+        for( ModularPolynomial::iterator t = a.begin(); t != a.end(); ++t )
+            t->second = (unsigned)((t->second * leadingInverse) % p);
+    }
+
+    bool ModularGcd::divides( const ModularPolynomial& a, const ModularPolynomial& b, unsigned p )
+    {
+        ModularPolynomial            r              = a;
+        const std::vector<unsigned>& bLeader        = b.rbegin()->first;
+        unsigned long long           leadingInverse = inverse( b.rbegin()->second, p );
+        while( !r.empty() )
+        {
+            std::vector<unsigned> shift = r.rbegin()->first;
+            for( unsigned k = 0; k < shift.size(); ++k )
+            {
+                if( shift[k] < bLeader[k] )
+                    return false;
+                shift[k] -= bLeader[k];
+            }
+            unsigned long long factor = (r.rbegin()->second * leadingInverse) % p;
+            for( ModularPolynomial::const_iterator t = b.begin(); t != b.end(); ++t )
+            {
+                std::vector<unsigned> monomial = t->first;
+                for( unsigned k = 0; k < monomial.size(); ++k )
+                    monomial[k] += shift[k];
+                unsigned difference = (unsigned)((r[monomial] + p - (factor * t->second) % p) % p);
+                if( difference == 0 )
+                    r.erase( monomial );
+                else
+                    r[monomial] = difference;
+            }
+        }
+        return true;
+    }
+
+    bool ModularGcd::isConstant( const std::vector<unsigned>& monomial )
+    {
+        for( std::vector<unsigned>::const_iterator e = monomial.begin(); e != monomial.end(); ++e )
+            if( *e != 0 )
+                return false;
+        return true;
+    }
+
+    bool ModularGcd::solve( std::vector<std::vector<unsigned> >& system, unsigned nrOfUnknowns, unsigned p, std::vector<unsigned>& solution )
+    {
+        // Gauss-Jordan elimination; the last column is the right-hand side
+        for( unsigned column = 0; column < nrOfUnknowns; ++column )
+        {
+            unsigned pivot = column;
+            while( pivot < system.size() && system[pivot][column] == 0 )
+                ++pivot;
+            if( pivot == system.size() )
+                return false;    // no unique solution
+            std::swap( system[column], system[pivot] );
+            unsigned long long pivotInverse = inverse( system[column][column], p );
+            for( unsigned k = column; k <= nrOfUnknowns; ++k )
+                system[column][k] = (unsigned)((system[column][k] * pivotInverse) % p);
+            for( unsigned i = 0; i < system.size(); ++i )
+            {
+                unsigned long long factor = system[i][column];
+                if( i == column || factor == 0 )
+                    continue;
+                for( unsigned k = column; k <= nrOfUnknowns; ++k )
+                    system[i][k] = (unsigned)((system[i][k] + (p - factor) * system[column][k]) % p);
+            }
+        }
+        for( unsigned i = nrOfUnknowns; i < system.size(); ++i )
+            if( system[i][nrOfUnknowns] != 0 )
+                return false;    // inconsistent
+        solution = std::vector<unsigned>( nrOfUnknowns );
+        for( unsigned column = 0; column < nrOfUnknowns; ++column )
+            solution[column] = system[column][nrOfUnknowns];
+        return true;
+    }
+
+    const ModularGcd::Univariate ModularGcd::univariateContent( const CoefficientMap& c, unsigned p )
+    {
+        Univariate result = Univariate();
+        for( CoefficientMap::const_iterator i = c.begin(); i != c.end() && result.size() != 1; ++i )
+            result = univariateGcd( result, i->second, p );
+        return result;
+    }
+
+    const ModularGcd::Univariate ModularGcd::univariateGcd( Univariate a, Univariate b, unsigned p )
+    {
+        while( !a.empty() && a.back() == 0 )
+            a.pop_back();
+        while( !b.empty() && b.back() == 0 )
+            b.pop_back();
+        while( !b.empty() )
+        {
+            // a <- a mod b
+            unsigned long long leadingInverse = inverse( b.back(), p );
+            while( a.size() >= b.size() )
+            {
+                unsigned long long factor = (a.back() * leadingInverse) % p;
+                unsigned           shift  = a.size() - b.size();
+                for( unsigned i = 0; i < b.size(); ++i )
+                    a[shift + i] = (unsigned)((a[shift + i] + (p - factor) * b[i]) % p);
+                while( !a.empty() && a.back() == 0 )
+                    a.pop_back();
+            }
+            a.swap( b );
+        }
+        if( !a.empty() )
+        {
+            unsigned long long leadingInverse = inverse( a.back(), p );
+            for( unsigned i = 0; i < a.size(); ++i )
+                a[i] = (unsigned)((a[i] * leadingInverse) % p);
+        }
+        return a;
+    }
+
+    const ModularGcd::Univariate ModularGcd::univariateQuotient( Univariate a, const Univariate& b, unsigned p )
+    {
+        if( a.size() < b.size() )
+            return Univariate();
+        Univariate         quotient       = Univariate( a.size() - b.size() + 1, 0 );
+        unsigned long long leadingInverse = inverse( b.back(), p );
+        for( unsigned shift = quotient.size(); shift-- > 0; )
+        {
+            unsigned long long factor = (a[shift + b.size() - 1] * leadingInverse) % p;
+            quotient[shift] = (unsigned)factor;
+            for( unsigned i = 0; i < b.size(); ++i )
+                a[shift + i] = (unsigned)((a[shift + i] + (p - factor) * b[i]) % p);
+        }
+        return quotient;
+    }
+
+    const ModularGcd::Univariate ModularGcd::univariateMultiply( const Univariate& a, const Univariate& b, unsigned p )
+    {
+        if( a.empty() || b.empty() )
+            return Univariate();
+        Univariate result = Univariate( a.size() + b.size() - 1, 0 );
+        for( unsigned i = 0; i < a.size(); ++i )
+            for( unsigned j = 0; j < b.size(); ++j )
+                result[i + j] = (unsigned)((result[i + j] + (unsigned long long)a[i] * b[j]) % p);
+        return result;
+    }
+
+    unsigned ModularGcd::univariateEvaluate( const Univariate& a, unsigned alpha, unsigned p )
+    {
+        unsigned long long result = 0;
+        for( unsigned i = a.size(); i-- > 0; )
+            result = (result * alpha + a[i]) % p;
+        return (unsigned)result;
+    }
+
+    unsigned ModularGcd::power( unsigned a, unsigned long e, unsigned p )
+    {
+        unsigned long long result = 1;
+        unsigned long long base   = a % p;
+        for( ; e > 0; e >>= 1 )
+        {
+            if( e & 1 )
+                result = (result * base) % p;
+            base = (base * base) % p;
+        }
+        return (unsigned)result;
+    }
+
+    unsigned ModularGcd::inverse( unsigned a, unsigned p )
+    {
+        return power( a, p - 2, p );    // Fermat's little theorem
+    }
+
+}    // namespace GiNaCRA
@@ -0,0 +1,158 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+
+#ifndef GINACRA_MODULARGCD_H
+#define GINACRA_MODULARGCD_H
+
+#include <map>
+#include <set>
+#include <vector>
+#include <ginac/ginac.h>
+#include <cln/cln.h>
+
+using GiNaC::ex;
+using GiNaC::symbol;
+using std::vector;
+
+namespace GiNaCRA
+{
+    /**
+     * Modular greatest common divisors of multivariate polynomials with integer coefficients.
+     *
+     * The gcd is computed modulo a sequence of word-size primes and reconstructed by the Chinese remainder theorem. Every
+     * image is scaled such that the coefficient of its lexicographically leading monomial is the gcd of the corresponding
+     * coefficients of the input, so that the images fit together. Primes and evaluation points yielding a gcd image with a
+     * larger leading monomial are discarded; a smaller leading monomial discards the previous images. The result is
+     * verified by trial division.
+     *
+     * The image modulo the first prime is computed by Brown's dense algorithm, which interpolates the gcd one variable after
+     * another from its images at sufficiently many evaluation points. The monomials of this image are then used as the
+     * skeleton for Zippel's sparse interpolation modulo the further primes: all variables but the first are specialized
+     * at random points, and the coefficients of the skeleton monomials together with the unknown scaling of the univariate
+     * gcd images are determined by a linear system over Z/pZ. If the system has no unique solution or a univariate image
+     * has an unexpected degree, the dense algorithm is used for this prime instead.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     * @see Brown: On Euclid's algorithm and the computation of polynomial greatest common divisors. J. ACM 18(4), 1971
+     * @see Zippel: Probabilistic algorithms for sparse polynomials. EUROSAM 1979, LNCS 72
+     * @see de Kleine, Monagan, Wittkopf: Algorithms for the non-monic case of the sparse modular GCD algorithm. ISSAC 2005
+     * @see Geddes, Czapor, Labahn: Algorithms for Computer Algebra, Chapter 7. Kluwer, 1992
+     */
+    class ModularGcd
+    {
+        public:
+
+            /// multivariate polynomial with integer coefficients, mapping exponent vectors to nonzero coefficients
+            typedef std::map<std::vector<unsigned>, cln::cl_I> IntegerPolynomial;
+            /// multivariate polynomial over Z/pZ, mapping exponent vectors to nonzero coefficients
+            typedef std::map<std::vector<unsigned>, unsigned> ModularPolynomial;
+
+            /**
+             * Computes the greatest common divisor of two polynomials.
+             *
+             * If a or b is no polynomial with integer coefficients, GiNaC::gcd( a, b ) is returned.
+             * @param a
+             * @param b
+             * @return the greatest common divisor of a and b, its lexicographically leading coefficient being positive
+             */
+            static const ex gcd( const ex& a, const ex& b );
+
+            /**
+             * Computes the content of a polynomial in x, i.e., the greatest common divisor of its coefficients, the same way as
+             * GiNaC::ex::content does but with the modular gcd.
+             * @param p
+             * @param x
+             * @return the content of p in x
+             */
+            static const ex content( const ex& p, const symbol& x );
+
+            /**
+             * @param a
+             * @param b
+             * @return the greatest common divisor of a and b with positive lexicographically leading coefficient, or zero if the primes are exhausted
+             * @complexity O( k*D ) arithmetic operations modulo word-size primes, where k is the number of primes and D the cost of one dense image
+             */
+            static const IntegerPolynomial gcd( const IntegerPolynomial& a, const IntegerPolynomial& b );
+
+            /**
+             * Computes the greatest common divisor of two polynomials over Z/pZ by Brown's algorithm.
+             * @param a
+             * @param b
+             * @param nrOfVariables the exponents of the variables from nrOfVariables on are zero in a and b
+             * @param p a prime below 2^31
+             * @return the greatest common divisor of a and b, its lexicographically leading coefficient being 1, or zero if the evaluation points are exhausted
+             */
+            static const ModularPolynomial denseGcd( const ModularPolynomial& a, const ModularPolynomial& b, unsigned nrOfVariables, unsigned p );
+
+            /**
+             * Computes the greatest common divisor of two polynomials over Z/pZ by Zippel's sparse interpolation, given its monomials.
+             * @param a
+             * @param b
+             * @param skeleton the monomials of the gcd in increasing lexicographical order
+             * @param lead the coefficient of the lexicographically leading monomial of the result
+             * @param p a prime below 2^31
+             * @param result receives the gcd of a and b with leading coefficient lead
+             * @return true if the coefficients of the skeleton are determined uniquely, false otherwise
+             */
+            static bool sparseGcd( const ModularPolynomial& a,
+                                   const ModularPolynomial& b,
+                                   const std::vector<std::vector<unsigned> >& skeleton,
+                                   unsigned lead,
+                                   unsigned p,
+                                   ModularPolynomial& result );
+
+        private:
+
+            /// dense univariate polynomial over Z/pZ
+            typedef std::vector<unsigned> Univariate;
+            /// polynomial with univariate coefficients in one of the variables, whose exponent is zero in the keys
+            typedef std::map<std::vector<unsigned>, Univariate> CoefficientMap;
+
+            static void collectSymbols( const ex& p, std::set<ex, GiNaC::ex_is_less>& symbols );
+            static bool decompose( const ex& p, const vector<symbol>& variables, unsigned k, std::vector<unsigned>& exponents, IntegerPolynomial& result );
+            static const ex expression( const IntegerPolynomial& p, const vector<symbol>& variables );
+            static const cln::cl_I integerContent( const IntegerPolynomial& a );
+            static bool divides( const IntegerPolynomial& a, const IntegerPolynomial& b );
+            static const IntegerPolynomial symmetric( const IntegerPolynomial& a, const cln::cl_I& modulus );
+            static const ModularPolynomial reduce( const IntegerPolynomial& a, unsigned p );
+            static const CoefficientMap coefficients( const ModularPolynomial& a, unsigned v );
+            static const ModularPolynomial combine( const CoefficientMap& c, unsigned v );
+            static const ModularPolynomial evaluate( const ModularPolynomial& a, unsigned v, unsigned alpha, unsigned p );
+            static const Univariate evaluate( const ModularPolynomial& a, const std::vector<unsigned>& point, unsigned p );
+            static void makeMonic( ModularPolynomial& a, unsigned p );
+            static bool divides( const ModularPolynomial& a, const ModularPolynomial& b, unsigned p );
+            static bool isConstant( const std::vector<unsigned>& monomial );
+            static bool solve( std::vector<std::vector<unsigned> >& system, unsigned nrOfUnknowns, unsigned p, std::vector<unsigned>& solution );
+            static const Univariate univariateContent( const CoefficientMap& c, unsigned p );
+            static const Univariate univariateGcd( Univariate a, Univariate b, unsigned p );
+            static const Univariate univariateQuotient( Univariate a, const Univariate& b, unsigned p );
+            static const Univariate univariateMultiply( const Univariate& a, const Univariate& b, unsigned p );
+            static unsigned univariateEvaluate( const Univariate& a, unsigned alpha, unsigned p );
+            static unsigned power( unsigned a, unsigned long e, unsigned p );
+            static unsigned inverse( unsigned a, unsigned p );
+    };
+
+}
+#endif   /** GINACRA_MODULARGCD_H */
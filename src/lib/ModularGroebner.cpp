@@ -0,0 +1,234 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#include "ModularGroebner.h"
+#include "utilities.h"
+
+namespace GiNaCRA
+{
+    ModularGroebner::ModularGroebner( std::list<PolynomialType>::const_iterator begin_generatingset,
+                                      std::list<PolynomialType>::const_iterator end_generatingset,
+                                      unsigned maxPrimes ):
+        mIdeal( begin_generatingset, end_generatingset ),
+        mCmp( mIdeal.empty() ? MonomMRCompare() : mIdeal.front().getMonomOrder() ),
+        mEngine( GroebnerSettings::DEFAULT_ENGINE ),
+        mThreads( GroebnerSettings::DEFAULT_THREADS ),
+        mMaxPrimes( maxPrimes ),
+        mUsedPrimes( 0 ),
+        mDiscardedPrimes( 0 ),
+        mIsSolved( false ),
+        mIsVerified( false )
+    {
+        for( std::list<PolynomialType>::iterator i = mIdeal.begin(); i != mIdeal.end(); )
+        {
+            if( i->isZero() )
+                i = mIdeal.erase( i );
+            else
+                ++i;
+        }
+    }
+
+    void ModularGroebner::solve()
+    {
+        if( mIsSolved )
+            return;
+        if( mIdeal.empty() )
+        {
+            mIsSolved   = true;
+            mIsVerified = true;
+            return;
+        }
+        unsigned oldModulus = ModularCoefficientMR::modulus();
+        unsigned p          = 2147483648u;    // start with the largest primes below 2^31
+        for( unsigned i = 0; i < mMaxPrimes; ++i )
+        {
+            p = previousPrime( p );
+            if( p == 0 )
+                break;
+            ModularCoefficientMR::setModulus( p );
+            // map the input, rejecting primes dividing a denominator or a leading coefficient
+            std::list<MultivariatePolynomialMRZp> input;
+            bool badPrime = false;
+            for( std::list<PolynomialType>::const_iterator f = mIdeal.begin(); !badPrime && f != mIdeal.end(); ++f )
+            {
+                try
+                {
+                    input.push_back( MultivariatePolynomialMRZp( *f ));
+                    badPrime = input.back().isZero() || !(input.back().lmon() == f->lmon());
+                }
+                catch( std::domain_error& )
+                {
+                    badPrime = true;
+                }
+            }
+            if( badPrime )
+            {
+                ++mDiscardedPrimes;
+                continue;
+            }
+            GroebnerZp modularBasis( input.begin(), input.end() );
+            modularBasis.setEngine( mEngine );
+            modularBasis.setThreads( mThreads );
+            modularBasis.solve();
+            modularBasis.reduce();
+            ++mUsedPrimes;
+
+            BasisImage&               image = addImage( modularBasis.getBase(), p );
+            std::list<PolynomialType> candidate;
+            if( !reconstruct( image, candidate ))
+            {
+                image.mHasCandidate = false;
+                continue;
+            }
+            if( image.mHasCandidate && image.mCandidate == candidate && verify( candidate ))
+            {
+                mGB.swap( candidate );
+                mDiscardedPrimes += mUsedPrimes - image.mPrimes;
+                mIsSolved   = true;
+                mIsVerified = true;
+                for( std::list<PolynomialType>::const_iterator f = mIdeal.begin(); mIsVerified && f != mIdeal.end(); ++f )
+                    mIsVerified = f->isHomogeneous();
+                break;
+            }
+            image.mCandidate.swap( candidate );
+            image.mHasCandidate = true;
+        }
+        ModularCoefficientMR::setModulus( oldModulus );
+        mImages.clear();
+        if( !mIsSolved )
+        {
+            // the primes did not suffice, compute over the rationals directly
+            std::list<PolynomialType> ideal = mIdeal;
+            GroebnerQ                 rationalBasis( ideal.begin(), ideal.end() );
+            rationalBasis.setEngine( mEngine );
+            rationalBasis.solve();
+            rationalBasis.reduce();
+            mGB         = rationalBasis.getBase();
+            mIsSolved   = true;
+            mIsVerified = true;
+        }
+    }
+
+    unsigned ModularGroebner::previousPrime( unsigned p )
+    {
+        while( p > 2 )
+        {
+            --p;
+            bool isPrime = p == 2 || p % 2 != 0;
+            for( unsigned d = 3; isPrime && d <= p / d; d += 2 )
+                isPrime = p % d != 0;
+            if( isPrime )
+                return p;
+        }
+        return 0;
+    }
+
+    ModularGroebner::BasisImage& ModularGroebner::addImage( const std::list<MultivariatePolynomialMRZp>& base, unsigned p )
+    {
+        std::vector<MultivariateMonomialMR> leadingMonomials;
+        for( std::list<MultivariatePolynomialMRZp>::const_iterator g = base.begin(); g != base.end(); ++g )
+            leadingMonomials.push_back( g->lmon() );
+
+        std::list<BasisImage>::iterator image = mImages.begin();
+        while( image != mImages.end() && image->mLeadingMonomials != leadingMonomials )
+            ++image;
+        if( image == mImages.end() )
+        {
+            // first prime with these leading monomials
+            BasisImage newImage;
+            newImage.mLeadingMonomials = leadingMonomials;
+            newImage.mModulus          = p;
+            newImage.mPrimes           = 1;
+            newImage.mHasCandidate     = false;
+            for( std::list<MultivariatePolynomialMRZp>::const_iterator g = base.begin(); g != base.end(); ++g )
+            {
+                CoefficientImage coefficients( mCmp );
+                for( MultivariatePolynomialMRZp::TermcIt t = g->begin(); t != g->end(); ++t )
+                    coefficients[*t] = cln::cl_I( t->getCoeff().getValue() );
+                newImage.mCoefficients.push_back( coefficients );
+            }
+            mImages.push_back( newImage );
+            return mImages.back();
+        }
+
+        // lift the coefficients by the Chinese remainder theorem, missing monomials have the coefficient zero
+        std::vector<CoefficientImage>::iterator coefficients = image->mCoefficients.begin();
+        for( std::list<MultivariatePolynomialMRZp>::const_iterator g = base.begin(); g != base.end(); ++g, ++coefficients )
+        {
+            CoefficientImage modular( mCmp );
+            for( MultivariatePolynomialMRZp::TermcIt t = g->begin(); t != g->end(); ++t )
+            {
+                modular[*t] = cln::cl_I( t->getCoeff().getValue() );
+                coefficients->insert( std::make_pair( MultivariateMonomialMR( *t ), cln::cl_I( 0 )));
+            }
+            for( CoefficientImage::iterator c = coefficients->begin(); c != coefficients->end(); ++c )
+            {
+                CoefficientImage::const_iterator m = modular.find( c->first );
+                c->second = GiNaC::chineseRemainder( c->second, image->mModulus, m == modular.end() ? cln::cl_I( 0 ) : m->second, p );
+            }
+        }
+        image->mModulus = image->mModulus * p;
+        ++image->mPrimes;
+        return *image;
+    }
+
+    bool ModularGroebner::reconstruct( const BasisImage& image, std::list<PolynomialType>& result ) const
+    {
+        result.clear();
+        for( std::vector<CoefficientImage>::const_iterator g = image.mCoefficients.begin(); g != image.mCoefficients.end(); ++g )
+        {
+            std::set<PolynomialType::Term, MonomMRCompare> terms( mCmp );
+            for( CoefficientImage::const_iterator c = g->begin(); c != g->end(); ++c )
+            {
+                cln::cl_RA coefficient;
+                if( !GiNaC::rationalReconstruction( c->second, image.mModulus, coefficient ))
+                    return false;
+                if( !cln::zerop( coefficient ))
+                    terms.insert( terms.end(), PolynomialType::Term( c->first, RationalCoefficientMR( coefficient )));
+            }
+            result.push_back( PolynomialType( terms.begin(), terms.end(), mCmp ));
+        }
+        return true;
+    }
+
+    bool ModularGroebner::verify( const std::list<PolynomialType>& candidate ) const
+    {
+        PolynomialDivisorIndex<std::list<PolynomialType>::const_iterator> divisors( candidate.begin(), candidate.end() );
+        for( std::list<PolynomialType>::const_iterator f = mIdeal.begin(); f != mIdeal.end(); ++f )
+        {
+            if( !f->CalculateRemainder( candidate.begin(), candidate.end() ).isZero() )
+                return false;
+        }
+        for( std::list<PolynomialType>::const_iterator i = candidate.begin(); i != candidate.end(); ++i )
+        {
+            std::list<PolynomialType>::const_iterator j = i;
+            for( ++j; j != candidate.end(); ++j )
+            {
+                if( !PolynomialType::SPol( *i, *j ).CalculateRemainder( divisors ).isZero() )
+                    return false;
+            }
+        }
+        return true;
+    }
+
+}
@@ -0,0 +1,204 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef GINACRA_MODULARGROEBNER_H
+#define GINACRA_MODULARGROEBNER_H
+
+#include <map>
+#include <vector>
+
+#include "Groebner.h"
+
+namespace GiNaCRA
+{
+    /**
+     * Multi-modular computation of reduced Groebner bases over the rational numbers.
+     *
+     * The input ideal is mapped to Z/pZ for a sequence of word-size primes p, each image is solved by a GroebnerZp, and
+     * the results are lifted to Q by the Chinese remainder theorem and rational reconstruction. Primes that divide a
+     * denominator or a leading coefficient of the input are skipped. The images are grouped by their sets of leading
+     * monomials; unlucky primes produce a different set and thus never contribute to the group which finally
+     * stabilizes. A reconstructed basis is accepted once it is reproduced by the next prime of its group and checked
+     * over Q: every input polynomial reduces to zero and every S-polynomial of the candidate reduces to zero.
+     *
+     * The check shows that the candidate is a Groebner basis of an ideal containing the input. For homogeneous input,
+     * this ideal equals the input ideal, since the candidate reduces to the basis of the ideal modulo a permissible
+     * prime (see Arnold), and the result is verified (see isVerified). For other input, the check does not exclude a
+     * strictly larger ideal, which requires all primes of the accepted group to be unlucky in the same way, so the
+     * result is only correct with high probability.
+     *
+     * The primes are processed one after another by the calling thread. Its modulus of ModularCoefficientMR is
+     * restored after solve().
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     * @see Arnold: Modular algorithms for computing Groebner bases. J. Symb. Comput. 35(4), 2003
+     */
+    class ModularGroebner
+    {
+        public:
+            typedef MultivariatePolynomialMRQ PolynomialType;
+
+            /**
+             * Creates the ideal generated by the given polynomials.
+             * @param begin_generatingset
+             * @param end_generatingset
+             * @param maxPrimes number of primes after which the computation falls back to GroebnerQ
+             */
+            ModularGroebner( std::list<PolynomialType>::const_iterator begin_generatingset,
+                             std::list<PolynomialType>::const_iterator end_generatingset,
+                             unsigned maxPrimes = 64 );
+
+            /**
+             * Computes the reduced Groebner basis of the ideal.
+             */
+            void solve();
+
+            /**
+             * Output the polynomials in the internal representation.
+             * @param os
+             * @param rhs
+             * @return
+             */
+            friend std::ostream& operator <<( std::ostream& os, const ModularGroebner& rhs )
+            {
+                os << "{";
+                for( std::list<PolynomialType>::const_iterator i = rhs.mGB.begin(); i != rhs.mGB.end(); ++i )
+                {
+                    os << *i << std::endl;
+                }
+                return os << "}";
+            }
+
+            std::list<PolynomialType> getBase() const
+            {
+                return mGB;
+            }
+
+            /**
+             *
+             * @return how many polynomials are actually in the basis
+             */
+            inline unsigned size() const
+            {
+                return mGB.size();
+            }
+
+            inline bool isSolved() const
+            {
+                return mIsSolved;
+            }
+
+            /**
+             * @return true if the result is proven to be the reduced Groebner basis of the input, false if it is only correct with high
+             *         probability, i.e., if the input is not homogeneous and the basis was reconstructed from the images
+             */
+            inline bool isVerified() const
+            {
+                return mIsVerified;
+            }
+
+            inline GroebnerSettings::Engine engine() const
+            {
+                return mEngine;
+            }
+
+            /**
+             * Sets the algorithm used for the images modulo the primes and for the fallback over the rationals, see GroebnerT::setEngine.
+             * @param engine
+             */
+            inline void setEngine( GroebnerSettings::Engine engine )
+            {
+                mEngine = engine;
+            }
+
+            inline unsigned threads() const
+            {
+                return mThreads;
+            }
+
+            /**
+             * Sets the number of threads reducing the S-polynomials of each image modulo a prime, see GroebnerT::setThreads.
+             * The primes themselves are processed one after another.
+             * @param threads the number of threads, 0 means one per hardware thread
+             */
+            inline void setThreads( unsigned threads )
+            {
+                mThreads = threads;
+            }
+
+            /**
+             * @return the number of primes whose images were computed
+             */
+            inline unsigned usedPrimes() const
+            {
+                return mUsedPrimes;
+            }
+
+            /**
+             * @return the number of primes which were skipped or did not contribute to the result
+             */
+            inline unsigned discardedPrimes() const
+            {
+                return mDiscardedPrimes;
+            }
+
+            /**
+             * @param p
+             * @return the largest prime below p, or 0 if there is none
+             */
+            static unsigned previousPrime( unsigned p );
+
+        private:
+            typedef std::map<MultivariateMonomialMR, cln::cl_I, MonomMRCompare> CoefficientImage;
+
+            /// Accumulated images of the reduced bases sharing the same leading monomials.
+            struct BasisImage
+            {
+                std::vector<MultivariateMonomialMR> mLeadingMonomials;
+                std::vector<CoefficientImage>       mCoefficients;
+                cln::cl_I                           mModulus;
+                unsigned                            mPrimes;
+                std::list<PolynomialType>           mCandidate;
+                bool                                mHasCandidate;
+            };
+
+            BasisImage& addImage( const std::list<MultivariatePolynomialMRZp>& base, unsigned p );
+            bool reconstruct( const BasisImage& image, std::list<PolynomialType>& result ) const;
+            bool verify( const std::list<PolynomialType>& candidate ) const;
+
+            std::list<PolynomialType> mIdeal;
+            std::list<PolynomialType> mGB;
+            std::list<BasisImage>     mImages;
+            MonomMRCompare            mCmp;
+            GroebnerSettings::Engine  mEngine;
+            unsigned                  mThreads;
+            unsigned                  mMaxPrimes;
+            unsigned                  mUsedPrimes;
+            unsigned                  mDiscardedPrimes;
+            bool                      mIsSolved;
+            bool                      mIsVerified;
+    };
+
+}
+#endif   /** GINACRA_MODULARGROEBNER_H */
@@ -0,0 +1,394 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+
+#include <algorithm>
+
+#include "ModularSubresultants.h"
+#include "ModularGroebner.h"
+#include "utilities.h"
+
+using GiNaC::is_a;
+using GiNaC::ex_to;
+
+namespace GiNaCRA
+{
+    const vector<ex> ModularSubresultants::principalSubresultantCoefficients( const UnivariatePolynomial& a,
+                                                                              const UnivariatePolynomial& b,
+                                                                              unsigned long maxPoints )
+            throw ( invalid_argument )
+    {
+        if( !a.isCompatible( b ))
+            throw invalid_argument( "Symbols of the two univariate polynomials do not match." );
+        // p shall receive the polynomial of larger degree
+        bool                        swapped = a.degree() < b.degree();
+        const UnivariatePolynomial& p       = swapped ? b : a;
+        const UnivariatePolynomial& q       = swapped ? a : b;
+        if( p.isZero() || q.isZero() || q.degree() < 1 )
+            return UnivariatePolynomial::principalSubresultantCoefficients( a, b, UnivariatePolynomial::DUCOS_SUBRESULTANTSTRATEGY );
+        unsigned n = p.degree();
+        unsigned m = q.degree();
+
+        std::set<ex, GiNaC::ex_is_less> symbols;
+        collectSymbols( p, symbols );
+        collectSymbols( q, symbols );
+        symbols.erase( p.variable() );
+        vector<symbol> parameters;
+        for( std::set<ex, GiNaC::ex_is_less>::const_iterator s = symbols.begin(); s != symbols.end(); ++s )
+            parameters.push_back( ex_to<symbol>( *s ));
+
+        // integer images p*pFactor and q*qFactor of the input
+        std::vector<ParameterPolynomial> pCoefficients, qCoefficients;
+        numeric                          pFactor, qFactor;
+        if( !integerCoefficients( p, parameters, pCoefficients, pFactor ) || !integerCoefficients( q, parameters, qCoefficients, qFactor ))
+            return UnivariatePolynomial::principalSubresultantCoefficients( a, b, UnivariatePolynomial::DUCOS_SUBRESULTANTSTRATEGY );
+
+        // the j-th principal subresultant coefficient has degree at most (m-j)*deg_y(p) + (n-j)*deg_y(q) in the parameter y
+        std::vector<unsigned> sizes      = std::vector<unsigned>( parameters.size() );
+        unsigned long         nrOfPoints = 1;
+        for( unsigned k = 0; k < parameters.size(); ++k )
+        {
+            sizes[k] = m * degree( pCoefficients, k ) + n * degree( qCoefficients, k ) + 1;
+            if( nrOfPoints > maxPoints / sizes[k] )
+                return UnivariatePolynomial::principalSubresultantCoefficients( a, b, UnivariatePolynomial::DUCOS_SUBRESULTANTSTRATEGY );
+            nrOfPoints *= sizes[k];
+        }
+        // every coefficient of the j-th principal subresultant coefficient is bounded by |p|^(m-j) * |q|^(n-j) where |.| is the sum of the absolute values of the coefficients
+        cln::cl_I bound = 2 * cln::expt_pos( norm( pCoefficients ), m ) * cln::expt_pos( norm( qCoefficients ), n );
+
+        std::vector<std::vector<cln::cl_I> > images  = std::vector<std::vector<cln::cl_I> >( m + 1, std::vector<cln::cl_I>( nrOfPoints, 0 ));
+        std::vector<std::vector<unsigned> >  values  = std::vector<std::vector<unsigned> >( m + 1, std::vector<unsigned>( nrOfPoints ));
+        cln::cl_I                            modulus = 1;
+        unsigned                             prime   = 2147483648u;    // start with the largest primes below 2^31
+        while( modulus <= bound )
+        {
+            prime = ModularGroebner::previousPrime( prime );
+            std::vector<unsigned> point = std::vector<unsigned>( parameters.size(), 0 );
+            for( unsigned long i = 0; i < nrOfPoints; ++i )
+            {
+                std::vector<unsigned> psc = principalSubresultantCoefficients( evaluate( pCoefficients, point, prime ),
+                                                                               evaluate( qCoefficients, point, prime ), prime );
+                for( unsigned j = 0; j <= m; ++j )
+                    values[j][i] = psc[j];
+                // next grid point, the first parameter running fastest
+                for( unsigned k = 0; k < point.size() && ++point[k] == sizes[k]; ++k )
+                    point[k] = 0;
+            }
+            for( unsigned j = 0; j <= m; ++j )
+            {
+                interpolate( values[j], sizes, prime );
+                for( unsigned long i = 0; i < nrOfPoints; ++i )
+                    images[j][i] = GiNaC::chineseRemainder( images[j][i], modulus, values[j][i], prime );
+            }
+            modulus = modulus * prime;
+        }
+
+        // lift to the symmetric range and undo the normalization: psc_j(c*p, d*q) = c^(m-j) * d^(n-j) * psc_j(p, q)
+        cln::cl_I  halfModulus = cln::floor1( modulus, 2 );
+        vector<ex> result      = vector<ex>( m + 1 );
+        for( unsigned j = 0; j <= m; ++j )
+        {
+            ex                    coefficient = 0;
+            std::vector<unsigned> exponents   = std::vector<unsigned>( parameters.size(), 0 );
+            for( unsigned long i = 0; i < nrOfPoints; ++i )
+            {
+                cln::cl_I c = images[j][i] > halfModulus ? images[j][i] - modulus : images[j][i];
+                if( !cln::zerop( c ))
+                {
+                    ex monomial = numeric( c );
+                    for( unsigned k = 0; k < parameters.size(); ++k )
+                        monomial *= GiNaC::pow( parameters[k], exponents[k] );
+                    coefficient += monomial;
+                }
+                for( unsigned k = 0; k < exponents.size() && ++exponents[k] == sizes[k]; ++k )
+                    exponents[k] = 0;
+            }
+            coefficient /= GiNaC::pow( pFactor, m - j ) * GiNaC::pow( qFactor, n - j );
+            // swapping the rows of a and b in the Sylvester submatrix
+            if( swapped && ((n - j) * (m - j)) % 2 == 1 )
+                coefficient = -coefficient;
+            result[j] = GiNaC::expand( coefficient );
+        }
+        return result;
+    }
+
+    const std::vector<unsigned> ModularSubresultants::principalSubresultantCoefficients( const std::vector<unsigned>& a,
+                                                                                         const std::vector<unsigned>& b,
+                                                                                         unsigned p )
+    {
+        unsigned              m      = b.size() - 1;
+        std::vector<unsigned> result = std::vector<unsigned>( m + 1, 0 );
+        if( a.back() == 0 || b.back() == 0 )
+        {
+            // the remainder sequence does not respect the formal degrees
+            for( unsigned j = 0; j <= m; ++j )
+                result[j] = sylvesterDeterminant( a, b, j, p );
+            return result;
+        }
+        // Euclidean remainder sequence F_0 = a, F_1 = b, F_{i+1} = F_{i-1} mod F_i of degrees n_0 > ... > n_k and leading coefficients c_i
+        std::vector<std::vector<unsigned> > sequence = std::vector<std::vector<unsigned> >( 1, a );
+        sequence.push_back( b );
+        while( true )
+        {
+            std::vector<unsigned> r = sequence[sequence.size() - 2];
+            remainder( r, sequence.back(), p );
+            if( r.empty() )
+                break;
+            sequence.push_back( r );
+        }
+        // psc_{n_i} = (-1)^s_i * c_i^(n_{i-1}-n_i) * prod_{l=1}^{i-1} c_l^(n_{l-1}-n_{l+1}) with s_i = sum_{l=1}^{i} (n_{l-1}-n_i)*(n_l-n_i)
+        unsigned prefix = 1;
+        for( unsigned i = 1; i < sequence.size(); ++i )
+        {
+            unsigned long ni = sequence[i].size() - 1;
+            unsigned long s  = 0;
+            for( unsigned l = 1; l <= i; ++l )
+                s += (sequence[l - 1].size() - 1 - ni) * (sequence[l].size() - 1 - ni);
+            unsigned psc = (unsigned)(((unsigned long long)prefix * power( sequence[i].back(), sequence[i - 1].size() - 1 - ni, p )) % p);
+            result[ni] = s % 2 == 0 || psc == 0 ? psc : p - psc;
+            if( i + 1 < sequence.size() )
+                prefix = (unsigned)(((unsigned long long)prefix * power( sequence[i].back(), sequence[i - 1].size() - sequence[i + 1].size(), p )) % p);
+        }
+        return result;
+    }
+
+    void ModularSubresultants::interpolate( std::vector<unsigned>& values, const std::vector<unsigned>& sizes, unsigned p )
+    {
+        unsigned long stride = 1;
+        for( unsigned k = 0; k < sizes.size(); ++k )
+        {
+            unsigned d = sizes[k];
+            std::vector<unsigned> inverses = std::vector<unsigned>( d, 1 );
+            for( unsigned i = 2; i < d; ++i )
+                inverses[i] = inverse( i, p );
+            std::vector<unsigned> v = std::vector<unsigned>( d );
+            std::vector<unsigned> c = std::vector<unsigned>( d );
+            for( unsigned long start = 0; start < values.size(); ++start )
+            {
+                if( (start / stride) % d != 0 )
+                    continue;    // start is not the first point of a line along the k-th variable
+                for( unsigned i = 0; i < d; ++i )
+                    v[i] = values[start + i * stride];
+                // divided differences at the points 0, ..., d-1, where the point t-i is subtracted from the point t
+                for( unsigned i = 1; i < d; ++i )
+                    for( unsigned t = d - 1; t >= i; --t )
+                        v[t] = (unsigned)(((unsigned long long)(v[t] >= v[t - 1] ? v[t] - v[t - 1] : v[t] + p - v[t - 1]) * inverses[i]) % p);
+                // Horner scheme for the Newton form v[0] + (y-0)*(v[1] + (y-1)*(v[2] + ...))
+                std::fill( c.begin(), c.end(), 0 );
+                c[0] = v[d - 1];
+                for( unsigned t = d - 1; t-- > 0; )
+                {
+                    // c := c*(y-t) + v[t]
+                    for( unsigned s = d - 1 - t; s > 0; --s )
+                        c[s] = (unsigned)((c[s - 1] + (unsigned long long)(p - t) * c[s]) % p);
+                    c[0] = (unsigned)((v[t] + (unsigned long long)(p - t) * c[0]) % p);
+                }
+                for( unsigned i = 0; i < d; ++i )
+                    values[start + i * stride] = c[i];
+            }
+            stride *= d;
+        }
+    }
+
+    ///////////////////////
+    // Auxiliary Methods //
+    ///////////////////////
+
+    void ModularSubresultants::collectSymbols( const ex& p, std::set<ex, GiNaC::ex_is_less>& symbols )
+    {
+        if( is_a<symbol>( p ))
+            symbols.insert( p );
+        else
+            for( size_t i = 0; i < p.nops(); ++i )
+                collectSymbols( p.op( i ), symbols );
+    }
+
+    bool ModularSubresultants::decompose( const ex& p,
+                                          const vector<symbol>& parameters,
+                                          unsigned k,
+                                          std::vector<unsigned>& exponents,
+                                          std::map<std::vector<unsigned>, numeric>& result )
+    {
+        if( k == parameters.size() )
+        {
+            if( !is_a<numeric>( p ) || !ex_to<numeric>( p ).is_rational() )
+                return false;
+            if( !ex_to<numeric>( p ).is_zero() )
+                result[exponents] = ex_to<numeric>( p );
+            return true;
+        }
+        if( p.ldegree( parameters[k] ) < 0 )
+            return false;
+        for( int d = 0; d <= p.degree( parameters[k] ); ++d )
+        {
+            exponents[k] = d;
+            if( !decompose( p.coeff( parameters[k], d ), parameters, k + 1, exponents, result ))
+                return false;
+        }
+        exponents[k] = 0;
+        return true;
+    }
+
+    bool ModularSubresultants::integerCoefficients( const UnivariatePolynomial& p,
+                                                    const vector<symbol>& parameters,
+                                                    std::vector<ParameterPolynomial>& coefficients,
+                                                    numeric& factor )
+    {
+        std::vector<std::map<std::vector<unsigned>, numeric> > rationalCoefficients
+            = std::vector<std::map<std::vector<unsigned>, numeric> >( p.degree() + 1 );
+        std::vector<unsigned> exponents = std::vector<unsigned>( parameters.size(), 0 );
+        factor = 1;
+        for( int i = 0; i <= p.degree(); ++i )
+        {
+            if( !decompose( GiNaC::expand( p.coeff( i )), parameters, 0, exponents, rationalCoefficients[i] ))
+                return false;
+            for( std::map<std::vector<unsigned>, numeric>::const_iterator c = rationalCoefficients[i].begin(); c != rationalCoefficients[i].end(); ++c )
+                factor = GiNaC::lcm( factor, c->second.denom() );
+        }
+        coefficients = std::vector<ParameterPolynomial>( p.degree() + 1 );
+        for( int i = 0; i <= p.degree(); ++i )
+            for( std::map<std::vector<unsigned>, numeric>::const_iterator c = rationalCoefficients[i].begin(); c != rationalCoefficients[i].end(); ++c )
+                coefficients[i][c->first] = cln::the<cln::cl_I>( (c->second * factor).to_cl_N() );
+        return true;
+    }
+
+    unsigned ModularSubresultants::degree( const std::vector<ParameterPolynomial>& coefficients, unsigned k )
+    {
+        unsigned d = 0;
+        for( std::vector<ParameterPolynomial>::const_iterator c = coefficients.begin(); c != coefficients.end(); ++c )
+            for( ParameterPolynomial::const_iterator t = c->begin(); t != c->end(); ++t )
+                d = std::max( d, t->first[k] );
+        return d;
+    }
+
+    const cln::cl_I ModularSubresultants::norm( const std::vector<ParameterPolynomial>& coefficients )
+    {
+        cln::cl_I n = 0;
+        for( std::vector<ParameterPolynomial>::const_iterator c = coefficients.begin(); c != coefficients.end(); ++c )
+            for( ParameterPolynomial::const_iterator t = c->begin(); t != c->end(); ++t )
+                n = n + cln::abs( t->second );
+        return n;
+    }
+
+    const std::vector<unsigned> ModularSubresultants::evaluate( const std::vector<ParameterPolynomial>& coefficients,
+                                                                const std::vector<unsigned>& point,
+                                                                unsigned p )
+    {
+        std::vector<unsigned> result = std::vector<unsigned>( coefficients.size(), 0 );
+        for( unsigned i = 0; i < coefficients.size(); ++i )
+        {
+            unsigned long long value = 0;
+            for( ParameterPolynomial::const_iterator t = coefficients[i].begin(); t != coefficients[i].end(); ++t )
+            {
+                unsigned long long term = cln::cl_I_to_UL( cln::mod( t->second, p ));
+                for( unsigned k = 0; k < point.size(); ++k )
+                    term = (term * power( point[k], t->first[k], p )) % p;
+                value = (value + term) % p;
+            }
+            result[i] = (unsigned)value;
+        }
+        return result;
+    }
+
+    unsigned ModularSubresultants::sylvesterDeterminant( const std::vector<unsigned>& a, const std::vector<unsigned>& b, unsigned j, unsigned p )
+    {
+        unsigned n    = a.size() - 1;
+        unsigned m    = b.size() - 1;
+        unsigned size = n + m - 2 * j;
+        // rows x^(m-j-1)*a, ..., a, x^(n-j-1)*b, ..., b and columns of the degrees n+m-j-1, ..., j
+        std::vector<std::vector<unsigned> > matrix = std::vector<std::vector<unsigned> >( size, std::vector<unsigned>( size, 0 ));
+        for( unsigned r = 0; r < size; ++r )
+        {
+            const std::vector<unsigned>& f     = r < m - j ? a : b;
+            unsigned                     shift = r < m - j ? m - j - 1 - r : n + m - 2 * j - 1 - r;
+            for( unsigned c = 0; c < size; ++c )
+            {
+                unsigned d = n + m - j - 1 - c;    // degree of column c
+                if( d >= shift && d - shift < f.size() )
+                    matrix[r][c] = f[d - shift];
+            }
+        }
+        // Gaussian elimination
+        unsigned long long det = 1;
+        for( unsigned c = 0; c < size; ++c )
+        {
+            unsigned pivot = c;
+            while( pivot < size && matrix[pivot][c] == 0 )
+                ++pivot;
+            if( pivot == size )
+                return 0;
+            if( pivot != c )
+            {
+                matrix[pivot].swap( matrix[c] );
+                det = (p - det) % p;
+            }
+            det = (det * matrix[c][c]) % p;
+            unsigned pivotInverse = inverse( matrix[c][c], p );
+            for( unsigned r = c + 1; r < size; ++r )
+            {
+                if( matrix[r][c] == 0 )
+                    continue;
+                unsigned long long factor = ((unsigned long long)matrix[r][c] * pivotInverse) % p;
+                for( unsigned k = c; k < size; ++k )
+                    matrix[r][k] = (unsigned)((matrix[r][k] + (p - factor) * matrix[c][k]) % p);
+            }
+        }
+        return (unsigned)det;
+    }
+
+    void ModularSubresultants::remainder( std::vector<unsigned>& a, const std::vector<unsigned>& b, unsigned p )
+    {
+        unsigned bInverse = inverse( b.back(), p );
+        while( a.size() >= b.size() )
+        {
+            unsigned long long factor = ((unsigned long long)a.back() * bInverse) % p;
+            unsigned           shift  = a.size() - b.size();
+            for( unsigned i = 0; i < b.size(); ++i )
+                a[shift + i] = (unsigned)((a[shift + i] + (p - factor) * b[i]) % p);
+            // strip the vanishing leading coefficients
+            while( !a.empty() && a.back() == 0 )
+                a.pop_back();
+        }
+        while( !a.empty() && a.back() == 0 )
+            a.pop_back();
+    }
+
+    unsigned ModularSubresultants::power( unsigned a, unsigned long e, unsigned p )
+    {
+        unsigned long long result = 1;
+        unsigned long long base   = a % p;
+        for( ; e > 0; e >>= 1 )
+        {
+            if( e & 1 )
+                result = (result * base) % p;
+            base = (base * base) % p;
+        }
+        return (unsigned)result;
+    }
+
+    unsigned ModularSubresultants::inverse( unsigned a, unsigned p )
+    {
+        return power( a, p - 2, p );    // Fermat's little theorem
+    }
+
+}    // namespace GiNaCRA
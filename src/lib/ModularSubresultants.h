@@ -0,0 +1,135 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef GINACRA_MODULARSUBRESULTANTS_H
+#define GINACRA_MODULARSUBRESULTANTS_H
+
+#include <map>
+#include <set>
+#include <vector>
+#include <cln/cln.h>
+
+#include "UnivariatePolynomial.h"
+
+namespace GiNaCRA
+{
+    /**
+     * Evaluation/interpolation kernel for the principal subresultant coefficients of two univariate polynomials whose
+     * coefficients are polynomials with rational coefficients in further variables, the parameters.
+     *
+     * After clearing denominators, the input is mapped to Z/pZ for a sequence of word-size primes p. For every prime, the
+     * parameters are specialized at the points of a grid which suffices for the degree bounds of the principal
+     * subresultant coefficients, the coefficients of the specialized polynomials are computed over Z/pZ, and the images
+     * are interpolated densely, one parameter after another. The interpolated images are combined by the Chinese
+     * remainder theorem until the product of the primes exceeds twice a bound on the integer coefficients. Hence, no
+     * intermediate expression has more terms than the result.
+     *
+     * At a point where both leading coefficients are nonzero, the principal subresultant coefficients follow from the
+     * degrees and leading coefficients of the Euclidean remainder sequence over Z/pZ. At the other points, they are computed
+     * as determinants of the Sylvester submatrices. Thus, every prime and every point yields a valid image.
+     *
+     * The arithmetic uses its own modulus, so ModularCoefficientMR::modulus() is not touched.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     * @see Brown, Traub: On Euclid's algorithm and the theory of subresultants. J. ACM 18(4), 1971
+     * @see Collins: The calculation of multivariate polynomial resultants. J. ACM 18(4), 1971
+     */
+    class ModularSubresultants
+    {
+        public:
+
+            /**
+             * Computes the principal subresultant coefficients of a and b by evaluation and interpolation modulo primes.
+             *
+             * Let n >= m be the degrees of a and b. The j-th entry of the result is the determinant of the j-th Sylvester
+             * submatrix of a and b, for j = 0, ..., m. Entries of defective subresultants are zero.
+             * If the coefficients of a or b are no polynomials with rational coefficients, if m is 0, or if more than maxPoints
+             * evaluation points per prime were necessary, the result of UnivariatePolynomial::principalSubresultantCoefficients
+             * with Ducos' optimization is returned instead.
+             * @param a
+             * @param b
+             * @param maxPoints maximal number of evaluation points per prime
+             * @return vector containing at the j-th position the j-th principal subresultant coefficient of a and b
+             * @throw invalid_argument if the main variables of a and b do not match
+             * @complexity O( k*N*n^2 ) arithmetic operations modulo word-size primes, where k is the number of primes and N the number of evaluation points
+             */
+            static const vector<ex> principalSubresultantCoefficients( const UnivariatePolynomial& a,
+                                                                       const UnivariatePolynomial& b,
+                                                                       unsigned long maxPoints = 65536 )
+                    throw ( invalid_argument );
+
+            /**
+             * Computes the principal subresultant coefficients of two dense polynomials over Z/pZ.
+             *
+             * The degrees of a and b are taken formally, i.e., the leading entries of a and b may be zero.
+             * @param a coefficients of the first polynomial, the one of degree i at position i
+             * @param b coefficients of the second polynomial, the one of degree i at position i, with b.size() <= a.size()
+             * @param p a prime below 2^31
+             * @return vector containing at the j-th position the j-th principal subresultant coefficient of a and b modulo p
+             * @complexity O( n^2 ) if both leading entries are nonzero, O( n^4 ) otherwise
+             */
+            static const std::vector<unsigned> principalSubresultantCoefficients( const std::vector<unsigned>& a,
+                                                                                  const std::vector<unsigned>& b,
+                                                                                  unsigned p );
+
+            /**
+             * Interpolates the values of a polynomial given at the grid {0, ..., sizes[0]-1} x ... x {0, ..., sizes[k-1]-1} over Z/pZ.
+             *
+             * The value at the point (i_0, ..., i_{k-1}) is stored at position i_0 + sizes[0]*(i_1 + sizes[1]*(...)) and is replaced
+             * by the coefficient of the monomial with the exponents (i_0, ..., i_{k-1}).
+             * @param values
+             * @param sizes number of grid points per variable, each below p
+             * @param p a prime below 2^31
+             * @complexity O( N*(sizes[0] + ... + sizes[k-1]) ) with N = values.size()
+             */
+            static void interpolate( std::vector<unsigned>& values, const std::vector<unsigned>& sizes, unsigned p );
+
+        private:
+
+            /// sparse polynomial in the parameters, mapping exponent vectors to coefficients
+            typedef std::map<std::vector<unsigned>, cln::cl_I> ParameterPolynomial;
+
+            static void collectSymbols( const ex& p, std::set<ex, GiNaC::ex_is_less>& symbols );
+            static bool decompose( const ex& p,
+                                   const vector<symbol>& parameters,
+                                   unsigned k,
+                                   std::vector<unsigned>& exponents,
+                                   std::map<std::vector<unsigned>, numeric>& result );
+            static bool integerCoefficients( const UnivariatePolynomial& p,
+                                             const vector<symbol>& parameters,
+                                             std::vector<ParameterPolynomial>& coefficients,
+                                             numeric& factor );
+            static unsigned degree( const std::vector<ParameterPolynomial>& coefficients, unsigned k );
+            static const cln::cl_I norm( const std::vector<ParameterPolynomial>& coefficients );
+            static const std::vector<unsigned> evaluate( const std::vector<ParameterPolynomial>& coefficients,
+                                                         const std::vector<unsigned>& point,
+                                                         unsigned p );
+            static unsigned sylvesterDeterminant( const std::vector<unsigned>& a, const std::vector<unsigned>& b, unsigned j, unsigned p );
+            static void remainder( std::vector<unsigned>& a, const std::vector<unsigned>& b, unsigned p );
+            static unsigned power( unsigned a, unsigned long e, unsigned p );
+            static unsigned inverse( unsigned a, unsigned p );
+    };
+
+}
+#endif   /** GINACRA_MODULARSUBRESULTANTS_H */
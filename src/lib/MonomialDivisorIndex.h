@@ -0,0 +1,175 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef GINACRA_MONOMIALDIVISORINDEX_H
+#define GINACRA_MONOMIALDIVISORINDEX_H
+
+#include <vector>
+
+#include "MultivariateMonomialMR.h"
+
+namespace GiNaCRA
+{
+    /**
+     * A list of monomials supporting the search for a divisor of a given monomial. Each monomial is stored together
+     * with its short divisor mask and its total degree, so that most monomials which do not divide the given one are
+     * rejected by one bitwise operation, without looking at the exponents. The entries are kept contiguously and in
+     * the order of insertion, thus the search finds the same divisor as a linear search over the original list.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     */
+    class MonomialDivisorIndex
+    {
+        public:
+
+            MonomialDivisorIndex():
+                mEntries()
+            {}
+
+            /**
+             * Appends a monomial to the index.
+             * @param m
+             */
+            inline void push_back( const MultivariateMonomialMR& m )
+            {
+                mEntries.push_back( Entry( m ));
+            }
+
+            inline void reserve( unsigned size )
+            {
+                mEntries.reserve( size );
+            }
+
+            inline unsigned size() const
+            {
+                return mEntries.size();
+            }
+
+            inline const MultivariateMonomialMR& operator []( unsigned i ) const
+            {
+                return mEntries[i].mMonomial;
+            }
+
+            /**
+             * @param m
+             * @param from the first position to consider
+             * @return the first position not before from holding a divisor of m, or size() if there is none
+             */
+            inline unsigned findDivisor( const MultivariateMonomialMR& m, unsigned from = 0 ) const
+            {
+                return findDivisor( m, m.divisorMask(), from );
+            }
+
+            /**
+             * @param m
+             * @param mask the divisor mask of m, if the same monomial is looked up repeatedly
+             * @param from the first position to consider
+             * @return the first position not before from holding a divisor of m, or size() if there is none
+             */
+            inline unsigned findDivisor( const MultivariateMonomialMR& m, DivisorMask mask, unsigned from ) const
+            {
+                unsigned degree = m.tdeg();
+                for( unsigned i = from; i < mEntries.size(); ++i )
+                {
+                    const Entry& e = mEntries[i];
+                    if( MultivariateMonomialMR::maskAllowsDivision( mask, e.mMask ) && e.mDegree <= degree && m.dividable( e.mMonomial ))
+                        return i;
+                }
+                return mEntries.size();
+            }
+
+        private:
+            struct Entry
+            {
+                DivisorMask            mMask;
+                unsigned               mDegree;
+                MultivariateMonomialMR mMonomial;
+
+                Entry( const MultivariateMonomialMR& m ):
+                    mMask( m.divisorMask() ),
+                    mDegree( m.tdeg() ),
+                    mMonomial( m )
+                {}
+            };
+
+            std::vector<Entry> mEntries;
+    };
+
+    /**
+     * A MonomialDivisorIndex over the leading monomials of a range of polynomials, which keeps an iterator to each
+     * polynomial. It is built once for a basis and passed to MultivariatePolynomialMRT::CalculateRemainder, so that
+     * reductions modulo the same basis do not rebuild the index. The index refers to the polynomials by the
+     * iterators, so it has to be rebuilt whenever the range changes.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     */
+    template<class Iterator>
+    class PolynomialDivisorIndex:
+        public MonomialDivisorIndex
+    {
+        public:
+
+            PolynomialDivisorIndex():
+                MonomialDivisorIndex(),
+                mDivisors()
+            {}
+
+            /**
+             * @param begin
+             * @param end iterators over polynomials, or over objects derived from them
+             */
+            PolynomialDivisorIndex( Iterator begin, Iterator end ):
+                MonomialDivisorIndex(),
+                mDivisors()
+            {
+                for( Iterator it = begin; it != end; ++it )
+                    push_back( it );
+            }
+
+            /**
+             * Appends the polynomial at the given position to the index.
+             * @param it
+             */
+            inline void push_back( Iterator it )
+            {
+                MonomialDivisorIndex::push_back( it->lmon() );
+                mDivisors.push_back( it );
+            }
+
+            /**
+             * @param i
+             * @return the position of the i-th polynomial
+             */
+            inline Iterator divisor( unsigned i ) const
+            {
+                return mDivisors[i];
+            }
+
+        private:
+            std::vector<Iterator> mDivisors;
+    };
+}
+
+#endif
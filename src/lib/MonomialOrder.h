@@ -0,0 +1,185 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef GINACRA_MONOMIALORDER_H
+#define GINACRA_MONOMIALORDER_H
+
+#include <vector>
+
+#include "MultivariateMonomialMR.h"
+
+namespace GiNaCRA
+{
+    typedef bool (*MonomOrderingFc)( const MultivariateMonomialMR&, const MultivariateMonomialMR& );
+
+    /////////////////////////////////
+    // Compile-time order policies //
+    /////////////////////////////////
+
+    /**
+     * Policy for the lexicographical order, see MultivariateMonomialMR::LexCompare.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     */
+    struct LexOrder
+    {
+        static inline bool less( const MultivariateMonomialMR& m1, const MultivariateMonomialMR& m2 )
+        {
+            return MultivariateMonomialMR::LexCompare( m1, m2 );
+        }
+    };
+
+    /**
+     * Policy for the graded lexicographical order, see MultivariateMonomialMR::GrLexCompare.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     */
+    struct GrLexOrder
+    {
+        static inline bool less( const MultivariateMonomialMR& m1, const MultivariateMonomialMR& m2 )
+        {
+            return MultivariateMonomialMR::GrLexCompare( m1, m2 );
+        }
+    };
+
+    /**
+     * Policy for the graded reverse lexicographical order, see MultivariateMonomialMR::GrRevLexCompare.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     */
+    struct GrRevLexOrder
+    {
+        static inline bool less( const MultivariateMonomialMR& m1, const MultivariateMonomialMR& m2 )
+        {
+            return MultivariateMonomialMR::GrRevLexCompare( m1, m2 );
+        }
+    };
+
+    ////////////////////
+    // Runtime orders //
+    ////////////////////
+
+    /**
+     * A weighted monomial order: monomials are compared by their weighted degree first, ties are broken by a given
+     * order. Variables without a given weight have the default weight.
+     *
+     * The weights have to be non-negative, which is guaranteed by the type, and the tie break order has to be a
+     * monomial order. Then the result is a monomial order, too.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     */
+    class WeightedOrder
+    {
+        public:
+
+            /**
+             * @param weights the weights of the variables x_0, x_1, ... in this order
+             * @param defaultWeight the weight of the variables with an index beyond the given weights
+             * @param tieBreak the order deciding between monomials of the same weight
+             */
+            WeightedOrder( const std::vector<unsigned>& weights, unsigned defaultWeight = 1, MonomOrderingFc tieBreak = MultivariateMonomialMR::GrRevLexCompare ):
+                mWeights( weights ),
+                mDefaultWeight( defaultWeight ),
+                mTieBreak( tieBreak )
+            {}
+
+            /**
+             * @param m
+             * @return the weighted degree of the monomial m
+             */
+            inline unsigned long weight( const MultivariateMonomialMR& m ) const
+            {
+                unsigned long result = 0;
+                for( vui_cIt it = m.begin(); it != m.end(); ++it )
+                    result += (unsigned long)(it->first < mWeights.size() ? mWeights[it->first] : mDefaultWeight) * it->second;
+                return result;
+            }
+
+            /**
+             * @param m1
+             * @param m2
+             * @return true iff m1 < m2
+             */
+            inline bool less( const MultivariateMonomialMR& m1, const MultivariateMonomialMR& m2 ) const
+            {
+                unsigned long w1 = weight( m1 );
+                unsigned long w2 = weight( m2 );
+                if( w1 != w2 )
+                    return w1 < w2;
+                return mTieBreak( m1, m2 );
+            }
+
+            inline const std::vector<unsigned>& weights() const
+            {
+                return mWeights;
+            }
+
+            inline unsigned defaultWeight() const
+            {
+                return mDefaultWeight;
+            }
+
+            inline MonomOrderingFc tieBreak() const
+            {
+                return mTieBreak;
+            }
+
+            friend bool operator ==( const WeightedOrder& o1, const WeightedOrder& o2 )
+            {
+                return o1.mWeights == o2.mWeights && o1.mDefaultWeight == o2.mDefaultWeight && o1.mTieBreak == o2.mTieBreak;
+            }
+
+        private:
+            std::vector<unsigned> mWeights;
+            unsigned              mDefaultWeight;
+            MonomOrderingFc       mTieBreak;
+    };
+
+    /**
+     * A block order eliminating the variables x_0, ..., x_{k-1}: every monomial containing one of these variables is
+     * bigger than all monomials in the remaining variables. A Groebner basis with respect to this order contains a
+     * Groebner basis of the elimination ideal in the remaining variables.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     */
+    class BlockOrder:
+        public WeightedOrder
+    {
+        public:
+
+            /**
+             * @param blockSize the number k of variables to eliminate
+             * @param tieBreak the order deciding between monomials of the same degree in the eliminated variables
+             */
+            BlockOrder( unsigned blockSize, MonomOrderingFc tieBreak = MultivariateMonomialMR::GrRevLexCompare ):
+                WeightedOrder( std::vector<unsigned>( blockSize, 1 ), 0, tieBreak )
+            {}
+    };
+}
+
+#endif
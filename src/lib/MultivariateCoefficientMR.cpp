@@ -21,6 +21,9 @@
 
 
 #include "MultivariateCoefficientMR.h"
+#include "RationalCoefficientMR.h"
+#include "IntegerCoefficientMR.h"
+#include "ModularCoefficientMR.h"
 
 namespace GiNaCRA
 {
@@ -32,6 +35,18 @@ namespace GiNaCRA
         mCoefficient( expr )
     {}
 
+    MultivariateCoefficientMR::MultivariateCoefficientMR( const RationalCoefficientMR& c ):
+        mCoefficient( c.getExpression() )
+    {}
+
+    MultivariateCoefficientMR::MultivariateCoefficientMR( const IntegerCoefficientMR& c ):
+        mCoefficient( c.getExpression() )
+    {}
+
+    MultivariateCoefficientMR::MultivariateCoefficientMR( const ModularCoefficientMR& c ):
+        mCoefficient( c.getExpression() )
+    {}
+
     bool operator ==( const MultivariateCoefficientMR& m1, const MultivariateCoefficientMR& m2 )
     {
         return m1.mCoefficient == m2.mCoefficient;
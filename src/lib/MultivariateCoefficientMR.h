@@ -28,18 +28,35 @@
 
 namespace GiNaCRA
 {
+    class RationalCoefficientMR;
+    class IntegerCoefficientMR;
+    class ModularCoefficientMR;
+
     /**
      * Class encapsulating expressions as coefficients of the terms.
      *
+     * This is the coefficient domain for polynomials with symbolic parameters. For numeric coefficients, the domains
+     * RationalCoefficientMR, IntegerCoefficientMR and ModularCoefficientMR avoid the overhead of the GiNaC evaluator.
+     *
      * @author Sebastian Junges
      * @since 2011-12-07
-     * @version 2011-12-08
+     * @version 2026-10-18
      */
     class MultivariateCoefficientMR
     {
         public:
+            /// Non-numeric coefficients are treated as field elements; inverse() fails on them.
+            static const bool isField = true;
+            /// Only numeric coefficients are ordered, isNegative() is false for all other expressions, so users of the ordering have to reject them.
+            static const bool isOrdered = true;
+            /// The reference counting of GiNaC expressions is not synchronized.
+            static const bool isThreadSafe = false;
+
             MultivariateCoefficientMR();
             MultivariateCoefficientMR( const GiNaC::ex& );
+            explicit MultivariateCoefficientMR( const RationalCoefficientMR& c );
+            explicit MultivariateCoefficientMR( const IntegerCoefficientMR& c );
+            explicit MultivariateCoefficientMR( const ModularCoefficientMR& c );
             friend bool operator ==( const MultivariateCoefficientMR& m1, const MultivariateCoefficientMR& m2 );
             friend const MultivariateCoefficientMR operator *( const MultivariateCoefficientMR& m1, const MultivariateCoefficientMR& m2 );
             friend const MultivariateCoefficientMR operator +( const MultivariateCoefficientMR& m1, const MultivariateCoefficientMR& m2 );
@@ -48,11 +65,34 @@ namespace GiNaCRA
             friend const MultivariateCoefficientMR operator /( const MultivariateCoefficientMR& m1, const MultivariateCoefficientMR& m2 );
             friend std::ostream& operator <<( std::ostream& os, const MultivariateCoefficientMR& m1 );
 
+            /**
+             * @param m1
+             * @param m2
+             * @return the polynomial greatest common divisor of the two expressions
+             */
+            static MultivariateCoefficientMR gcd( const MultivariateCoefficientMR& m1, const MultivariateCoefficientMR& m2 )
+            {
+                return MultivariateCoefficientMR( GiNaC::gcd( m1.mCoefficient, m2.mCoefficient ));
+            }
+
             inline GiNaC::ex getExpression() const
             {
                 return mCoefficient;
             }
 
+            inline bool isZero() const
+            {
+                return mCoefficient.is_zero();
+            }
+
+            /**
+             * @return true iff the coefficient is a negative number
+             */
+            inline bool isNegative() const
+            {
+                return GiNaC::is_exactly_a<GiNaC::numeric>( mCoefficient ) && GiNaC::ex_to<GiNaC::numeric>( mCoefficient ).is_negative();
+            }
+
             inline MultivariateCoefficientMR inverse() const
             {
                 if( GiNaC::is_exactly_a<GiNaC::numeric>( mCoefficient ))
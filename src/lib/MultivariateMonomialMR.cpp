@@ -27,7 +27,7 @@
  *
  * @author Sebastian Junges
  * @since 2011-11-26
- * @version 2011-11-26
+ * @version 2026-10-18
  * @see ISBN 0-387-94090-1 and ISBN-13: 978-3642069642
  *
  * Notation is following http://www.possibility.com/Cpp/CppCodingStandard.html.
@@ -152,82 +152,87 @@ namespace GiNaCRA
         }
     }
 
-    bool operator ==( const MultivariateMonomialMR& lhs, const MultivariateMonomialMR& rhs )
-    {
-        if( lhs.mTotDeg != rhs.mTotDeg )
-            return false;
-        return (lhs.mExponents == rhs.mExponents);
-    }
-
-    bool operator !=( const MultivariateMonomialMR& lhs, const MultivariateMonomialMR& rhs )
+    unsigned MultivariateMonomialMR::exponentOf( unsigned varIndex ) const
     {
-        return !(lhs == rhs);
-    }
-
-    std::ostream& operator <<( ostream& os, const MultivariateMonomialMR& rhs )
-    {
-        os << "[";
-        for( vui_cIt it = rhs.mExponents.begin(); it != rhs.mExponents.end(); ++it )
+        for( vui_cIt it = mExponents.begin(); it != mExponents.end() && it->first <= varIndex; ++it )
         {
-            os << "x_" << it->first << "^" << it->second;
+            if( it->first == varIndex )
+                return it->second;
         }
-        return (os << "]");
+        return 0;
     }
 
-    bool MultivariateMonomialMR::LexCompare( const MultivariateMonomialMR& m1, const MultivariateMonomialMR& m2 )
+    bool MultivariateMonomialMR::dividable( const MultivariateMonomialMR& denom ) const
     {
-        if( m1.tdeg() == 0 && m2.tdeg() != 0 )
+        if( denom.mExponents.empty() )
             return true;
-        if( m2.tdeg() == 0 )
+        if( mTotDeg < denom.mTotDeg )
             return false;
-        vui_cIt m1it = m1.mExponents.begin();
-        vui_cIt m2it = m2.mExponents.begin();
 
-        while( m1it != m1.mExponents.end() )
+        vui_cIt t1it  = mExponents.begin();
+        vui_cIt m1it  = denom.mExponents.begin();
+        vui_cIt t1end = mExponents.end();
+        vui_cIt m1end = denom.mExponents.end();
+
+        //is it dividable?
+
+        while( true )
         {
-            if( m2it == m2.mExponents.end() )
-                return false;
-            //which variable occurs first
-            if( m1it->first == m2it->first )
+            while( t1it->first == m1it->first )
             {
-                //equal variables
-                if( m1it->second < m2it->second )
+                if( t1it->second < m1it->second )
+                    return false;
+                ++t1it;
+                ++m1it;
+                if( m1it == m1end )
                     return true;
-                if( m1it->second > m2it->second )
+                if( t1it == t1end )
                     return false;
             }
-            else
+            while( t1it->first < m1it->first )
             {
-                return (m1it->first > m2it->first);
+                ++t1it;
+                if( t1it == t1end )
+                    return false;
             }
-            ++m1it;
-            ++m2it;
+            if( t1it->first > m1it->first )
+                return false;
         }
-        if( m2it == m2.mExponents.end() )
-            return false;
+
         return true;
     }
 
-    bool MultivariateMonomialMR::GrLexCompare( const MultivariateMonomialMR& m1, const MultivariateMonomialMR& m2 )
+    DivisorMask MultivariateMonomialMR::divisorMask() const
     {
-        unsigned m1deg = m1.tdeg();
-        unsigned m2deg = m2.tdeg();
-        if( m1deg > m2deg )
-            return false;
-        if( m2deg > m1deg )
-            return true;
-        return LexCompare( m1, m2 );
+        DivisorMask mask = 0;
+        for( vui_cIt it = mExponents.begin(); it != mExponents.end(); ++it )
+        {
+            unsigned bits = it->second < 4 ? it->second : 4;
+            mask |= (((DivisorMask)1 << bits) - 1) << (4 * (it->first % 16));
+        }
+        return mask;
     }
 
-    bool MultivariateMonomialMR::GrRevLexCompare( const MultivariateMonomialMR& m1, const MultivariateMonomialMR& m2 )
+    bool operator ==( const MultivariateMonomialMR& lhs, const MultivariateMonomialMR& rhs )
     {
-        unsigned m1deg = m1.tdeg();
-        unsigned m2deg = m2.tdeg();
-        if( m1deg > m2deg )
+        if( lhs.mTotDeg != rhs.mTotDeg )
             return false;
-        if( m2deg > m1deg )
-            return true;
-        return LexCompare( m2, m1 );
+        return (lhs.mExponents == rhs.mExponents);
+    }
+
+    bool operator !=( const MultivariateMonomialMR& lhs, const MultivariateMonomialMR& rhs )
+    {
+        return !(lhs == rhs);
+    }
+
+    std::ostream& operator <<( ostream& os, const MultivariateMonomialMR& rhs )
+    {
+        os << "[";
+        for( vui_cIt it = rhs.mExponents.begin(); it != rhs.mExponents.end(); ++it )
+        {
+            os << "x_" << it->first << "^" << it->second;
+        }
+        return (os << "]");
     }
 
     const MultivariateMonomialMR operator *( const MultivariateMonomialMR& m1, const MultivariateMonomialMR& m2 )
@@ -291,4 +296,27 @@ namespace GiNaCRA
           return (lhs.mVariables.size() == rhs.mVariables.size()) && (std::equal(lhs.mVariables.begin(), lhs.mVariables.end(), rhs.mVariables.begin()));
       }*/
 
+    const MultivariateMonomialMR operator /( const MultivariateMonomialMR& nom, const MultivariateMonomialMR& denom )
+    {
+        if( !nom.dividable( denom ))
+            throw std::invalid_argument( "The monomial is not divisible by the denominator." );
+
+        MultivariateMonomialMR newMon( nom.mExponents.size() );
+        newMon.mTotDeg = nom.mTotDeg - denom.mTotDeg;
+
+        vui_cIt denomIt = denom.mExponents.begin();
+        for( vui_cIt nomIt = nom.mExponents.begin(); nomIt != nom.mExponents.end(); ++nomIt )
+        {
+            unsigned deg = nomIt->second;
+            if( denomIt != denom.mExponents.end() && denomIt->first == nomIt->first )
+            {
+                deg -= denomIt->second;
+                ++denomIt;
+            }
+            if( deg != 0 )
+                newMon.mExponents.push_back( pui( nomIt->first, deg ));
+        }
+        return newMon;
+    }
+
 }
@@ -30,20 +30,24 @@
 #include <iostream>
 #include <numeric>
 #include <vector>
+#include <stdint.h>
 
 namespace GiNaCRA
 {
     typedef std::pair<unsigned, unsigned>    pui;
     typedef std::vector<pui>::const_iterator vui_cIt;
+    /// a 64 bit signature of a monomial, see MultivariateMonomialMR::divisorMask
+    typedef uint64_t                         DivisorMask;
 
-    class MultivariateTermMR;
+    template<class Coeff>
+    class MultivariateTermMRT;
 
     /**
      * A class for a multivariate monomial providing a degree-based representation.
      *
      * @author Sebastian Junges
      * @since 2010-11-26
-     * @version 2011-12-15
+     * @version 2026-10-18
      * @see ISBN 0-387-94090-1 and ISBN-13: 978-3642069642
      *
      * Notation is following http://www.possibility.com/Cpp/CppCodingStandard.html.
@@ -51,7 +55,8 @@ namespace GiNaCRA
     class MultivariateMonomialMR
     {
         public:
-            friend class MultivariateTermMR;
+            template<class Coeff>
+            friend class MultivariateTermMRT;
             MultivariateMonomialMR();
 
             /**
@@ -89,6 +94,36 @@ namespace GiNaCRA
                 return (tdeg() == 0);
             }
 
+            /**
+             * @param varIndex the index of the variable in the global list
+             * @return the exponent of the variable
+             */
+            unsigned exponentOf( unsigned varIndex ) const;
+
+            /**
+             * @return one more than the largest index of a variable occurring in the monomial, 0 for the constant monomial
+             */
+            inline unsigned nrOfVariables() const
+            {
+                return mExponents.empty() ? 0 : mExponents.back().first + 1;
+            }
+
+            /**
+             * @return an iterator to the first pair of a variable index and its non-zero exponent, ordered by the indices
+             */
+            inline vui_cIt begin() const
+            {
+                return mExponents.begin();
+            }
+
+            /**
+             * @return an iterator behind the last pair of a variable index and its exponent
+             */
+            inline vui_cIt end() const
+            {
+                return mExponents.end();
+            }
+
             //InternalMultivariateMonomialMR& operator=(const InternalMultivariateMonomialMR& rhs);
             //InternalMultivariateMonomialMR& operator*=(const InternalMultivariateMonomialMR& rhs);
             //InternalMultivariateMonomialMR& operator/=(const InternalMultivariateMonomialMR& rhs);
@@ -116,6 +151,30 @@ namespace GiNaCRA
              */
             static const MultivariateMonomialMR lcm( const MultivariateMonomialMR& m1, const MultivariateMonomialMR& m2 );
 
+            /**
+             * @param denom
+             * @return true, iff denom divides this monomial
+             */
+            bool dividable( const MultivariateMonomialMR& denom ) const;
+
+            /**
+             * Computes the short divisor mask of the monomial. The variable x_k owns the four bits starting at
+             * 4 * (k mod 16), of which the lowest min(e, 4) are set for the exponent e. Hence, if denom divides this
+             * monomial, every bit of the mask of denom is set in the mask of this monomial, see maskAllowsDivision.
+             * @return the short divisor mask
+             */
+            DivisorMask divisorMask() const;
+
+            /**
+             * @param mask the divisor mask of a monomial m
+             * @param denomMask the divisor mask of a monomial d
+             * @return false, if d does not divide m; true, if d may divide m
+             */
+            static inline bool maskAllowsDivision( DivisorMask mask, DivisorMask denomMask )
+            {
+                return (denomMask & ~mask) == 0;
+            }
+
             /**
              *
              * @param m1
@@ -148,5 +207,63 @@ namespace GiNaCRA
 
     };
 
+    // The orderings are defined here so that they can be inlined into the comparators of the term sets.
+
+    inline bool MultivariateMonomialMR::LexCompare( const MultivariateMonomialMR& m1, const MultivariateMonomialMR& m2 )
+    {
+        if( m1.tdeg() == 0 && m2.tdeg() != 0 )
+            return true;
+        if( m2.tdeg() == 0 )
+            return false;
+        vui_cIt m1it = m1.mExponents.begin();
+        vui_cIt m2it = m2.mExponents.begin();
+
+        while( m1it != m1.mExponents.end() )
+        {
+            if( m2it == m2.mExponents.end() )
+                return false;
+            //which variable occurs first
+            if( m1it->first == m2it->first )
+            {
+                //equal variables
+                if( m1it->second < m2it->second )
+                    return true;
+                if( m1it->second > m2it->second )
+                    return false;
+            }
+            else
+            {
+                return (m1it->first > m2it->first);
+            }
+            ++m1it;
+            ++m2it;
+        }
+        if( m2it == m2.mExponents.end() )
+            return false;
+        return true;
+    }
+
+    inline bool MultivariateMonomialMR::GrLexCompare( const MultivariateMonomialMR& m1, const MultivariateMonomialMR& m2 )
+    {
+        unsigned m1deg = m1.tdeg();
+        unsigned m2deg = m2.tdeg();
+        if( m1deg > m2deg )
+            return false;
+        if( m2deg > m1deg )
+            return true;
+        return LexCompare( m1, m2 );
+    }
+
+    inline bool MultivariateMonomialMR::GrRevLexCompare( const MultivariateMonomialMR& m1, const MultivariateMonomialMR& m2 )
+    {
+        unsigned m1deg = m1.tdeg();
+        unsigned m2deg = m2.tdeg();
+        if( m1deg > m2deg )
+            return false;
+        if( m2deg > m1deg )
+            return true;
+        return LexCompare( m2, m1 );
+    }
+
 }
 #endif
@@ -20,6 +20,7 @@
  */
 
 
+
 #ifndef GINACRA_MULTIVARIATEPOLYNOMIALMR_H
 #define GINACRA_MULTIVARIATEPOLYNOMIALMR_H
 
@@ -28,10 +29,17 @@
 #include <ginac/ginac.h>
 #include <iostream>
 #include <stdexcept>
+#include <iterator>
+#include <list>
+#include <tr1/memory>
+#include <set>
+#include <vector>
 
 #include "Polynomial.h"
 #include "utilities.h"
 #include "MultivariateTermMR.h"
+#include "MonomialOrder.h"
+#include "MonomialDivisorIndex.h"
 
 using std::vector;
 using std::invalid_argument;
@@ -40,32 +48,47 @@ using GiNaC::ex;
 
 namespace GiNaCRA
 {
-    typedef bool (*MonomOrderingFc)( const MultivariateMonomialMR&, const MultivariateMonomialMR& );
-
     typedef std::set<MultivariateTermMR>::iterator         sMT_It;
     typedef std::set<MultivariateTermMR>::const_iterator   sMT_cIt;
     typedef std::set<MultivariateTermMR>::reverse_iterator sMT_rIt;
 
     /**
      * A class for comparing MultivariateMonomials according to a given function
+     *
+     * The built-in orders LexCompare, GrLexCompare and GrRevLexCompare are recognized and dispatched to their inline
+     * policies (see MonomialOrder.h), so that comparisons in the term sets do not go through a function pointer.
+     * Besides, weighted and block orders are supported.
+     *
      * @author Sebastian Junges
      * @since 2011-11-28
+     * @version 2026-10-18
      */
     class MonomMRCompare:
         public std:: binary_function<MultivariateMonomialMR, MultivariateMonomialMR, bool>
     {
         public:
 
-            MonomMRCompare()
-            {
-                mOrderFunc = MultivariateMonomialMR::GrLexCompare;
-            }
+            MonomMRCompare():
+                mOrderFunc( MultivariateMonomialMR::GrLexCompare ),
+                mKind( GRLEX_ORDER )
+            {}
 
-            MonomMRCompare( const MonomOrderingFc ordering )
+            MonomMRCompare( const MonomOrderingFc ordering ):
+                mOrderFunc( NULL ),
+                mKind( FUNCTION_ORDER )
             {
-                mOrderFunc = ordering;
+                SetMonomOrdering( ordering );
             }
 
+            /**
+             * @param ordering a weighted or block order
+             */
+            MonomMRCompare( const WeightedOrder& ordering ):
+                mOrderFunc( NULL ),
+                mKind( WEIGHTED_ORDER ),
+                mWeightedOrder( new WeightedOrder( ordering ))
+            {}
+
             /**
              *
              * @param ordering
@@ -76,50 +99,99 @@ namespace GiNaCRA
                 if( ordering == mOrderFunc )
                     return false;
                 mOrderFunc = ordering;
+                mWeightedOrder.reset();
+                if( ordering == MultivariateMonomialMR::LexCompare )
+                    mKind = LEX_ORDER;
+                else if( ordering == MultivariateMonomialMR::GrLexCompare )
+                    mKind = GRLEX_ORDER;
+                else if( ordering == MultivariateMonomialMR::GrRevLexCompare )
+                    mKind = GRREVLEX_ORDER;
+                else
+                    mKind = FUNCTION_ORDER;
                 return false;
             }
 
+            /**
+             * @return the ordering function, or NULL if the order is a weighted order
+             */
             inline MonomOrderingFc GetMonomOrdering() const
             {
                 return mOrderFunc;
             }
 
-            inline bool operator ()( const MultivariateMonomialMR& m1, const MultivariateMonomialMR& m2 )
+            /**
+             * @return the weighted order, or NULL if the order is given by a function
+             */
+            inline const WeightedOrder* GetWeightedOrder() const
             {
-                return mOrderFunc( m1, m2 );
+                return mWeightedOrder.get();
+            }
+
+            inline bool operator ()( const MultivariateMonomialMR& m1, const MultivariateMonomialMR& m2 ) const
+            {
+                switch( mKind )
+                {
+                    case LEX_ORDER:
+                        return LexOrder::less( m1, m2 );
+                    case GRLEX_ORDER:
+                        return GrLexOrder::less( m1, m2 );
+                    case GRREVLEX_ORDER:
+                        return GrRevLexOrder::less( m1, m2 );
+                    case WEIGHTED_ORDER:
+                        return mWeightedOrder->less( m1, m2 );
+                    default:
+                        return mOrderFunc( m1, m2 );
+                }
             }
 
             friend bool operator !=( const MonomMRCompare& m1, const MonomMRCompare& m2 );
 
         private:
+            enum OrderKind{ LEX_ORDER, GRLEX_ORDER, GRREVLEX_ORDER, FUNCTION_ORDER, WEIGHTED_ORDER };
+
             MonomOrderingFc mOrderFunc;
+            OrderKind       mKind;
+            /// shared between copies, as the order is immutable
+            std::tr1::shared_ptr<const WeightedOrder> mWeightedOrder;
 
     };
 
     /**
      * A class for a multivariate polynomial providing a degree-based representation.
      *
+     * The template parameter is the coefficient domain, see MultivariateTermMRT for its requirements. If the domain is
+     * no field (Coeff::isField is false), the S-polynomials and remainders are computed fraction-free, i.e., they are
+     * only determined up to a non-zero constant factor.
+     *
      * @author Sebastian Junges
      * @since 2011-11-26
-     * @version 2012-01-31
+     * @version 2026-10-18
      */
-    class MultivariatePolynomialMR
+    template<class Coeff>
+    class MultivariatePolynomialMRT
     {
         public:
-            MultivariatePolynomialMR();
+            typedef Coeff                                     CoefficientType;
+            typedef MultivariateTermMRT<Coeff>                Term;
+            typedef std::set<Term, MonomMRCompare>            TermSet;
+            typedef typename TermSet::iterator                TermIt;
+            typedef typename TermSet::const_iterator          TermcIt;
+            typedef typename TermSet::const_reverse_iterator  TermcrIt;
+
+            MultivariatePolynomialMRT();
 
             /**
              *
              * @param comp
              */
-            MultivariatePolynomialMR( const MonomMRCompare& comp );
+            MultivariatePolynomialMRT( const MonomMRCompare& comp );
 
             /**
              *
              * @param t1
              * @param comp
              */
-            MultivariatePolynomialMR( const MultivariateTermMR& t1, const MonomMRCompare& comp );
+            MultivariatePolynomialMRT( const Term& t1, const MonomMRCompare& comp );
 
             /**
              *
@@ -127,7 +199,7 @@ namespace GiNaCRA
              * @param t2
              * @param comp
              */
-            MultivariatePolynomialMR( const MultivariateTermMR& t1, const MultivariateTermMR& t2, const MonomMRCompare& comp );
+            MultivariatePolynomialMRT( const Term& t1, const Term& t2, const MonomMRCompare& comp );
 
             /**
              *
@@ -135,14 +207,14 @@ namespace GiNaCRA
              * @param last
              * @param comp
              */
-            MultivariatePolynomialMR( sMT_It begin, sMT_It last, const MonomMRCompare& comp );
+            MultivariatePolynomialMRT( TermcIt begin, TermcIt last, const MonomMRCompare& comp );
 
             /**
              * Constructs a multivariate polynomial with standard variables using graded degree lexicographic monomial ordering.
              * @param expr a polynomial
              * @param cmp the ordering
              */
-            MultivariatePolynomialMR( const GiNaC::ex& expr, const MonomMRCompare& cmp );
+            MultivariatePolynomialMRT( const GiNaC::ex& expr, const MonomMRCompare& cmp );
 
             /**
              * Creates an object with the sum of the given terms
@@ -152,7 +224,24 @@ namespace GiNaCRA
              * @param last2
              * @param comp Monomial Ordering. Note that if this is different from the order of the sets 1 and 2, the creation of the object is slow.
              */
-            MultivariatePolynomialMR( const sMT_It begin1, const sMT_It last1, const sMT_It begin2, const sMT_It last2, const MonomMRCompare& comp );
+            MultivariatePolynomialMRT( TermcIt begin1, TermcIt last1, TermcIt begin2, TermcIt last2, const MonomMRCompare& comp );
+
+            /**
+             * Converts a polynomial over another coefficient domain, keeping its ordering.
+             * @param p
+             */
+            template<class OtherCoeff>
+            explicit MultivariatePolynomialMRT( const MultivariatePolynomialMRT<OtherCoeff>& p ):
+                mCmp( p.getMonomOrder() ),
+                mTerms( mCmp )
+            {
+                for( typename MultivariatePolynomialMRT<OtherCoeff>::TermcIt it = p.begin(); it != p.end(); ++it )
+                {
+                    Term t = Term( *it );
+                    if( !t.getCoeff().isZero() )
+                        mTerms.insert( mTerms.end(), t );
+                }
+            }
 
             /**
              *
@@ -163,7 +252,7 @@ namespace GiNaCRA
                 return mCmp.GetMonomOrdering();
             }
 
-            inline MonomMRCompare getMonomOrder() const
+            inline const MonomMRCompare& getMonomOrder() const
             {
                 return mCmp;
             }
@@ -182,6 +271,19 @@ namespace GiNaCRA
                 return mTerms.size() == 1 && mTerms.begin()->constant();
             }
 
+            /**
+             * @return true, if all terms have the same total degree
+             */
+            inline bool isHomogeneous() const
+            {
+                for( TermcIt t = mTerms.begin(); t != mTerms.end(); ++t )
+                {
+                    if( t->tdeg() != mTerms.begin()->tdeg() )
+                        return false;
+                }
+                return true;
+            }
+
             /**
              * @return The leading monomial with respect to the current ordering
              */
@@ -198,19 +300,19 @@ namespace GiNaCRA
             /**
              * @return the leading term with respect to the current ordering
              */
-            inline MultivariateTermMR lterm() const
+            inline Term lterm() const
             {
                 if( !isZero() )
                     return *mTerms.rbegin();
-                return MultivariateTermMR();
+                return Term();
             }
 
             /**
              * @return the coefficient of the leading term
              */
-            inline GiNaC::ex lcoeff() const
+            inline const Coeff& lcoeff() const
             {
-                return mTerms.rbegin()->getCoeffExpr();
+                return mTerms.rbegin()->getCoeff();
             }
 
             /**
@@ -222,13 +324,51 @@ namespace GiNaCRA
                 return mTerms.size();
             }
 
+            /**
+             * @return the maximal total degree of the terms, or 0 for the zero polynomial
+             * @rcomplexity linear in the number of terms
+             */
+            unsigned tdeg() const
+            {
+                unsigned deg = 0;
+                for( TermcIt it = mTerms.begin(); it != mTerms.end(); ++it )
+                    deg = std::max( deg, it->tdeg() );
+                return deg;
+            }
+
+            /**
+             * @return an iterator to the smallest term
+             */
+            inline TermcIt begin() const
+            {
+                return mTerms.begin();
+            }
+
+            inline TermcIt end() const
+            {
+                return mTerms.end();
+            }
+
+            /**
+             * @return a reverse iterator to the leading term
+             */
+            inline TermcrIt rbegin() const
+            {
+                return mTerms.rbegin();
+            }
+
+            inline TermcrIt rend() const
+            {
+                return mTerms.rend();
+            }
+
             /**
              *
              * @return a MultivariatePolynomial without the leading term.
              */
-            inline const MultivariatePolynomialMR truncLT() const
+            inline const MultivariatePolynomialMRT truncLT() const
             {
-                return MultivariatePolynomialMR( (mTerms.begin()), --(mTerms.end()), mCmp );
+                return MultivariatePolynomialMRT( (mTerms.begin()), --(mTerms.end()), mCmp );
             }
 
             /**
@@ -237,23 +377,73 @@ namespace GiNaCRA
              */
             GiNaC::ex toEx() const;
 
-            friend bool operator ==( const MultivariatePolynomialMR& p1, const MultivariatePolynomialMR& p2 );
-            friend bool operator !=( const MultivariatePolynomialMR& p1, const MultivariatePolynomialMR& p2 );
+            friend bool operator ==( const MultivariatePolynomialMRT& p1, const MultivariatePolynomialMRT& p2 )
+            {
+                //TODO what to do with different ordering?!
+                if( p1.mTerms.size() != p2.mTerms.size() )
+                    return false;
+                return std::equal( p1.mTerms.begin(), p1.mTerms.end(), p2.mTerms.begin() );
+            }
+
+            friend bool operator !=( const MultivariatePolynomialMRT& p1, const MultivariatePolynomialMRT& p2 )
+            {
+                return !(p1 == p2);
+            }
+
+            friend const MultivariatePolynomialMRT operator +( const MultivariatePolynomialMRT& p1, const MultivariatePolynomialMRT& p2 )
+            {
+                return p1.add( p2 );
+            }
+
+            friend const MultivariatePolynomialMRT operator +( const MultivariatePolynomialMRT& p1, const Term& t1 )
+            {
+                return p1.add( t1 );
+            }
 
-            friend const MultivariatePolynomialMR operator +( const MultivariatePolynomialMR& p1, const MultivariatePolynomialMR& p2 );
-            friend const MultivariatePolynomialMR operator +( const MultivariatePolynomialMR& p1, const MultivariateTermMR& t1 );
-            friend const MultivariatePolynomialMR operator +( const MultivariateTermMR& t1, MultivariatePolynomialMR& p1 );
-            friend const MultivariatePolynomialMR operator +( const MultivariatePolynomialMR& p1, const MultivariateMonomialMR& m1 );
-            friend const MultivariatePolynomialMR operator +( const MultivariateMonomialMR& m1, const MultivariatePolynomialMR& p1 );
+            friend const MultivariatePolynomialMRT operator +( const Term& t1, MultivariatePolynomialMRT& p1 )
+            {
+                return p1.add( t1 );
+            }
 
-            friend const MultivariatePolynomialMR operator -( const MultivariatePolynomialMR& p1, const MultivariatePolynomialMR& p2 );
-            friend const MultivariatePolynomialMR operator -( const MultivariatePolynomialMR& p1 );
+            friend const MultivariatePolynomialMRT operator +( const MultivariatePolynomialMRT& p1, const MultivariateMonomialMR& m1 )
+            {
+                return p1.add( Term( m1 ));
+            }
 
-            //friend const MultivariatePolynomialMR operator*(const MultivariatePolynomialMR& p1, const MultivariatePolynomialMR& p2);
-            friend const MultivariatePolynomialMR operator *( const MultivariatePolynomialMR& p1, const MultivariateTermMR& t1 );
-            friend const MultivariatePolynomialMR operator *( const MultivariateTermMR& t1, MultivariatePolynomialMR& p1 );
-            friend const MultivariatePolynomialMR operator *( const MultivariatePolynomialMR& p1, const MultivariateMonomialMR& m1 );
-            friend const MultivariatePolynomialMR operator *( const MultivariateMonomialMR& m1, const MultivariatePolynomialMR& p1 );
+            friend const MultivariatePolynomialMRT operator +( const MultivariateMonomialMR& m1, const MultivariatePolynomialMRT& p1 )
+            {
+                return p1.add( Term( m1 ));
+            }
+
+            friend const MultivariatePolynomialMRT operator -( const MultivariatePolynomialMRT& p1, const MultivariatePolynomialMRT& p2 )
+            {
+                return p1.subtract( p2 );
+            }
+
+            friend const MultivariatePolynomialMRT operator -( const MultivariatePolynomialMRT& p1 )
+            {
+                return p1.negate();
+            }
+
+            friend const MultivariatePolynomialMRT operator *( const MultivariatePolynomialMRT& p1, const Term& t1 )
+            {
+                return p1.multiply( t1 );
+            }
+
+            friend const MultivariatePolynomialMRT operator *( const Term& t1, MultivariatePolynomialMRT& p1 )
+            {
+                return p1.multiply( t1 );
+            }
+
+            friend const MultivariatePolynomialMRT operator *( const MultivariatePolynomialMRT& p1, const MultivariateMonomialMR& m1 )
+            {
+                return p1.multiply( m1 );
+            }
+
+            friend const MultivariatePolynomialMRT operator *( const MultivariateMonomialMR& m1, const MultivariatePolynomialMRT& p1 )
+            {
+                return p1.multiply( m1 );
+            }
 
             /**
              *
@@ -261,7 +451,14 @@ namespace GiNaCRA
              * @param rhs
              * @return
              */
-            friend std::ostream& operator <<( std::ostream& os, const MultivariatePolynomialMR& rhs );
+            friend std::ostream& operator <<( std::ostream& os, const MultivariatePolynomialMRT& rhs )
+            {
+                for( TermcrIt it = rhs.mTerms.rbegin(); it != rhs.mTerms.rend(); ++it )
+                {
+                    os << *it << " ";
+                }
+                return os;
+            }
 
             /**
              * Calculates the S-polynomial of p1 and p2
@@ -269,44 +466,109 @@ namespace GiNaCRA
              * @param p2
              * @return S-Polynomial
              */
-            static const MultivariatePolynomialMR SPol( const MultivariatePolynomialMR& p1, const MultivariatePolynomialMR& p2 );
+            static const MultivariatePolynomialMRT SPol( const MultivariatePolynomialMRT& p1, const MultivariatePolynomialMRT& p2 );
 
             /**
              * Calculates the remainder with respect to the ideal.
              * @param ideallistBegin
-             * @param ideallistEnd
+             * @param ideallistEnd iterators over polynomials, or over objects derived from them
              * @return
              */
-            MultivariatePolynomialMR CalculateRemainder( std::list<MultivariatePolynomialMR>::const_iterator ideallistBegin,
-                                                         std::list<MultivariatePolynomialMR>::const_iterator ideallistEnd ) const;
+            template<class InputIterator>
+            MultivariatePolynomialMRT CalculateRemainder( InputIterator ideallistBegin, InputIterator ideallistEnd ) const;
 
             /**
-             *
+             * Calculates the remainder with respect to the ideal and records which polynomials were used as divisors.
+             * @param ideallistBegin
+             * @param ideallistEnd iterators over polynomials, or over objects derived from them
+             * @param used receives a flag for each polynomial in the given range, which is true iff it was used
+             * @return
+             */
+            template<class InputIterator>
+            MultivariatePolynomialMRT CalculateRemainder( InputIterator ideallistBegin, InputIterator ideallistEnd, std::vector<bool>& used ) const;
+
+            /**
+             * Calculates the remainder with respect to the ideal whose leading monomials are already indexed.
+             * @param divisors an index over the polynomials generating the ideal
+             * @return
+             */
+            template<class Iterator>
+            MultivariatePolynomialMRT CalculateRemainder( const PolynomialDivisorIndex<Iterator>& divisors ) const;
+
+            /**
+             * Calculates the remainder with respect to the ideal whose leading monomials are already indexed, and records which polynomials
+             * were used as divisors.
+             * @param divisors an index over the polynomials generating the ideal
+             * @param used receives a flag for each polynomial in the index, which is true iff it was used
+             * @return
+             */
+            template<class Iterator>
+            MultivariatePolynomialMRT CalculateRemainder( const PolynomialDivisorIndex<Iterator>& divisors, std::vector<bool>& used ) const;
+
+            /**
+             * @return the polynomial divided by its leading coefficient, or, over a domain which is no field, divided by
+             * the gcd of its coefficients such that the leading coefficient is not negative
              */
-            MultivariatePolynomialMR normalized();
+            MultivariatePolynomialMRT normalized() const;
 
             /**
              *
              * @param t1
              * @return
              */
-            inline MultivariatePolynomialMR multiply( const MultivariateTermMR& t1 ) const
-            {
-                return (*this) * t1;
-            }
+            MultivariatePolynomialMRT multiply( const Term& t1 ) const;
+
+            /**
+             *
+             * @param m1
+             * @return
+             */
+            MultivariatePolynomialMRT multiply( const MultivariateMonomialMR& m1 ) const;
 
-            static bool sortByLeadingTerm( const MultivariatePolynomialMR& m1, const MultivariatePolynomialMR& m2 )
+            static bool sortByLeadingTerm( const MultivariatePolynomialMRT& m1, const MultivariatePolynomialMRT& m2 )
             {
-                return (m1.getMonomOrderFunction()( m1.lmon(), m2.lmon() ));
+                return (m1.getMonomOrder()( m1.lmon(), m2.lmon() ));
             }
 
         protected:
+            MultivariatePolynomialMRT add( const MultivariatePolynomialMRT& p2 ) const;
+            MultivariatePolynomialMRT add( const Term& t1 ) const;
+            MultivariatePolynomialMRT subtract( const MultivariatePolynomialMRT& p2 ) const;
+            MultivariatePolynomialMRT negate() const;
+
+            /**
+             * Adds the term to the polynomial in place.
+             * @param t1
+             */
+            void addTerm( const Term& t1 );
+
+            /**
+             * Calculates the remainder with respect to the ideal whose leading monomials are already indexed.
+             * @param divisors an index over the polynomials generating the ideal
+             * @param used receives a flag for each polynomial in the index, which is true iff it was used, or 0 if the divisors need not be recorded
+             * @return
+             */
+            template<class Iterator>
+            MultivariatePolynomialMRT remainder( const PolynomialDivisorIndex<Iterator>& divisors, std::vector<bool>* used ) const;
+
             /// Ordering of Terms
             MonomMRCompare mCmp;
             /// Set of Terms
-            std::set<MultivariateTermMR, MonomMRCompare> mTerms;
+            TermSet mTerms;
 
     };
 
+    /// Polynomials with symbolic coefficients
+    typedef MultivariatePolynomialMRT<MultivariateCoefficientMR> MultivariatePolynomialMR;
+    /// Polynomials with rational coefficients
+    typedef MultivariatePolynomialMRT<RationalCoefficientMR> MultivariatePolynomialMRQ;
+    /// Polynomials with integer coefficients
+    typedef MultivariatePolynomialMRT<IntegerCoefficientMR> MultivariatePolynomialMRZ;
+    /// Polynomials with coefficients in Z/pZ
+    typedef MultivariatePolynomialMRT<ModularCoefficientMR> MultivariatePolynomialMRZp;
+
 }
+
+#include "MultivariatePolynomialMR.tpp"
+
 #endif
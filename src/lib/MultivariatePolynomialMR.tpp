@@ -0,0 +1,522 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+/**
+ * Implementation of the class template MultivariatePolynomialMRT. Included by MultivariatePolynomialMR.h.
+ */
+
+#include "VariableListPool.h"
+
+namespace GiNaCRA
+{
+    template<class Coeff>
+    MultivariatePolynomialMRT<Coeff>::MultivariatePolynomialMRT():
+        mCmp(),
+        mTerms()    /* , mpVarList(VariableListPool::getPtToStdVarList()), mpParList(VariableListPool::getPtToStdParList()) */
+    {}
+
+    template<class Coeff>
+    MultivariatePolynomialMRT<Coeff>::MultivariatePolynomialMRT( const MonomMRCompare& comp ):
+        mCmp( comp ),
+        mTerms( comp )    /* , mpVarList(VariableListPool::getPtToStdVarList()), mpParList(VariableListPool::getPtToStdParList()) */
+    {}
+
+    template<class Coeff>
+    MultivariatePolynomialMRT<Coeff>::MultivariatePolynomialMRT( const Term& t1, const MonomMRCompare& comp ):
+        mCmp( comp ),
+        mTerms( mCmp )    /* , mpVarList(VariableListPool::getPtToStdVarList()), mpParList(VariableListPool::getPtToStdParList()) */
+    {
+        mTerms.insert( t1 );
+    }
+
+    template<class Coeff>
+    MultivariatePolynomialMRT<Coeff>::MultivariatePolynomialMRT( const Term& t1, const Term& t2, const MonomMRCompare& comp ):
+        mCmp( comp ),
+        mTerms( mCmp )    /* , mpVarList(VariableListPool::getPtToStdVarList()), mpParList(VariableListPool::getPtToStdParList()) */
+    {
+        mTerms.insert( t1 );
+        addTerm( t2 );
+    }
+
+    template<class Coeff>
+    MultivariatePolynomialMRT<Coeff>::MultivariatePolynomialMRT( TermcIt begin, TermcIt last, const MonomMRCompare& comp ):
+        mCmp( comp ),
+        mTerms( begin, last, comp )    /* , mpVarList(VariableListPool::getPtToStdVarList()), mpParList(VariableListPool::getPtToStdParList()) */
+    {}
+
+    template<class Coeff>
+    MultivariatePolynomialMRT<Coeff>::MultivariatePolynomialMRT( TermcIt begin1, TermcIt last1, TermcIt begin2, TermcIt last2, const MonomMRCompare& comp ):
+        mCmp( comp ),
+        mTerms( comp )    /* , mpVarList(VariableListPool::getPtToStdVarList()), mpParList(VariableListPool::getPtToStdParList()) */
+    {
+        TermIt inputIt = mTerms.begin();
+        while( begin1 != last1 && begin2 != last2 )
+        {
+            if( mCmp( *begin1, *begin2 ))
+            {
+                inputIt = mTerms.insert( inputIt, *begin1 );
+                ++begin1;
+            }
+            else if( mCmp( *begin2, *begin1 ))
+            {
+                inputIt = mTerms.insert( inputIt, *begin2 );
+                ++begin2;
+            }
+            else    // equal monomials
+            {
+                Coeff newCoeff = begin1->getCoeff() + begin2->getCoeff();
+                if( !newCoeff.isZero() )
+                    inputIt = mTerms.insert( inputIt, Term( *begin1, newCoeff ));
+                ++begin1;
+                ++begin2;
+            }
+        }
+        mTerms.insert( begin1, last1 );
+        mTerms.insert( begin2, last2 );
+    }
+
+    template<class Coeff>
+    MultivariatePolynomialMRT<Coeff>::MultivariatePolynomialMRT( const GiNaC::ex& expr, const MonomMRCompare& cmp ):
+        mCmp( cmp ),
+        mTerms( cmp )
+    {
+        using GiNaC::const_iterator;
+        using GiNaC::is_exactly_a;
+        using GiNaC::numeric;
+
+        ex expression = expr.expand();
+        GiNaC::lst          list = GiNaC::lst();
+        std::vector<symbol> vars = VariableListPool::getVariables();
+        for( std::vector<symbol>::const_iterator it = vars.begin(); it != vars.end(); ++it )
+        {
+            list.append( *it );
+        }
+        if( !expression.is_polynomial( list ))
+            throw std::invalid_argument( "Argument is not a polynomial" );
+        if( is_exactly_a<GiNaC::add>( expression ))    // GiNaC::add because of overriding the name "add" by the current function
+        {
+            for( const_iterator i = expression.begin(); i != expression.end(); ++i )    // iterate through the summands
+            {
+                if( GiNaC::is_constant( *i, vars ))
+                {    // polynomial is constant in the current list of variables, so is a coefficient with the 1 monomial
+                    addTerm( Term( *i ));
+                }
+                else if( GiNaC::is_exactly_a<GiNaC::mul>( *i ))    // GiNaC::mul because of overriding the name "mul" by the current function
+                {    // polynomial is just a product
+                    GiNaC::ex                                   coeff = GiNaC::ex( 1 );
+
+                    std::vector<std::pair<unsigned, unsigned> > mon   = std::vector<std::pair<unsigned, unsigned> >();
+                    for( const_iterator j = i->begin(); j != i->end(); ++j )    // iterate through the possible powers
+                    {
+                        std::vector<symbol>::const_iterator s   = vars.begin();
+                        unsigned                            ind = 0;
+                        for( ; s != vars.end(); ++s )    // only tak)e symbols given in the list (all other things are coefficient)
+                        {
+                            if( j->degree( *s ) > 0 )
+                            {
+                                mon.push_back( std::pair<unsigned, unsigned>( ind, j->degree( *s )));
+                                break;
+                            }
+                            ++ind;
+                        }
+                        if( s == vars.end() )
+                        {    // current power is not build upon a variable, so it belongs to the coefficient
+                            coeff = coeff * *j;
+                        }
+                    }
+                    addTerm( Term( MultivariateMonomialMR( mon.begin(), mon.end() ), coeff ));
+                }
+                else if( GiNaC::is_exactly_a<GiNaC::power>( *i ) || GiNaC::is_exactly_a<symbol>( *i ))
+                {
+                    std::vector<symbol>::const_iterator s   = vars.begin();
+                    unsigned                            ind = 0;
+                    for( ; s != vars.end(); ++s )    // only take symbols given in the list (all other things are coefficient)
+                    {
+                        if( i->degree( *s ) > 0 )
+                        {
+                            addTerm( Term( MultivariateMonomialMR( ind, (unsigned)(i->degree( *s )))));
+                            break;
+                        }
+                        ++ind;
+                    }
+                    if( s == vars.end() )
+                    {
+                        addTerm( Term( *i ));
+                    }
+                }
+                else if( is_exactly_a<numeric>( *i ))
+                    addTerm( Term( *i ));
+
+                else if( i->is_zero() )
+                    ;
+            }
+
+        }
+        else
+        {
+            if( expression.is_zero() )
+                ;
+            else if( GiNaC::is_constant( expression, vars ))
+            {    // polynomial is constant in the current list of variables, so is a coefficient with the 1 monomial
+                addTerm( Term( expression ));
+            }
+            else if( GiNaC::is_exactly_a<GiNaC::mul>( expression ))    // GiNaC::mul because of overriding the name "mul" by the current function
+            {    // polynomial is just a product
+                GiNaC::ex                                   coeff = GiNaC::ex( 1 );
+
+                std::vector<std::pair<unsigned, unsigned> > mon   = std::vector<std::pair<unsigned, unsigned> >();
+                for( const_iterator j = expression.begin(); j != expression.end(); ++j )    // iterate through the possible powers
+                {
+                    std::vector<symbol>::const_iterator s   = vars.begin();
+                    unsigned                            ind = 0;
+                    for( ; s != vars.end(); ++s )    // only tak)e symbols given in the list (all other things are coefficient)
+                    {
+                        if( j->degree( *s ) > 0 )
+                        {
+                            mon.push_back( std::pair<unsigned, unsigned>( ind, j->degree( *s )));
+                            break;
+                        }
+                        ++ind;
+                    }
+                    if( s == vars.end() )
+                    {    // current power is not build upon a variable, so it belongs to the coefficient
+                        coeff = coeff * *j;
+                    }
+                }
+                addTerm( Term( MultivariateMonomialMR( mon.begin(), mon.end() ), coeff ));
+            }
+            else if( GiNaC::is_exactly_a<GiNaC::power>( expression ) || GiNaC::is_exactly_a<symbol>( expression ))
+            {
+                std::vector<symbol>::const_iterator s   = vars.begin();
+                unsigned                            ind = 0;
+                for( ; s != vars.end(); ++s )    // only take symbols given in the list (all other things are coefficient)
+                {
+                    if( expression.degree( *s ) > 0 )
+                    {
+                        addTerm( Term( MultivariateMonomialMR( ind, (unsigned)(expression.degree( *s )))));
+                        break;
+                    }
+                    ++ind;
+                }
+                if( s == vars.end() )
+                {
+                    addTerm( Term( expression ));
+                }
+            }
+            else if( is_exactly_a<numeric>( expression ))
+                addTerm( Term( expression ));
+        }
+
+        //if(expr.is_polynomial())
+    }
+
+    template<class Coeff>
+    GiNaC::ex MultivariatePolynomialMRT<Coeff>::toEx() const
+    {
+        GiNaC::ex expr = GiNaC::ex( 0 );
+        for( TermcIt it = mTerms.begin(); it != mTerms.end(); ++it )
+        {
+            expr += it->toEx();
+        }
+        return expr;
+    }
+
+    template<class Coeff>
+    void MultivariatePolynomialMRT<Coeff>::addTerm( const Term& t1 )
+    {
+        if( t1.getCoeff().isZero() )
+            return;
+        std::pair<TermIt, bool> ret = mTerms.insert( t1 );
+        if( ret.second )
+            return;
+        //the same monomial already exists.
+        //we remove the old one and construct a new term.
+        Coeff newCoeff = ret.first->getCoeff() + t1.getCoeff();
+        TermIt hint    = ret.first;
+        ++hint;
+        mTerms.erase( ret.first );
+        //If the new coefficient is zero, we do not add the term.
+        if( !newCoeff.isZero() )
+            mTerms.insert( hint, Term( t1, newCoeff ));
+    }
+
+    template<class Coeff>
+    MultivariatePolynomialMRT<Coeff> MultivariatePolynomialMRT<Coeff>::add( const MultivariatePolynomialMRT& p2 ) const
+    {
+        //TODO what if not equal polynomialordering! It is correct although very slow.
+        MultivariatePolynomialMRT newPol( mCmp );
+        TermIt inputIt = newPol.mTerms.begin();
+
+        TermcIt p1it   = mTerms.begin();
+        TermcIt p2it   = p2.mTerms.begin();
+        TermcIt p1end  = mTerms.end();
+        TermcIt p2end  = p2.mTerms.end();
+
+        while( p1it != p1end )
+        {
+            if( p2it == p2end )
+            {
+                newPol.mTerms.insert( p1it, p1end );
+                return newPol;
+            }
+            if( p1it->hasEqualExponents( *p2it ))
+            {
+                Coeff newCoeff = p1it->getCoeff() + p2it->getCoeff();
+                if( !newCoeff.isZero() )
+                {
+                    inputIt = newPol.mTerms.insert( inputIt, Term( *p1it, newCoeff ));
+                }
+                ++p1it;
+                ++p2it;
+                continue;
+            }
+            if( mCmp( *p1it, *p2it ))
+            {
+                inputIt = newPol.mTerms.insert( inputIt, *(p1it++) );
+            }
+            else
+            {
+                inputIt = newPol.mTerms.insert( inputIt, *(p2it++) );
+            }
+        }
+        newPol.mTerms.insert( p2it, p2end );
+        return newPol;
+    }
+
+    template<class Coeff>
+    MultivariatePolynomialMRT<Coeff> MultivariatePolynomialMRT<Coeff>::add( const Term& t1 ) const
+    {
+        MultivariatePolynomialMRT newPol = MultivariatePolynomialMRT( *this );
+        newPol.addTerm( t1 );
+        return newPol;
+    }
+
+    template<class Coeff>
+    MultivariatePolynomialMRT<Coeff> MultivariatePolynomialMRT<Coeff>::subtract( const MultivariatePolynomialMRT& p2 ) const
+    {
+        MultivariatePolynomialMRT newPol( mCmp );
+        TermIt inputIt = newPol.mTerms.begin();
+
+        TermcIt p1it   = mTerms.begin();
+        TermcIt p2it   = p2.mTerms.begin();
+        TermcIt p1end  = mTerms.end();
+        TermcIt p2end  = p2.mTerms.end();
+
+        while( p1it != p1end )
+        {
+            if( p2it == p2end )
+            {
+                newPol.mTerms.insert( p1it, p1end );
+                return newPol;
+            }
+
+            if( p1it->hasEqualExponents( *p2it ))
+            {
+                Coeff newCoeff = p1it->getCoeff() - p2it->getCoeff();
+                if( !newCoeff.isZero() )
+                {
+                    inputIt = newPol.mTerms.insert( inputIt, Term( *p1it, newCoeff ));
+                }
+                ++p1it;
+                ++p2it;
+                continue;
+            }
+            if( mCmp( *p1it, *p2it ))
+            {
+                inputIt = newPol.mTerms.insert( inputIt, *(p1it) );
+                ++p1it;
+            }
+            else
+            {
+                inputIt = newPol.mTerms.insert( inputIt, (p2it->negate()));
+                ++p2it;
+            }
+        }
+        for( ; p2it != p2end; ++p2it )
+        {
+            inputIt = newPol.mTerms.insert( inputIt, p2it->negate() );
+        }
+        return newPol;
+    }
+
+    template<class Coeff>
+    MultivariatePolynomialMRT<Coeff> MultivariatePolynomialMRT<Coeff>::negate() const
+    {
+        MultivariatePolynomialMRT newPol = MultivariatePolynomialMRT( mCmp );
+        TermIt inputloc                  = newPol.mTerms.begin();
+        for( TermcIt it = mTerms.begin(); it != mTerms.end(); ++it )
+        {
+            inputloc = newPol.mTerms.insert( inputloc, it->negate() );
+        }
+        return newPol;
+    }
+
+    template<class Coeff>
+    MultivariatePolynomialMRT<Coeff> MultivariatePolynomialMRT<Coeff>::multiply( const Term& t1 ) const
+    {
+        MultivariatePolynomialMRT newPol( mCmp );
+        if( t1.getCoeff().isZero() )
+            return newPol;
+        TermcIt end1    = mTerms.end();
+        TermIt inputloc = newPol.mTerms.begin();
+        for( TermcIt it = mTerms.begin(); it != end1; ++it )
+        {
+            Term product = (*it) * t1;
+            if( !product.getCoeff().isZero() )    // zero divisors only occur in Z/pZ if p is no prime
+                inputloc = newPol.mTerms.insert( inputloc, product );
+        }
+        return newPol;
+    }
+
+    template<class Coeff>
+    MultivariatePolynomialMRT<Coeff> MultivariatePolynomialMRT<Coeff>::multiply( const MultivariateMonomialMR& m1 ) const
+    {
+        MultivariatePolynomialMRT newPol( mCmp );
+        TermcIt end1    = mTerms.end();
+        TermIt inputloc = newPol.mTerms.begin();
+        for( TermcIt it = mTerms.begin(); it != end1; ++it )
+        {
+            inputloc = newPol.mTerms.insert( inputloc, (*it) * m1 );
+        }
+        return newPol;
+    }
+
+    template<class Coeff>
+    const MultivariatePolynomialMRT<Coeff> MultivariatePolynomialMRT<Coeff>::SPol( const MultivariatePolynomialMRT& p1, const MultivariatePolynomialMRT& p2 )
+    {
+        if( p1.getMonomOrder() != p2.getMonomOrder() )
+        {
+            throw std::invalid_argument( "Different orderings are not yet supported" );
+        }
+        if( !Coeff::isField )
+        {
+            // fraction-free: lc(p2)/g * lcm/lm(p1) * p1 - lc(p1)/g * lcm/lm(p2) * p2 with g = gcd(lc(p1), lc(p2))
+            Coeff g = Coeff::gcd( p1.lcoeff(), p2.lcoeff() );
+            return p1.truncLT().multiply( Term( p1.lterm().lcmdivm( p2.lmon() ), p2.lcoeff() / g ))
+                   - p2.truncLT().multiply( Term( p2.lterm().lcmdivm( p1.lmon() ), p1.lcoeff() / g ));
+        }
+        if( p1.nrOfTerms() == 1 && p2.nrOfTerms() == 1 )
+        {
+            return MultivariatePolynomialMRT( p1.mCmp );
+        }
+        else if( p1.nrOfTerms() == 1 )
+        {
+            return -(p2.truncLT().multiply( p2.lterm().lcmdivt( p1.lmon() )));
+        }
+        else if( p2.nrOfTerms() == 1 )
+        {
+            return p1.truncLT().multiply( p1.lterm().lcmdivt( p2.lmon() ));
+        }
+        return p1.truncLT().multiply( p1.lterm().lcmdivt( p2.lmon() )) - (p2.truncLT().multiply( p2.lterm().lcmdivt( p1.lmon() )));
+    }
+
+    template<class Coeff>
+    template<class InputIterator>
+    MultivariatePolynomialMRT<Coeff> MultivariatePolynomialMRT<Coeff>::CalculateRemainder( InputIterator ideallistBegin, InputIterator ideallistEnd ) const
+    {
+        return remainder( PolynomialDivisorIndex<InputIterator>( ideallistBegin, ideallistEnd ), 0 );
+    }
+
+    template<class Coeff>
+    template<class InputIterator>
+    MultivariatePolynomialMRT<Coeff> MultivariatePolynomialMRT<Coeff>::CalculateRemainder( InputIterator ideallistBegin, InputIterator ideallistEnd, std::vector<bool>& used ) const
+    {
+        return CalculateRemainder( PolynomialDivisorIndex<InputIterator>( ideallistBegin, ideallistEnd ), used );
+    }
+
+    template<class Coeff>
+    template<class Iterator>
+    MultivariatePolynomialMRT<Coeff> MultivariatePolynomialMRT<Coeff>::CalculateRemainder( const PolynomialDivisorIndex<Iterator>& divisors ) const
+    {
+        return remainder( divisors, 0 );
+    }
+
+    template<class Coeff>
+    template<class Iterator>
+    MultivariatePolynomialMRT<Coeff> MultivariatePolynomialMRT<Coeff>::CalculateRemainder( const PolynomialDivisorIndex<Iterator>& divisors, std::vector<bool>& used ) const
+    {
+        used.assign( divisors.size(), false );
+        return remainder( divisors, &used );
+    }
+
+    template<class Coeff>
+    template<class Iterator>
+    MultivariatePolynomialMRT<Coeff> MultivariatePolynomialMRT<Coeff>::remainder( const PolynomialDivisorIndex<Iterator>& divisors, std::vector<bool>* used ) const
+    {
+        MultivariatePolynomialMRT p = MultivariatePolynomialMRT( *this );
+        MultivariatePolynomialMRT r = MultivariatePolynomialMRT( mCmp );
+
+        while( !p.isZero() )
+        {
+            MultivariateMonomialMR lm    = p.lmon();
+            unsigned               index = divisors.findDivisor( lm );
+            if( index < divisors.size() )
+            {
+                Iterator fIt = divisors.divisor( index );
+                if( Coeff::isField )
+                {
+                    p = p - fIt->multiply( Term( lm / divisors[index], p.lcoeff() / fIt->lcoeff() ));
+                }
+                else
+                {
+                    // fraction-free: lc(f)/g * p - lc(p)/g * lm(p)/lm(f) * f with g = gcd(lc(p), lc(f))
+                    Coeff g      = Coeff::gcd( p.lcoeff(), fIt->lcoeff() );
+                    Coeff pScale = fIt->lcoeff() / g;
+                    p = p.multiply( Term( pScale )) - fIt->multiply( Term( lm / divisors[index], p.lcoeff() / g ));
+                    r = r.multiply( Term( pScale ));
+                }
+                if( used != 0 )
+                    (*used)[index] = true;
+            }
+            else
+            {
+                TermIt lt = p.mTerms.end();
+                --lt;
+                r.mTerms.insert( r.mTerms.begin(), *lt );
+                p.mTerms.erase( lt );
+            }
+        }
+        return r;
+    }
+
+    template<class Coeff>
+    MultivariatePolynomialMRT<Coeff> MultivariatePolynomialMRT<Coeff>::normalized() const
+    {
+        MultivariatePolynomialMRT n = MultivariatePolynomialMRT( mCmp );
+        if( isZero() )
+            return n;
+        Coeff divisor = lcoeff();
+        if( !Coeff::isField )
+        {
+            divisor = Coeff( 0 );
+            for( TermcIt i = mTerms.begin(); i != mTerms.end(); ++i )
+                divisor = Coeff::gcd( divisor, i->getCoeff() );
+            if( lcoeff().isNegative() )
+                divisor = -divisor;
+        }
+        TermIt inputloc = n.mTerms.begin();
+        for( TermcIt i = mTerms.begin(); i != mTerms.end(); ++i )
+            inputloc = n.mTerms.insert( inputloc, i->divide( divisor ));
+        return n;
+    }
+}
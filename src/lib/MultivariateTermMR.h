@@ -20,6 +20,7 @@
  */
 
 
+
 #ifndef GINACRA_MULTIVARIATETERMMR_H
 #define GINACRA_MULTIVARIATETERMMR_H
 
@@ -31,28 +32,42 @@
 
 #include "MultivariateMonomialMR.h"
 #include "MultivariateCoefficientMR.h"
+#include "RationalCoefficientMR.h"
+#include "IntegerCoefficientMR.h"
+#include "ModularCoefficientMR.h"
 #include "utilities.h"
 
 namespace GiNaCRA
 {
     /**
-     * A class for a multivariate polynomial providing a degree-based representation.
+     * A class for a multivariate term, i.e., a monomial with a coefficient.
+     *
+     * The coefficient domain Coeff has to provide the arithmetic operators ==, +, -, * and /, the methods isZero(),
+     * isNegative(), getExpression() and inverse(), a static method gcd and the static flags isField, isOrdered and
+     * isThreadSafe. The flag isOrdered states whether isNegative() reflects an ordering compatible with the arithmetic,
+     * isThreadSafe whether copies of an object can be used concurrently by different threads. Thread-safe domains
+     * additionally provide the state a worker thread has to adopt, see CoefficientThreadState. The domain has to be
+     * constructible from an integer and (explicitly) from a GiNaC::ex. Available domains are
+     * MultivariateCoefficientMR (symbolic expressions), RationalCoefficientMR, IntegerCoefficientMR and
+     * ModularCoefficientMR.
      *
      * @author Sebastian Junges
      * @since 2010-11-26
-     * @version 2011-12-08
+     * @version 2026-10-18
      *
      * Notation is following http://www.possibility.com/Cpp/CppCodingStandard.html.
      */
-    class MultivariateTermMR:
+    template<class Coeff>
+    class MultivariateTermMRT:
         public MultivariateMonomialMR
     {
         public:
+            typedef Coeff CoefficientType;
 
             /**
              * Does nothing, just to be able to return something empty
              */
-            MultivariateTermMR():
+            MultivariateTermMRT():
                 mCoeff()
             {}
 
@@ -60,7 +75,7 @@ namespace GiNaCRA
              *
              * @param size The number of variables expected, to allocate space at initialization.
              */
-            MultivariateTermMR( unsigned size ):
+            MultivariateTermMRT( unsigned size ):
                 MultivariateMonomialMR( size ),
                 mCoeff( 1 )
             {}
@@ -69,7 +84,16 @@ namespace GiNaCRA
              *
              * @param coeff
              */
-            MultivariateTermMR( GiNaC::ex coeff ):
+            MultivariateTermMRT( const GiNaC::ex& coeff ):
+                MultivariateMonomialMR(),
+                mCoeff( coeff )
+            {}
+
+            /**
+             *
+             * @param coeff
+             */
+            MultivariateTermMRT( const Coeff& coeff ):
                 MultivariateMonomialMR(),
                 mCoeff( coeff )
             {}
@@ -79,7 +103,7 @@ namespace GiNaCRA
              * @param m1
              * @param coeff
              */
-            MultivariateTermMR( const MultivariateMonomialMR& m1, const GiNaC::ex& coeff ):
+            MultivariateTermMRT( const MultivariateMonomialMR& m1, const GiNaC::ex& coeff ):
                 MultivariateMonomialMR( m1 ),
                 mCoeff( coeff )
             {}
@@ -89,7 +113,7 @@ namespace GiNaCRA
              * @param m1
              * @param coeff
              */
-            MultivariateTermMR( const MultivariateMonomialMR& m1, const MultivariateCoefficientMR& coeff ):
+            MultivariateTermMRT( const MultivariateMonomialMR& m1, const Coeff& coeff ):
                 MultivariateMonomialMR( m1 ),
                 mCoeff( coeff )
             {}
@@ -98,22 +122,47 @@ namespace GiNaCRA
              *
              * @param m1
              */
-            MultivariateTermMR( const MultivariateMonomialMR& m1 ):
+            MultivariateTermMRT( const MultivariateMonomialMR& m1 ):
                 MultivariateMonomialMR( m1 ),
                 mCoeff( 1 )
             {}
 
-            friend bool operator ==( const MultivariateTermMR& t1, const MultivariateTermMR& t2 );
-            friend const MultivariateTermMR operator *( const MultivariateTermMR& t1, const MultivariateTermMR& t2 );
-            friend const MultivariateTermMR operator *( const MultivariateTermMR& t1, const MultivariateMonomialMR& m1 );
-            friend const MultivariateTermMR operator *( const MultivariateMonomialMR& m1, const MultivariateTermMR& t1 );
+            /**
+             * Converts a term over another coefficient domain.
+             * @param t1
+             */
+            template<class OtherCoeff>
+            explicit MultivariateTermMRT( const MultivariateTermMRT<OtherCoeff>& t1 ):
+                MultivariateMonomialMR( t1 ),
+                mCoeff( t1.getCoeff() )
+            {}
+
+            friend bool operator ==( const MultivariateTermMRT& t1, const MultivariateTermMRT& t2 )
+            {
+                return (t1.mCoeff == t2.mCoeff) && ((const MultivariateMonomialMR&)t1 == (const MultivariateMonomialMR&)t2);
+            }
+
+            friend const MultivariateTermMRT operator *( const MultivariateTermMRT& t1, const MultivariateTermMRT& t2 )
+            {
+                return MultivariateTermMRT( (const MultivariateMonomialMR&)t1 * (const MultivariateMonomialMR&)t2, t1.mCoeff * t2.mCoeff );
+            }
+
+            friend const MultivariateTermMRT operator *( const MultivariateTermMRT& t1, const MultivariateMonomialMR& m1 )
+            {
+                return MultivariateTermMRT( (const MultivariateMonomialMR&)t1 * m1, t1.mCoeff );
+            }
+
+            friend const MultivariateTermMRT operator *( const MultivariateMonomialMR& m1, const MultivariateTermMRT& t1 )
+            {
+                return t1 * m1;
+            }
 
             /**
              * Compares the monomials
              * @param m2
              * @return
              */
-            inline bool hasEqualExponents( const MultivariateTermMR& m2 ) const
+            inline bool hasEqualExponents( const MultivariateTermMRT& m2 ) const
             {
                 if( mTotDeg != m2.mTotDeg || mExponents.size() != m2.mExponents.size() )
                     return false;
@@ -142,7 +191,7 @@ namespace GiNaCRA
              *
              * @return the coefficient
              */
-            inline MultivariateCoefficientMR getCoeff() const
+            inline const Coeff& getCoeff() const
             {
                 return mCoeff;
             }
@@ -151,9 +200,9 @@ namespace GiNaCRA
              *
              * @return The additive inverse of the term.
              */
-            inline MultivariateTermMR negate() const
+            inline MultivariateTermMRT negate() const
             {
-                return MultivariateTermMR( *this, -mCoeff );
+                return MultivariateTermMRT( *this, -mCoeff );
             }
 
             /*
@@ -161,30 +210,40 @@ namespace GiNaCRA
              * @param m1
              * @return lcm(mon(this),m1) divided by t1
              */
-            const MultivariateTermMR lcmdivt( const MultivariateMonomialMR& m1 ) const;
+            const MultivariateTermMRT lcmdivt( const MultivariateMonomialMR& m1 ) const;
+
+            /**
+             * Part of the fraction-free SPolynomial calculation.
+             * @param m1
+             * @return lcm(mon(this),m1) divided by mon(this)
+             */
+            const MultivariateMonomialMR lcmdivm( const MultivariateMonomialMR& m1 ) const;
 
             /**
              *
              * @param denom
-             * @return
+             * @return true, iff the monomial of denom divides the monomial of this term
              */
-            bool dividable( const MultivariateTermMR& denom ) const;
+            bool dividable( const MultivariateTermMRT& denom ) const
+            {
+                return MultivariateMonomialMR::dividable( denom );
+            }
 
             /**
              *
              * @param denom
              * @return
              */
-            std::pair<MultivariateTermMR, bool> divby( const MultivariateTermMR& denom ) const;
+            std::pair<MultivariateTermMRT, bool> divby( const MultivariateTermMRT& denom ) const;
 
             /**
              *
              * @param c
              * @return
              */
-            MultivariateTermMR divide( const ex& c ) const
+            MultivariateTermMRT divide( const Coeff& c ) const
             {
-                return MultivariateTermMR( *this, mCoeff.getExpression() / c );
+                return MultivariateTermMRT( *this, mCoeff / c );
             }
 
             /**
@@ -192,23 +251,29 @@ namespace GiNaCRA
              * @param rhs
              * @return
              */
-            friend std::ostream& operator <<( std::ostream& os, const MultivariateTermMR& rhs );
+            friend std::ostream& operator <<( std::ostream& os, const MultivariateTermMRT& rhs )
+            {
+                return os << rhs.mCoeff << (const MultivariateMonomialMR&)rhs;
+            }
 
         protected:
-            MultivariateCoefficientMR mCoeff;
+            Coeff mCoeff;
 
         private:
             typedef MultivariateMonomialMR super;
     };
 
-}
-
-/*
-namespace std {
+    /// Terms with symbolic coefficients
+    typedef MultivariateTermMRT<MultivariateCoefficientMR> MultivariateTermMR;
+    /// Terms with rational coefficients
+    typedef MultivariateTermMRT<RationalCoefficientMR> MultivariateTermMRQ;
+    /// Terms with integer coefficients
+    typedef MultivariateTermMRT<IntegerCoefficientMR> MultivariateTermMRZ;
+    /// Terms with coefficients in Z/pZ
+    typedef MultivariateTermMRT<ModularCoefficientMR> MultivariateTermMRZp;
 
-        template<typename t1, typename t2>
-        pair<const GiNaCRA::MultivariateTermMR, bool>& pair<const GiNaCRA::MultivariateTermMR, bool>::operator=(const pair<const GiNaCRA::MultivariateTermMR, bool>& input);
+}
 
-}*/
+#include "MultivariateTermMR.tpp"
 
 #endif
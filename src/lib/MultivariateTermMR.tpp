@@ -0,0 +1,144 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+/**
+ * Implementation of the class template MultivariateTermMRT. Included by MultivariateTermMR.h.
+ */
+
+namespace GiNaCRA
+{
+    template<class Coeff>
+    const MultivariateMonomialMR MultivariateTermMRT<Coeff>::lcmdivm( const MultivariateMonomialMR& m1 ) const
+    {
+        if( m1.mExponents.empty() )
+            return MultivariateMonomialMR();
+        if( mExponents.empty() )
+            return m1;
+
+        vui_cIt t1it  = mExponents.begin();
+        vui_cIt m1it  = m1.mExponents.begin();
+
+        vui_cIt t1end = mExponents.end();
+        vui_cIt m1end = m1.mExponents.end();
+        unsigned tdeg = 0;
+        MultivariateMonomialMR newMon( mExponents.size() + m1.mExponents.size() );
+        while( true )
+        {
+            while( t1it->first == m1it->first )
+            {
+                unsigned deg = std::max( t1it->second, m1it->second ) - t1it->second;
+                if( deg != 0 )
+                {
+                    newMon.mExponents.push_back( pui( t1it->first, deg ));
+                    tdeg += deg;
+                }
+                ++t1it;
+                ++m1it;
+                if( t1it == t1end )
+                {
+                    newMon.mExponents.insert( newMon.mExponents.end(), m1it, m1end );
+                    newMon.mTotDeg = std::accumulate( m1it, m1end, tdeg, plus_second() );
+                    return newMon;
+                }
+                if( m1it == m1end )
+                {
+                    newMon.mTotDeg = tdeg;
+                    return newMon;
+                }
+            }
+            while( t1it->first < m1it->first )
+            {
+                ++t1it;
+                if( t1it == t1end )
+                {
+                    newMon.mExponents.insert( newMon.mExponents.end(), m1it, m1end );
+                    newMon.mTotDeg = std::accumulate( m1it, m1end, tdeg, plus_second() );
+                    return newMon;
+                }
+            }
+            while( t1it->first > m1it->first )
+            {
+                newMon.mExponents.push_back( *m1it );
+                tdeg += m1it->second;
+                ++m1it;
+                if( m1it == m1end )
+                {
+                    newMon.mTotDeg = tdeg;
+                    return newMon;
+                }
+            }
+        }
+    }
+
+    template<class Coeff>
+    const MultivariateTermMRT<Coeff> MultivariateTermMRT<Coeff>::lcmdivt( const MultivariateMonomialMR& m1 ) const
+    {
+        return MultivariateTermMRT( lcmdivm( m1 ), mCoeff.inverse() );
+    }
+
+    template<class Coeff>
+    std::pair<MultivariateTermMRT<Coeff>, bool> MultivariateTermMRT<Coeff>::divby( const MultivariateTermMRT& denom ) const
+    {
+        if( denom.mExponents.empty() )
+            return std::pair<MultivariateTermMRT, bool>( MultivariateTermMRT( *this, mCoeff / denom.mCoeff ), true );
+
+        if( !dividable( denom ))
+            return std::pair<MultivariateTermMRT, bool>( MultivariateTermMRT(), false );
+            // yes it is dividable.
+
+        vui_cIt t1it               = mExponents.begin();
+        vui_cIt m1it               = denom.mExponents.begin();
+        vui_cIt t1end              = mExponents.end();
+        vui_cIt m1end              = denom.mExponents.end();
+
+        MultivariateTermMRT newMon = MultivariateTermMRT( mExponents.size() );
+        newMon.mTotDeg             = mTotDeg - denom.tdeg();
+        newMon.mCoeff              = mCoeff / denom.mCoeff;
+
+        while( true )
+        {
+            while( t1it->first == m1it->first )
+            {
+                unsigned deg = t1it->second - m1it->second;
+                if( deg != 0 )
+                {
+                    newMon.mExponents.push_back( pui( t1it->first, deg ));
+                }
+                ++t1it;
+                ++m1it;
+                if( m1it == m1end )
+                {    // if t1it == t1end than also m1it == m1end
+                    newMon.mExponents.insert( newMon.mExponents.end(), t1it, t1end );
+                    return std::pair<MultivariateTermMRT, bool>( newMon, true );
+                }
+            }
+
+            while( t1it->first < m1it->first )
+            {
+                newMon.mExponents.push_back( *t1it );
+                ++t1it;
+            }
+        }
+        return std::pair<MultivariateTermMRT, bool>( newMon, true );
+    }
+}
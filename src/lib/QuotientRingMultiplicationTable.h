@@ -0,0 +1,252 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+
+#ifndef GINACRA_QUOTIENTRINGMULTIPLICATIONTABLE_H
+#define GINACRA_QUOTIENTRINGMULTIPLICATIONTABLE_H
+
+#include <iostream>
+#include <list>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include "Groebner.h"
+#include "FGLM.h"
+
+namespace GiNaCRA
+{
+    /**
+     * Multiplication table of the quotient ring K[x]/I of a zero-dimensional ideal I, together with real root counting
+     * by Hermite's quadratic form.
+     *
+     * The quotient ring is a vector space whose basis is given by the standard monomials b_0 < ... < b_{d-1}, i.e.,
+     * the monomials which are not divisible by a leading monomial of the reduced Groebner basis of I. Its elements are
+     * represented by their coordinate vectors with respect to this basis. The table holds the normal forms of all
+     * products b_i * b_j, each obtained from the product of the predecessor of b_i (b_i divided by one variable) and b_j
+     * by a multiplication with the variable.
+     *
+     * The trace form (p, q) -> trace(p * q * h) is Hermite's quadratic form. Over a field of characteristic zero, the
+     * rank of the form for h = 1 is the number of distinct complex solutions of I, its signature is the number of
+     * distinct real solutions. For arbitrary h, the signature is the Tarski query, the number of real solutions with
+     * h > 0 minus the number of real solutions with h < 0. This answers how many real solutions an equation system has
+     * without computing a CAD.
+     *
+     * The table takes O(d^3) coefficients for a quotient ring of dimension d.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     * @see Basu, Pollack, Roy: Algorithms in Real Algebraic Geometry. Springer, 2006 (Hermite's quadratic form)
+     * @param Coeff the coefficient domain of the polynomials, which has to be a field, see MultivariateTermMRT
+     */
+    template<class Coeff>
+    class QuotientRingMultiplicationTableT
+    {
+        public:
+            typedef MultivariatePolynomialMRT<Coeff>                   PolynomialType;
+            typedef typename std::list<PolynomialType>::const_iterator lpol_cIt;
+            /// coordinates with respect to the standard monomials
+            typedef std::vector<Coeff>                                 Vector;
+            typedef std::vector<Vector>                                Matrix;
+
+            /**
+             * Creates the multiplication table of the ideal generated by the given polynomials, with respect to the
+             * monomial order of the polynomials.
+             * @param begin_generatingset
+             * @param end_generatingset
+             * @throws invalid_argument if the ideal is not zero-dimensional
+             * @throws domain_error if the coefficient domain is no field
+             */
+            QuotientRingMultiplicationTableT( lpol_cIt begin_generatingset, lpol_cIt end_generatingset )
+                    throw ( std::invalid_argument, std::domain_error );
+
+            /**
+             * Creates the multiplication table for a reduced Groebner basis.
+             * @param groebner a solved and reduced Groebner basis
+             * @throws invalid_argument if the basis is not reduced or the ideal is not zero-dimensional
+             * @throws domain_error if the coefficient domain is no field
+             */
+            explicit QuotientRingMultiplicationTableT( const GroebnerT<Coeff>& groebner )
+                    throw ( std::invalid_argument, std::domain_error );
+
+            /**
+             * @return the dimension of the quotient ring, i.e., the number of complex solutions counted with multiplicity
+             */
+            inline unsigned dimension() const
+            {
+                return mStandardMonomials.size();
+            }
+
+            /**
+             * @return the monomials under the staircase, which form a basis of the quotient ring, in increasing order
+             */
+            inline const std::vector<MultivariateMonomialMR>& standardMonomials() const
+            {
+                return mStandardMonomials;
+            }
+
+            /**
+             * @return the indices of the variables occurring in the Groebner basis, in increasing order
+             */
+            inline const std::vector<unsigned>& variables() const
+            {
+                return mVariables;
+            }
+
+            /**
+             * @return the reduced Groebner basis of the ideal
+             */
+            inline const std::list<PolynomialType>& groebnerBasis() const
+            {
+                return mBasis;
+            }
+
+            /**
+             * @param p
+             * @return the normal form of p with respect to the Groebner basis
+             */
+            PolynomialType normalForm( const PolynomialType& p ) const;
+
+            /**
+             * @param p
+             * @return the coordinates of the residue class of p
+             */
+            Vector coordinates( const PolynomialType& p ) const;
+
+            /**
+             * @param v coordinates of a residue class
+             * @return the polynomial in normal form with the given coordinates
+             */
+            PolynomialType polynomial( const Vector& v ) const;
+
+            /**
+             * @param i
+             * @param j
+             * @return the coordinates of the product of the i-th and the j-th standard monomial
+             */
+            inline const Vector& product( unsigned i, unsigned j ) const
+            {
+                return i >= j ? mProducts[i][j] : mProducts[j][i];
+            }
+
+            /**
+             * @param v
+             * @param w
+             * @return the coordinates of the product of the residue classes with the coordinates v and w
+             */
+            Vector multiply( const Vector& v, const Vector& w ) const;
+
+            /**
+             * @param v coordinates of a residue class
+             * @param variable the position of the variable in variables()
+             * @return the coordinates of the product of the residue class with the variable
+             */
+            Vector multiplyByVariable( const Vector& v, unsigned variable ) const;
+
+            /**
+             * @param p
+             * @return the trace of the multiplication by p in the quotient ring
+             */
+            Coeff trace( const PolynomialType& p ) const;
+
+            /**
+             * @param v coordinates of a residue class
+             * @return the trace of the multiplication by the residue class
+             */
+            Coeff trace( const Vector& v ) const;
+
+            /**
+             * @param h
+             * @return the matrix of Hermite's quadratic form for h, whose entry (i, j) is trace(h * b_i * b_j)
+             */
+            Matrix hermiteMatrix( const PolynomialType& h ) const;
+
+            /**
+             * @return the number of distinct complex solutions, which is the rank of Hermite's quadratic form
+             * @throws domain_error if the coefficient domain is not ordered, since the rank counts the distinct solutions only in
+             *         characteristic zero, or if the elimination needs a non-numeric pivot
+             */
+            unsigned nrOfComplexSolutions() const throw ( std::domain_error );
+
+            /**
+             * @return the number of distinct real solutions, which is the signature of Hermite's quadratic form
+             * @throws domain_error if the coefficient domain is not ordered or if the sign of a non-numeric pivot is needed
+             */
+            unsigned nrOfRealSolutions() const throw ( std::domain_error );
+
+            /**
+             * @param h
+             * @return the number of real solutions with h > 0 minus the number of real solutions with h < 0
+             * @throws domain_error if the coefficient domain is not ordered or if the sign of a non-numeric pivot is needed
+             */
+            int tarskiQuery( const PolynomialType& h ) const throw ( std::domain_error );
+
+            friend bool operator ==( const QuotientRingMultiplicationTableT& t1, const QuotientRingMultiplicationTableT& t2 )
+            {
+                return t1.mBasis == t2.mBasis;
+            }
+
+            friend std::ostream& operator <<( std::ostream& os, const QuotientRingMultiplicationTableT& t )
+            {
+                for( unsigned i = 0; i < t.dimension(); ++i )
+                {
+                    for( unsigned j = 0; j <= i; ++j )
+                        os << t.mStandardMonomials[i] << " * " << t.mStandardMonomials[j] << " = " << t.polynomial( t.product( i, j )) << std::endl;
+                }
+                return os;
+            }
+
+        private:
+            void initialize( const std::list<PolynomialType>& basis );
+            static void inertia( Matrix a, unsigned& positive, unsigned& negative ) throw ( std::domain_error );
+
+            MonomMRCompare                                             mOrder;
+            std::list<PolynomialType>                                  mBasis;
+            /// the indices of the variables occurring in the basis
+            std::vector<unsigned>                                      mVariables;
+            std::vector<MultivariateMonomialMR>                        mStandardMonomials;
+            std::map<MultivariateMonomialMR, unsigned, MonomMRCompare> mPositions;
+            /// for each standard monomial but 1, the position of the monomial it is a multiple of and the position of the variable
+            std::vector<std::pair<unsigned, unsigned> >                mPredecessors;
+            /// for each variable, the coordinates of its products with the standard monomials
+            std::vector<Matrix>                                        mVariableProducts;
+            /// the lower triangle of the table of the products of the standard monomials
+            std::vector<Matrix>                                        mProducts;
+            /// the traces of the standard monomials
+            Vector                                                     mTraces;
+            /// the matrix of Hermite's quadratic form for 1
+            Matrix                                                     mHermite;
+    };
+
+    /// Multiplication tables over the symbolic coefficients of MultivariateCoefficientMR.
+    typedef QuotientRingMultiplicationTableT<MultivariateCoefficientMR> QuotientRingMultiplicationTable;
+    /// Multiplication tables over the rational numbers.
+    typedef QuotientRingMultiplicationTableT<RationalCoefficientMR> QuotientRingMultiplicationTableQ;
+    /// Multiplication tables over the prime field given by ModularCoefficientMR::modulus(); real solutions cannot be counted.
+    typedef QuotientRingMultiplicationTableT<ModularCoefficientMR> QuotientRingMultiplicationTableZp;
+
+}
+
+#include "QuotientRingMultiplicationTable.tpp"
+
+#endif   /** GINACRA_QUOTIENTRINGMULTIPLICATIONTABLE_H */
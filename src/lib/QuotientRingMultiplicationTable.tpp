@@ -0,0 +1,367 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+
+
+/**
+ * Implementation of the class template QuotientRingMultiplicationTableT. Included by QuotientRingMultiplicationTable.h.
+ */
+
+#include <set>
+
+namespace GiNaCRA
+{
+    template<class Coeff>
+    QuotientRingMultiplicationTableT<Coeff>::QuotientRingMultiplicationTableT( lpol_cIt begin_generatingset, lpol_cIt end_generatingset )
+            throw ( std::invalid_argument, std::domain_error )
+    {
+        std::list<PolynomialType> generators( begin_generatingset, end_generatingset );
+        GroebnerT<Coeff>          g = GroebnerT<Coeff>( generators.begin(), generators.end() );
+        g.solve();
+        g.reduce();
+        initialize( g.getBase() );
+    }
+
+    template<class Coeff>
+    QuotientRingMultiplicationTableT<Coeff>::QuotientRingMultiplicationTableT( const GroebnerT<Coeff>& groebner )
+            throw ( std::invalid_argument, std::domain_error )
+    {
+        if( !groebner.isSolved() ||!groebner.isReduced() )
+            throw std::invalid_argument( "The multiplication table requires a reduced Groebner basis." );
+        initialize( groebner.getBase() );
+    }
+
+    template<class Coeff>
+    void QuotientRingMultiplicationTableT<Coeff>::initialize( const std::list<PolynomialType>& basis )
+    {
+        if( !Coeff::isField )
+            throw std::domain_error( "The quotient ring is only a vector space over a field." );
+        if( !FGLMT<Coeff>::isZeroDimensional( basis ))
+            throw std::invalid_argument( "The ideal is not zero-dimensional." );
+
+        mOrder = basis.empty() ? MonomMRCompare() : basis.front().getMonomOrder();
+        mBasis = basis;
+        std::set<unsigned> variables = FGLMT<Coeff>::variablesOf( basis );
+        mVariables.assign( variables.begin(), variables.end() );
+        mPositions = std::map<MultivariateMonomialMR, unsigned, MonomMRCompare>( mOrder );
+
+        // the staircase, enumerated by increasing monomials starting at 1
+        MonomialDivisorIndex leading;
+        for( lpol_cIt g = mBasis.begin(); g != mBasis.end(); ++g )
+            leading.push_back( g->lmon() );
+        std::map<MultivariateMonomialMR, std::pair<unsigned, unsigned>, MonomMRCompare> candidates( mOrder );
+        candidates.insert( std::make_pair( MultivariateMonomialMR(), std::make_pair( 0, 0 )));
+        while( !candidates.empty() )
+        {
+            MultivariateMonomialMR        m           = candidates.begin()->first;
+            std::pair<unsigned, unsigned> predecessor = candidates.begin()->second;
+            candidates.erase( candidates.begin() );
+            if( leading.findDivisor( m ) < leading.size() )
+                continue;
+            mPositions[m] = mStandardMonomials.size();
+            mStandardMonomials.push_back( m );
+            mPredecessors.push_back( predecessor );
+            for( unsigned v = 0; v < mVariables.size(); ++v )
+                candidates.insert( std::make_pair( m * MultivariateMonomialMR( mVariables[v], 1 ), std::make_pair( mStandardMonomials.size() - 1, v )));
+        }
+
+        // the products with the variables, the only ones which need reductions
+        unsigned d = dimension();
+        mVariableProducts.assign( mVariables.size(), Matrix( d ));
+        for( unsigned v = 0; v < mVariables.size(); ++v )
+        {
+            for( unsigned j = 0; j < d; ++j )
+                mVariableProducts[v][j] = coordinates( PolynomialType( typename PolynomialType::Term( mStandardMonomials[j] * MultivariateMonomialMR( mVariables[v], 1 ), Coeff( 1 )), mOrder ));
+        }
+
+        // the products of the standard monomials: b_i * b_j = x * (b_p * b_j) for the predecessor b_p of b_i = x * b_p
+        mProducts.assign( d, Matrix() );
+        for( unsigned i = 0; i < d; ++i )
+        {
+            mProducts[i].reserve( i + 1 );
+            for( unsigned j = 0; j <= i; ++j )
+            {
+                if( i == 0 )
+                {
+                    Vector unit = Vector( d, Coeff( 0 ));
+                    unit[j] = Coeff( 1 );
+                    mProducts[i].push_back( unit );
+                }
+                else
+                    mProducts[i].push_back( multiplyByVariable( product( mPredecessors[i].first, j ), mPredecessors[i].second ));
+            }
+        }
+
+        // the traces of the standard monomials and Hermite's quadratic form for 1
+        mTraces.assign( d, Coeff( 0 ));
+        for( unsigned i = 0; i < d; ++i )
+        {
+            for( unsigned j = 0; j < d; ++j )
+                mTraces[i] = mTraces[i] + product( i, j )[j];
+        }
+        mHermite.assign( d, Vector( d, Coeff( 0 )));
+        for( unsigned i = 0; i < d; ++i )
+        {
+            for( unsigned j = 0; j <= i; ++j )
+            {
+                const Vector& p = product( i, j );
+                for( unsigned k = 0; k < d; ++k )
+                {
+                    if( !p[k].isZero() )
+                        mHermite[i][j] = mHermite[i][j] + p[k] * mTraces[k];
+                }
+                mHermite[j][i] = mHermite[i][j];
+            }
+        }
+    }
+
+    template<class Coeff>
+    MultivariatePolynomialMRT<Coeff> QuotientRingMultiplicationTableT<Coeff>::normalForm( const PolynomialType& p ) const
+    {
+        return PolynomialType( p.begin(), p.end(), mOrder ).CalculateRemainder( mBasis.begin(), mBasis.end() );
+    }
+
+    template<class Coeff>
+    typename QuotientRingMultiplicationTableT<Coeff>::Vector QuotientRingMultiplicationTableT<Coeff>::coordinates( const PolynomialType& p ) const
+    {
+        Vector         result = Vector( dimension(), Coeff( 0 ));
+        PolynomialType nf     = normalForm( p );
+        for( typename PolynomialType::TermcIt t = nf.begin(); t != nf.end(); ++t )
+            result[mPositions.find( *t )->second] = t->getCoeff();
+        return result;
+    }
+
+    template<class Coeff>
+    MultivariatePolynomialMRT<Coeff> QuotientRingMultiplicationTableT<Coeff>::polynomial( const Vector& v ) const
+    {
+        typename PolynomialType::TermSet terms( mOrder );
+        for( unsigned i = 0; i < v.size(); ++i )
+        {
+            if( !v[i].isZero() )
+                terms.insert( terms.end(), typename PolynomialType::Term( mStandardMonomials[i], v[i] ));
+        }
+        return PolynomialType( terms.begin(), terms.end(), mOrder );
+    }
+
+    template<class Coeff>
+    typename QuotientRingMultiplicationTableT<Coeff>::Vector QuotientRingMultiplicationTableT<Coeff>::multiplyByVariable( const Vector& v, unsigned variable ) const
+    {
+        Vector result = Vector( dimension(), Coeff( 0 ));
+        for( unsigned j = 0; j < v.size(); ++j )
+        {
+            if( v[j].isZero() )
+                continue;
+            const Vector& column = mVariableProducts[variable][j];
+            for( unsigned k = 0; k < column.size(); ++k )
+            {
+                if( !column[k].isZero() )
+                    result[k] = result[k] + v[j] * column[k];
+            }
+        }
+        return result;
+    }
+
+    template<class Coeff>
+    typename QuotientRingMultiplicationTableT<Coeff>::Vector QuotientRingMultiplicationTableT<Coeff>::multiply( const Vector& v, const Vector& w ) const
+    {
+        Vector result = Vector( dimension(), Coeff( 0 ));
+        for( unsigned i = 0; i < v.size(); ++i )
+        {
+            if( v[i].isZero() )
+                continue;
+            for( unsigned j = 0; j < w.size(); ++j )
+            {
+                if( w[j].isZero() )
+                    continue;
+                Coeff         c = v[i] * w[j];
+                const Vector& p = product( i, j );
+                for( unsigned k = 0; k < p.size(); ++k )
+                {
+                    if( !p[k].isZero() )
+                        result[k] = result[k] + c * p[k];
+                }
+            }
+        }
+        return result;
+    }
+
+    template<class Coeff>
+    Coeff QuotientRingMultiplicationTableT<Coeff>::trace( const PolynomialType& p ) const
+    {
+        return trace( coordinates( p ));
+    }
+
+    template<class Coeff>
+    Coeff QuotientRingMultiplicationTableT<Coeff>::trace( const Vector& v ) const
+    {
+        Coeff result = Coeff( 0 );
+        for( unsigned i = 0; i < v.size(); ++i )
+        {
+            if( !v[i].isZero() )
+                result = result + v[i] * mTraces[i];
+        }
+        return result;
+    }
+
+    template<class Coeff>
+    typename QuotientRingMultiplicationTableT<Coeff>::Matrix QuotientRingMultiplicationTableT<Coeff>::hermiteMatrix( const PolynomialType& h ) const
+    {
+        unsigned d = dimension();
+        // the traces of h * b_k
+        Vector hCoordinates = coordinates( h );
+        Vector hTraces      = Vector( d, Coeff( 0 ));
+        for( unsigned i = 0; i < d; ++i )
+        {
+            if( hCoordinates[i].isZero() )
+                continue;
+            for( unsigned k = 0; k < d; ++k )
+                hTraces[k] = hTraces[k] + hCoordinates[i] * mHermite[i][k];
+        }
+        Matrix result = Matrix( d, Vector( d, Coeff( 0 )));
+        for( unsigned i = 0; i < d; ++i )
+        {
+            for( unsigned j = 0; j <= i; ++j )
+            {
+                const Vector& p = product( i, j );
+                for( unsigned k = 0; k < d; ++k )
+                {
+                    if( !p[k].isZero() )
+                        result[i][j] = result[i][j] + p[k] * hTraces[k];
+                }
+                result[j][i] = result[i][j];
+            }
+        }
+        return result;
+    }
+
+    template<class Coeff>
+    unsigned QuotientRingMultiplicationTableT<Coeff>::nrOfComplexSolutions() const throw ( std::domain_error )
+    {
+        if( !Coeff::isOrdered )
+            throw std::domain_error( "Distinct solutions can only be counted in characteristic zero." );
+        unsigned positive, negative;
+        inertia( mHermite, positive, negative );
+        return positive + negative;
+    }
+
+    template<class Coeff>
+    unsigned QuotientRingMultiplicationTableT<Coeff>::nrOfRealSolutions() const throw ( std::domain_error )
+    {
+        if( !Coeff::isOrdered )
+            throw std::domain_error( "Real solutions can only be counted over an ordered field." );
+        unsigned positive, negative;
+        inertia( mHermite, positive, negative );
+        return positive - negative;
+    }
+
+    template<class Coeff>
+    int QuotientRingMultiplicationTableT<Coeff>::tarskiQuery( const PolynomialType& h ) const throw ( std::domain_error )
+    {
+        if( !Coeff::isOrdered )
+            throw std::domain_error( "Real solutions can only be counted over an ordered field." );
+        unsigned positive, negative;
+        inertia( hermiteMatrix( h ), positive, negative );
+        return (int)positive - (int)negative;
+    }
+
+    template<class Coeff>
+    void QuotientRingMultiplicationTableT<Coeff>::inertia( Matrix a, unsigned& positive, unsigned& negative ) throw ( std::domain_error )
+    {
+        // symmetric Gaussian elimination: congruence transformations diagonalize the form
+        positive = 0;
+        negative = 0;
+        std::vector<unsigned> remaining;
+        for( unsigned i = 0; i < a.size(); ++i )
+            remaining.push_back( i );
+        while( !remaining.empty() )
+        {
+            unsigned pivot = remaining.size();
+            for( unsigned r = 0; r < remaining.size() && pivot == remaining.size(); ++r )
+            {
+                if( !a[remaining[r]][remaining[r]].isZero() )
+                    pivot = r;
+            }
+            if( pivot == remaining.size() )
+            {
+                // all diagonal entries vanish: a non-zero entry a_ij spans a hyperbolic plane, whose 2x2 block has inertia (1, 1)
+                // and is eliminated as a whole, which avoids the pivot 2 * a_ij vanishing in characteristic two
+                unsigned r1 = remaining.size(), r2 = 0;
+                for( unsigned r = 0; r < remaining.size() && r1 == remaining.size(); ++r )
+                {
+                    for( unsigned s = r + 1; s < remaining.size(); ++s )
+                    {
+                        if( !a[remaining[r]][remaining[s]].isZero() )
+                        {
+                            r1 = r;
+                            r2 = s;
+                            break;
+                        }
+                    }
+                }
+                if( r1 == remaining.size() )
+                    return;    // the remaining form is zero
+                unsigned i = remaining[r1], j = remaining[r2];
+                ++positive;
+                ++negative;
+                remaining.erase( remaining.begin() + r2 );
+                remaining.erase( remaining.begin() + r1 );
+                // the inverse of the block ( 0 b, b 0 ) is ( 0 1/b, 1/b 0 )
+                for( unsigned r = 0; r < remaining.size(); ++r )
+                {
+                    unsigned k = remaining[r];
+                    if( a[k][i].isZero() && a[k][j].isZero() )
+                        continue;
+                    Coeff factorI = a[k][j] / a[i][j];
+                    Coeff factorJ = a[k][i] / a[i][j];
+                    for( unsigned s = 0; s < remaining.size(); ++s )
+                    {
+                        unsigned l = remaining[s];
+                        a[k][l] = a[k][l] - factorI * a[i][l] - factorJ * a[j][l];
+                    }
+                }
+                continue;
+            }
+            unsigned p = remaining[pivot];
+            // symbolic coefficients are only ordered if they are numeric
+            if( !GiNaC::is_exactly_a<GiNaC::numeric>( a[p][p].getExpression() ))
+                throw std::domain_error( "The sign of a non-numeric pivot is unknown." );
+            if( a[p][p].isNegative() )
+                ++negative;
+            else
+                ++positive;
+            remaining.erase( remaining.begin() + pivot );
+            for( unsigned r = 0; r < remaining.size(); ++r )
+            {
+                unsigned i = remaining[r];
+                if( a[i][p].isZero() )
+                    continue;
+                Coeff factor = a[i][p] / a[p][p];
+                for( unsigned s = 0; s < remaining.size(); ++s )
+                {
+                    unsigned j = remaining[s];
+                    a[i][j] = a[i][j] - factor * a[p][j];
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,35 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#include "RationalCoefficientMR.h"
+
+namespace GiNaCRA
+{
+    RationalCoefficientMR::RationalCoefficientMR( const GiNaC::ex& expr ):
+        mValue( 0 )
+    {
+        if( !GiNaC::is_exactly_a<GiNaC::numeric>( expr ) ||!GiNaC::ex_to<GiNaC::numeric>( expr ).is_rational() )
+            throw (std::domain_error( "The coefficient is not a rational number" ));
+        mValue = cln::rational( cln::realpart( GiNaC::ex_to<GiNaC::numeric>( expr ).to_cl_N() ));
+    }
+}
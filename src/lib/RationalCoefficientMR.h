@@ -0,0 +1,156 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef GINACRA_RATIONALCOEFFICIENTMR_H
+#define GINACRA_RATIONALCOEFFICIENTMR_H
+
+#include <ginac/ginac.h>
+#include <cln/cln.h>
+#include <iostream>
+#include <stdexcept>
+
+#include "IntegerCoefficientMR.h"
+
+namespace GiNaCRA
+{
+    /**
+     * Class encapsulating rational numbers as coefficients of the terms.
+     *
+     * In contrast to MultivariateCoefficientMR, all operations are carried out directly on CLN rationals without
+     * passing the GiNaC evaluator.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     */
+    class RationalCoefficientMR
+    {
+        public:
+            static const bool isField = true;
+            static const bool isOrdered = true;
+            /// The reference counting of CLN numbers is not synchronized.
+            static const bool isThreadSafe = false;
+
+            RationalCoefficientMR():
+                mValue( 0 )
+            {}
+
+            explicit RationalCoefficientMR( long value ):
+                mValue( value )
+            {}
+
+            explicit RationalCoefficientMR( const cln::cl_RA& value ):
+                mValue( value )
+            {}
+
+            explicit RationalCoefficientMR( const IntegerCoefficientMR& c ):
+                mValue( c.getValue() )
+            {}
+
+            /**
+             * @param expr a rational numeric
+             * @throws std::domain_error if the expression is no rational number
+             */
+            explicit RationalCoefficientMR( const GiNaC::ex& expr );
+
+            friend bool operator ==( const RationalCoefficientMR& c1, const RationalCoefficientMR& c2 )
+            {
+                return c1.mValue == c2.mValue;
+            }
+
+            friend const RationalCoefficientMR operator *( const RationalCoefficientMR& c1, const RationalCoefficientMR& c2 )
+            {
+                return RationalCoefficientMR( c1.mValue * c2.mValue );
+            }
+
+            friend const RationalCoefficientMR operator +( const RationalCoefficientMR& c1, const RationalCoefficientMR& c2 )
+            {
+                return RationalCoefficientMR( c1.mValue + c2.mValue );
+            }
+
+            friend const RationalCoefficientMR operator -( const RationalCoefficientMR& c1 )
+            {
+                return RationalCoefficientMR( -c1.mValue );
+            }
+
+            friend const RationalCoefficientMR operator -( const RationalCoefficientMR& c1, const RationalCoefficientMR& c2 )
+            {
+                return RationalCoefficientMR( c1.mValue - c2.mValue );
+            }
+
+            friend const RationalCoefficientMR operator /( const RationalCoefficientMR& c1, const RationalCoefficientMR& c2 )
+            {
+                return RationalCoefficientMR( c1.mValue / c2.mValue );
+            }
+
+            friend std::ostream& operator <<( std::ostream& os, const RationalCoefficientMR& c1 )
+            {
+                return os << c1.mValue;
+            }
+
+            /**
+             * @param c1
+             * @param c2
+             * @return 1 unless both coefficients are zero (every non-zero rational is a unit)
+             */
+            static RationalCoefficientMR gcd( const RationalCoefficientMR& c1, const RationalCoefficientMR& c2 )
+            {
+                return RationalCoefficientMR( c1.isZero() && c2.isZero() ? 0 : 1 );
+            }
+
+            inline bool isZero() const
+            {
+                return cln::zerop( mValue );
+            }
+
+            inline bool isNegative() const
+            {
+                return cln::minusp( mValue );
+            }
+
+            inline const cln::cl_RA& getValue() const
+            {
+                return mValue;
+            }
+
+            inline GiNaC::ex getExpression() const
+            {
+                return GiNaC::numeric( mValue );
+            }
+
+            /**
+             * @return the multiplicative inverse
+             * @throws std::domain_error if the coefficient is zero
+             */
+            inline RationalCoefficientMR inverse() const
+            {
+                if( isZero() )
+                    throw (std::domain_error( "Zero is not invertible" ));
+                return RationalCoefficientMR( cln::recip( mValue ));
+            }
+
+        protected:
+            cln::cl_RA mValue;
+    };
+
+}
+#endif   /** GINACRA_RATIONALCOEFFICIENTMR_H */
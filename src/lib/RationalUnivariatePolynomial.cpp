@@ -27,7 +27,7 @@
  *
  * @author Ulrich Loup
  * @since 2010-09-07
- * @version 2012-04-15
+ * @version 2026-10-18
  * @see ISBN 0-387-94090-1 and ISBN-13: 978-3642069642
  */
 
@@ -143,9 +143,9 @@ namespace GiNaCRA
         return sum;
     }
 
-    unsigned RationalUnivariatePolynomial::countRealRoots() const
+    unsigned RationalUnivariatePolynomial::countRealRoots( RealAlgebraicNumberSettings::SturmSequenceStrategy strategy ) const
     {
-        list<RationalUnivariatePolynomial> seq = standardSturmSequence( *this, this->diff() );
+        list<RationalUnivariatePolynomial> seq = sturmSequence( *this, this->diff(), strategy );
         numeric c = this->cauchyBound();
         OpenInterval i( -c, c );
         return signVariations( seq, i.left() ) - signVariations( seq, i.right() );
@@ -180,13 +180,58 @@ namespace GiNaCRA
         return seq;
     }
 
+    list<RationalUnivariatePolynomial> RationalUnivariatePolynomial::sturmHabichtSequence( const RationalUnivariatePolynomial& a,
+                                                                                           const RationalUnivariatePolynomial& b )
+            throw ( invalid_argument )
+    {
+        if( !a.isCompatible( b ))
+            throw invalid_argument( "Symbols of the two univariate polynomials do not match." );
+        list<RationalUnivariatePolynomial> seq      = list<RationalUnivariatePolynomial>();    // Sturm-Habicht sequence to compute
+        symbol                             variable = a.variable();
+        if( a.isZero() )
+        {
+            seq.push_back( a );
+            return seq;
+        }
+        RationalUnivariatePolynomial p = positivePrimitivePart( a );
+        seq.push_back( p );
+        ex q = b.degree() < a.degree() ? static_cast<ex>( b ) : static_cast<ex>( b.rem( a ));
+        if( q.is_zero() )
+            return seq;
+        seq.push_back( positivePrimitivePart( RationalUnivariatePolynomial( q, variable )));
+        // sResP_{deg(p)-1} is the second element, the others are the nonzero signed subresultants of lower indices
+        vector<vector<ex> > subresultants = GiNaC::signedSubresultants( GiNaC::denseCoefficients( p, variable ),
+                                                                       GiNaC::denseCoefficients( seq.back(), variable ));
+        for( int j = p.degree() - 2; j >= 0; --j )
+        {
+            if( subresultants[j].empty() )
+                continue;
+            ex subresultant = 0;
+            for( unsigned d = 0; d < subresultants[j].size(); ++d )
+                subresultant += subresultants[j][d] * GiNaC::pow( variable, d );
+            seq.push_back( positivePrimitivePart( RationalUnivariatePolynomial( subresultant, variable )));
+        }
+        return seq;
+    }
+
     unsigned RationalUnivariatePolynomial::signVariations( const list<RationalUnivariatePolynomial>& seq, const numeric& a )
     {
-        bool     sign  = seq.front().sgn( a ) >= GiNaC::ZERO_SIGN ? true : false;    // only positive (incl. zero) [1] and negative values [0] count
-        unsigned count = 0;
+        bool     sign      = seq.front().sgn( a ) >= GiNaC::ZERO_SIGN ? true : false;    // only positive (incl. zero) [1] and negative values [0] count
+        bool     rightSign = seq.front().sgn( a ) != GiNaC::ZERO_SIGN;    // take the signs right of a, unless a is a root of the first polynomial
+        unsigned count     = 0;
         for( list<RationalUnivariatePolynomial>::const_iterator iter = seq.begin(); iter != seq.end(); ++iter )
         {
-            if( sign xor( iter->sgn( a ) >= GiNaC::ZERO_SIGN ))
+            GiNaC::sign s = iter->sgn( a );
+            if( rightSign && s == GiNaC::ZERO_SIGN )
+            {
+                RationalUnivariatePolynomial derivative = *iter;
+                while( s == GiNaC::ZERO_SIGN && !derivative.isConstant() )
+                {
+                    derivative = RationalUnivariatePolynomial( derivative.diff() );
+                    s          = derivative.sgn( a );
+                }
+            }
+            if( sign xor( s >= GiNaC::ZERO_SIGN ))
             {
                 ++count;
                 sign = !sign;
@@ -199,7 +244,7 @@ namespace GiNaCRA
     {
         if( p.is_zero() )
             throw invalid_argument( "Can not compute the Cauchy index of a zero polynomial." );
-        const list<RationalUnivariatePolynomial> SRemS      = RationalUnivariatePolynomial::standardSturmSequence( p, q );
+        const list<RationalUnivariatePolynomial> SRemS      = RationalUnivariatePolynomial::sturmSequence( p, q );
         const numeric                            upperBound = p.cauchyBound();
         assert( upperBound > 0 );
 
@@ -213,6 +258,15 @@ namespace GiNaCRA
         return RationalUnivariatePolynomial::calculateSturmCauchyIndex( p, (RationalUnivariatePolynomial)p.diff() * q );
     }
 
+    ///////////////////////
+    // Auxiliary Methods //
+    ///////////////////////
+
+    const RationalUnivariatePolynomial RationalUnivariatePolynomial::positivePrimitivePart( const RationalUnivariatePolynomial& p )
+    {
+        return RationalUnivariatePolynomial( static_cast<ex>( p ) / p.integer_content(), p.variable() );
+    }
+
     //
     //    std::list<int> RationalUnivariatePolynomial::signDeterminationHelperRows(std::list<std::vector<Sign> > signs) {
     //        list<int> L1, L2, L3;
@@ -23,6 +23,7 @@
 #ifndef GINACRA_RATIONALUNIVARIATEPOLYNOMIAL_H
 #define GINACRA_RATIONALUNIVARIATEPOLYNOMIAL_H
 
+#include "settings.h"
 #include "UnivariatePolynomial.h"
 #include "OpenInterval.h"
 
@@ -36,7 +37,7 @@ namespace GiNaCRA
      *
      * @author Ulrich Loup
      * @since 2010-09-07
-     * @version 2012-04-15
+     * @version 2026-10-18
      * @see ISBN 0-387-94090-1 and ISBN-13: 978-3642069642
      */
     class RationalUnivariatePolynomial:
@@ -131,9 +132,11 @@ namespace GiNaCRA
             numeric cauchyBound() const;
 
             /** Computes the number of real roots of the polynomial <code>p</code>.
+             * @param strategy sequence whose sign variations are counted
              * @return the number of real roots of the polynomial
              */
-            unsigned countRealRoots() const;
+            unsigned countRealRoots( RealAlgebraicNumberSettings::SturmSequenceStrategy strategy
+                                     = RealAlgebraicNumberSettings::DEFAULT_STURMSEQUENCESTRATEGY ) const;
 
             /**
              * Searches a real root of this polynomial within the given interval i, starting at position start, which is returned if there was no result after steps+1 iterations of the Newton's method.
@@ -158,8 +161,46 @@ namespace GiNaCRA
             static list<RationalUnivariatePolynomial> standardSturmSequence( const RationalUnivariatePolynomial& a,
                                                                              const RationalUnivariatePolynomial& b );
 
+            /**
+             * Generates the Sturm-Habicht sequence of a and b: a, b and the nonzero signed subresultants of a and b in decreasing order of their indices.
+             * Every element is divided by its positive rational content, so all coefficients are coprime integers whose sizes are polynomially
+             * bounded in the input, while the signs and thus the sign variations are the ones of the signed subresultants. The sequence can replace
+             * standardSturmSequence( a, b ) wherever sign variations are counted.
+             * If the degree of b is not smaller than the one of a, b is replaced by its remainder modulo a, which leaves the Cauchy index of b/a unchanged.
+             * @param a
+             * @param b
+             * @return list containing the elements of the Sturm-Habicht sequence
+             * @see ISBN 0-387-94090-1, Sections 8.3 and 9.1
+             * @see González-Vega, Lombardi, Recio, Roy: Sturm-Habicht sequence. ISSAC 1989
+             */
+            static list<RationalUnivariatePolynomial> sturmHabichtSequence( const RationalUnivariatePolynomial& a,
+                                                                            const RationalUnivariatePolynomial& b )
+                    throw ( invalid_argument );
+
+            /**
+             * Generates the sequence of a and b whose sign variations are counted, according to the given strategy.
+             * The strategy is chosen at run time: RealAlgebraicNumberFactory and RealAlgebraicNumberIR take it as an argument and pass it on
+             * to every real algebraic number they compute, so that root isolation, refinement and sign determination use the same kind of sequence.
+             * @param a
+             * @param b
+             * @param strategy
+             * @return standardSturmSequence( a, b ) or sturmHabichtSequence( a, b )
+             */
+            static list<RationalUnivariatePolynomial> sturmSequence( const RationalUnivariatePolynomial& a,
+                                                                     const RationalUnivariatePolynomial& b,
+                                                                     RealAlgebraicNumberSettings::SturmSequenceStrategy strategy
+                                                                     = RealAlgebraicNumberSettings::DEFAULT_STURMSEQUENCESTRATEGY )
+            {
+                if( strategy == RealAlgebraicNumberSettings::STURMHABICHT_STURMSEQUENCESTRATEGY )
+                    return sturmHabichtSequence( a, b );
+                return standardSturmSequence( a, b );
+            }
+
             /**
              * Counts the changes of sign when evaluating the given sequence of real algebraic univariate polynomials at the given numeric. This method is specially tailored to RationalUnivariatePolynomial.
+             * If a is a root of the first polynomial, zeros are counted as positive signs. Otherwise, every polynomial vanishing at a contributes its sign
+             * immediately to the right of a, i.e., the sign of its first non-vanishing derivative at a. Then the sign variations at a equal those at all
+             * points slightly bigger than a. This is needed for Sturm-Habicht sequences, whose consecutive elements may share a root.
              * @param seq A sequence of univariate polynomials in possibly different variables.
              * @param a
              * @return positive int
@@ -175,7 +216,7 @@ namespace GiNaCRA
              */
             static int calculateSturmCauchyIndex( const RationalUnivariatePolynomial& p, const RationalUnivariatePolynomial& q );
 
-            /** Computes the number of real roots of a polynomial in the specified interval, by using its standard Sturm sequence.
+            /** Computes the number of real roots of a polynomial in the specified interval, by using its standard Sturm sequence or Sturm-Habicht sequence.
              * @param seq
              * @param i isolating interval where the real roots w.r.t. seq shall be counted
              * @return the number of real roots of the polynomial, whose standard Sturm sequence is given, in the interval i
@@ -189,11 +230,15 @@ namespace GiNaCRA
             /** Computes the number of real roots of the polynomial <code>p</code> in the specified interval.
              * @param p
              * @param i isolating interval where the real roots of p shall be counted
+             * @param strategy sequence whose sign variations are counted
              * @return the number of real roots of the polynomial in the interval i
              */
-            static unsigned countRealRoots( const RationalUnivariatePolynomial& p, const OpenInterval& i )
+            static unsigned countRealRoots( const RationalUnivariatePolynomial& p,
+                                            const OpenInterval& i,
+                                            RealAlgebraicNumberSettings::SturmSequenceStrategy strategy
+                                            = RealAlgebraicNumberSettings::DEFAULT_STURMSEQUENCESTRATEGY )
             {
-                list<RationalUnivariatePolynomial> seq = standardSturmSequence( p, p.diff() );
+                list<RationalUnivariatePolynomial> seq = sturmSequence( p, p.diff(), strategy );
                 return signVariations( seq, i.left() ) - signVariations( seq, i.right() );
             }
 
@@ -216,6 +261,14 @@ namespace GiNaCRA
              */
             //template<class BidirectionalIterator>
             //static std::set<std::vector<Sign> > calculateSignDetermination(const RationalUnivariatePolynomial& z, const std::vector<RationalUnivariatePolynomial>& polynomials);
+
+        private:
+
+            /**
+             * @param p nonzero polynomial
+             * @return p divided by its positive rational content
+             */
+            static const RationalUnivariatePolynomial positivePrimitivePart( const RationalUnivariatePolynomial& p );
     };
 
 }    // namespace GiNaC
@@ -24,7 +24,7 @@
  * @file RealAlgebraicNumberFactory.cpp
  *
  * @since: 2011-10-18
- * @version: 2012-05-07
+ * @version: 2026-10-18
  * @author: Joachim Redies
  * @author Ulrich Loup
  */
@@ -153,7 +153,8 @@ namespace GiNaCRA
     ////////////////
 
     list<RealAlgebraicNumberPtr> RealAlgebraicNumberFactory::realRoots( const RationalUnivariatePolynomial& p,
-                                                                        RealAlgebraicNumberSettings::IsolationStrategy pivoting )
+                                                                        RealAlgebraicNumberSettings::IsolationStrategy pivoting,
+                                                                        RealAlgebraicNumberSettings::SturmSequenceStrategy sturm )
     {
         /*
          Annotations to the algorithm:
@@ -170,7 +171,7 @@ namespace GiNaCRA
         list<RealAlgebraicNumberPtr> roots = list<RealAlgebraicNumberPtr>();    // list of p's roots
         if( p.isConstant() )
             return roots;
-        list<RationalUnivariatePolynomial> seq = RationalUnivariatePolynomial::standardSturmSequence( p, p.diff() );
+        list<RationalUnivariatePolynomial> seq = RationalUnivariatePolynomial::sturmSequence( p, p.diff(), sturm );
         // determine two initial intervals as minimal representatives of the above mentioned bounds, excluding 0 (yields normalized intervals in the first place)
         numeric l    = -1 - p.maximumNorm();
         numeric r    = 1 + p.maximumNorm();
@@ -185,12 +186,12 @@ namespace GiNaCRA
         bool zeroRoot = p.hasZeroRoot();
         RationalUnivariatePolynomial q = zeroRoot ? RationalUnivariatePolynomial( p.nonzeropart() ) : p;
         if( zeroRoot )    // 0 is a root (which is added in the end)
-            seq = RationalUnivariatePolynomial::standardSturmSequence( q, q.diff() );    // reduce Sturm sequence
+            seq = RationalUnivariatePolynomial::sturmSequence( q, q.diff(), sturm );    // reduce Sturm sequence
         // MAIN-SEARCH:
         // recursive divide & conquer search of non-zero roots
         const unsigned varMinLeft = RationalUnivariatePolynomial::signVariations( seq, l );    // for root order computations
-        searchRealRoots( varMinLeft, q, seq, OpenInterval( l, 0 ), &roots, 0, pivoting );
-        searchRealRoots( varMinLeft, q, seq, OpenInterval( 0, r ), &roots, 0, pivoting );
+        searchRealRoots( varMinLeft, q, seq, OpenInterval( l, 0 ), &roots, 0, pivoting, sturm );
+        searchRealRoots( varMinLeft, q, seq, OpenInterval( 0, r ), &roots, 0, pivoting, sturm );
         if( zeroRoot )
             roots.push_back( RealAlgebraicNumberNRPtr( new RealAlgebraicNumberNR( 0, true )));    // mark as root
         return roots;
@@ -198,7 +199,8 @@ namespace GiNaCRA
 
     list<RealAlgebraicNumberPtr> RealAlgebraicNumberFactory::realRootsEval( const UnivariatePolynomial& p,
                                                                             const evalmap& m,
-                                                                            RealAlgebraicNumberSettings::IsolationStrategy pivoting )
+                                                                            RealAlgebraicNumberSettings::IsolationStrategy pivoting,
+                                                                            RealAlgebraicNumberSettings::SturmSequenceStrategy sturm )
             throw ( invalid_argument )
     {
         list<RealAlgebraicNumberPtr> roots = list<RealAlgebraicNumberPtr>();
@@ -225,7 +227,7 @@ namespace GiNaCRA
             varToInterval[i->first] = i->second->interval();
         }
         RationalUnivariatePolynomial res = RationalUnivariatePolynomial( currentResultant, y );
-        list<RationalUnivariatePolynomial> seq = RationalUnivariatePolynomial::standardSturmSequence( res, res.diff() );
+        list<RationalUnivariatePolynomial> seq = RationalUnivariatePolynomial::sturmSequence( res, res.diff(), sturm );
 
         /* Root-finding PREPROCESSING:
          */
@@ -233,7 +235,7 @@ namespace GiNaCRA
         bool zeroRoot = res.hasZeroRoot();
         RationalUnivariatePolynomial q = zeroRoot ? res.nonzeropart() : res;
         if( zeroRoot )    // 0 is a root (which is added in the end)
-            seq = RationalUnivariatePolynomial::standardSturmSequence( q, q.diff() );    // reduce Sturm sequence
+            seq = RationalUnivariatePolynomial::sturmSequence( q, q.diff(), sturm );    // reduce Sturm sequence
         // compute the Cauchy bound of p
         OpenInterval cauchyBoundInterval = OpenInterval();
         OpenInterval lcfInterval         = OpenInterval::evaluate( p.lcoeff(), varToInterval ).abs();    // we have to perform the conversion of coefficients because it is not clear whether we have a numeric or a RealAlgebraicNumberIR
@@ -255,8 +257,8 @@ namespace GiNaCRA
         // Root-finding MAIN-SEARCH:
         // recursive divide & conquer search of non-zero roots
         const unsigned varMinLeft = RationalUnivariatePolynomial::signVariations( seq, l );    // for root order computations
-        searchRealRoots( varMinLeft, q, seq, OpenInterval( l, 0 ), &roots, 0, pivoting );
-        searchRealRoots( varMinLeft, q, seq, OpenInterval( 0, r ), &roots, 0, pivoting );
+        searchRealRoots( varMinLeft, q, seq, OpenInterval( l, 0 ), &roots, 0, pivoting, sturm );
+        searchRealRoots( varMinLeft, q, seq, OpenInterval( 0, r ), &roots, 0, pivoting, sturm );
         if( zeroRoot )
             roots.push_back( RealAlgebraicNumberNRPtr( new RealAlgebraicNumberNR( 0, true )));    // mark as root
         return roots;
@@ -265,7 +267,8 @@ namespace GiNaCRA
     list<RealAlgebraicNumberPtr> RealAlgebraicNumberFactory::realRootsEval( const UnivariatePolynomial& p,
                                                                             const vector<RealAlgebraicNumberIRPtr>& a,
                                                                             const vector<symbol>& v,
-                                                                            RealAlgebraicNumberSettings::IsolationStrategy pivoting )
+                                                                            RealAlgebraicNumberSettings::IsolationStrategy pivoting,
+                                                                            RealAlgebraicNumberSettings::SturmSequenceStrategy sturm )
             throw ( invalid_argument )
     {
         if( a.size() != v.size() )
@@ -273,7 +276,7 @@ namespace GiNaCRA
         evalmap m = evalmap();
         for( unsigned i = 0; i != v.size(); ++i )
             m[v.at( i )] = a.at( i );
-        return RealAlgebraicNumberFactory::realRootsEval( p, m );
+        return RealAlgebraicNumberFactory::realRootsEval( p, m, pivoting, sturm );
     }
 
     list<RealAlgebraicNumberPtr> RealAlgebraicNumberFactory::commonRealRoots( const list<RationalUnivariatePolynomial>& l )
@@ -302,7 +305,8 @@ namespace GiNaCRA
                                                       const OpenInterval& i,
                                                       list<RealAlgebraicNumberPtr>* roots,
                                                       unsigned offset,
-                                                      RealAlgebraicNumberSettings::IsolationStrategy pivoting )
+                                                      RealAlgebraicNumberSettings::IsolationStrategy pivoting,
+                                                      RealAlgebraicNumberSettings::SturmSequenceStrategy sturm )
     {
         //    cout << "Search roots of " << p << " in " << i << endl;
         // common block
@@ -333,7 +337,7 @@ namespace GiNaCRA
             {
                 if( rootCount == 1 )
                 {    // no dissection needed
-                    roots->push_back( RealAlgebraicNumberIRPtr( new RealAlgebraicNumberIR( p, i, seq, false )));    // prohibit interval normalization
+                    roots->push_back( RealAlgebraicNumberIRPtr( new RealAlgebraicNumberIR( p, i, seq, false, true, sturm )));    // prohibit interval normalization
                     return;
                 }
                 if( middleIsRoot )    // in this case, pivot is a root itself what requires a correction in real root counting
@@ -342,7 +346,7 @@ namespace GiNaCRA
                 unsigned allRootCount = roots->size();
                 numeric middleBoundLeft  = i.left();
                 numeric middleBoundRight = i.right();
-                searchRealRoots( varMinLeft, p, seq, OpenInterval( i.left(), pivot ), roots, offset, pivoting );    // search left
+                searchRealRoots( varMinLeft, p, seq, OpenInterval( i.left(), pivot ), roots, offset, pivoting, sturm );    // search left
                 if( middleIsRoot && allRootCount < roots->size() )
                 {    // found roots at the left
                     allRootCount                      = roots->size();
@@ -351,7 +355,7 @@ namespace GiNaCRA
                     lastRoot->refineAvoiding( pivot );
                     middleBoundLeft = lastRoot->interval().right();
                 }
-                searchRealRoots( varMinLeft, p, seq, OpenInterval( pivot, i.right() ), roots, offset, pivoting );    // search right
+                searchRealRoots( varMinLeft, p, seq, OpenInterval( pivot, i.right() ), roots, offset, pivoting, sturm );    // search right
                 if( middleIsRoot && allRootCount < roots->size() )
                 {    // found roots at the right
                     RealAlgebraicNumberIRPtr lastRoot = std::tr1::dynamic_pointer_cast<RealAlgebraicNumberIR>( roots->back() );
@@ -360,7 +364,7 @@ namespace GiNaCRA
                     middleBoundRight = lastRoot->interval().left();
                     // add middle
                     roots->push_back( RealAlgebraicNumberIRPtr( new RealAlgebraicNumberIR( p, OpenInterval( middleBoundLeft, middleBoundRight ), seq,
-                                                                                           false )));    // prohibit interval normalization
+                                                                                           false, true, sturm )));    // prohibit interval normalization
                 }
                 return;
             }
@@ -369,14 +373,14 @@ namespace GiNaCRA
                 {    // no dissection needed
                     if( middleIsRoot )
                         return;
-                    roots->push_back( RealAlgebraicNumberIRPtr( new RealAlgebraicNumberIR( p, i, seq, false )));    // prohibit interval normalization
+                    roots->push_back( RealAlgebraicNumberIRPtr( new RealAlgebraicNumberIR( p, i, seq, false, true, sturm )));    // prohibit interval normalization
                     return;
                 }
                 if( middleIsRoot )    // in this case, pivot is a root itself what requires a correction in real root counting
                     ++offset;
                 // split interval into two parts by the pivot element
-                searchRealRoots( varMinLeft, p, seq, OpenInterval( i.left(), pivot ), roots, offset, pivoting );    // search left
-                searchRealRoots( varMinLeft, p, seq, OpenInterval( pivot, i.right() ), roots, offset, pivoting );    // search right
+                searchRealRoots( varMinLeft, p, seq, OpenInterval( i.left(), pivot ), roots, offset, pivoting, sturm );    // search left
+                searchRealRoots( varMinLeft, p, seq, OpenInterval( pivot, i.right() ), roots, offset, pivoting, sturm );    // search right
                 return;
             case RealAlgebraicNumberSettings::BINARYSAMPLE_ISOLATIONSTRATEGY:
                 if( rootCount == 1 )
@@ -387,7 +391,7 @@ namespace GiNaCRA
                     if( p.sgn( pivot ) == GiNaC::ZERO_SIGN )
                         roots->push_back( RealAlgebraicNumberNRPtr( new RealAlgebraicNumberNR( pivot, true )));    // mark as root
                     else
-                        roots->push_back( RealAlgebraicNumberIRPtr( new RealAlgebraicNumberIR( p, i, seq, false )));    // prohibit interval normalization
+                        roots->push_back( RealAlgebraicNumberIRPtr( new RealAlgebraicNumberIR( p, i, seq, false, true, sturm )));    // prohibit interval normalization
                     return;
                 }
                 pivot = i.sample();    // try sample as separating element
@@ -397,8 +401,8 @@ namespace GiNaCRA
                     ++offset;    // because pivot is a root itself and will serve as separating element, a correction in real root counting is required
                 }
                 // split interval into two parts by the pivot element
-                searchRealRoots( varMinLeft, p, seq, OpenInterval( i.left(), pivot ), roots, offset, pivoting );    // search left
-                searchRealRoots( varMinLeft, p, seq, OpenInterval( pivot, i.right() ), roots, offset, pivoting );    // search right
+                searchRealRoots( varMinLeft, p, seq, OpenInterval( i.left(), pivot ), roots, offset, pivoting, sturm );    // search left
+                searchRealRoots( varMinLeft, p, seq, OpenInterval( pivot, i.right() ), roots, offset, pivoting, sturm );    // search right
                 return;
             case RealAlgebraicNumberSettings::TERNARYSAMPLE_ISOLATIONSTRATEGY:
             case RealAlgebraicNumberSettings::TERNARYNEWTON_ISOLATIONSTRATEGY:
@@ -413,7 +417,7 @@ namespace GiNaCRA
                     if( p.sgn( pivot ) == GiNaC::ZERO_SIGN )
                         roots->push_back( RealAlgebraicNumberNRPtr( new RealAlgebraicNumberNR( pivot, true )));    // mark as root
                     else
-                        roots->push_back( RealAlgebraicNumberIRPtr( new RealAlgebraicNumberIR( p, i, seq, false )));    // prohibit interval normalization
+                        roots->push_back( RealAlgebraicNumberIRPtr( new RealAlgebraicNumberIR( p, i, seq, false, true, sturm )));    // prohibit interval normalization
                     return;
                 }
                 numeric pivot2 = pivot;    // init: change nothing
@@ -424,8 +428,8 @@ namespace GiNaCRA
                 if( pivot == pivot2 )
                 {
                     // split interval into two parts by the pivot element
-                    searchRealRoots( varMinLeft, p, seq, OpenInterval( i.left(), pivot ), roots, offset, pivoting );    // search left
-                    searchRealRoots( varMinLeft, p, seq, OpenInterval( pivot, i.right() ), roots, offset, pivoting );    // search right
+                    searchRealRoots( varMinLeft, p, seq, OpenInterval( i.left(), pivot ), roots, offset, pivoting, sturm );    // search left
+                    searchRealRoots( varMinLeft, p, seq, OpenInterval( pivot, i.right() ), roots, offset, pivoting, sturm );    // search right
                 }
                 else
                 {
@@ -439,9 +443,9 @@ namespace GiNaCRA
                     numeric pivotMin = std::min( pivot, pivot2 );
                     numeric pivotMax = std::max( pivot, pivot2 );
                     // split interval into three parts by the two pivot elements
-                    searchRealRoots( varMinLeft, p, seq, OpenInterval( i.left(), pivotMin ), roots, offset, pivoting );
-                    searchRealRoots( varMinLeft, p, seq, OpenInterval( pivotMin, pivotMax ), roots, offset, pivoting );
-                    searchRealRoots( varMinLeft, p, seq, OpenInterval( pivotMax, i.right() ), roots, offset, pivoting );
+                    searchRealRoots( varMinLeft, p, seq, OpenInterval( i.left(), pivotMin ), roots, offset, pivoting, sturm );
+                    searchRealRoots( varMinLeft, p, seq, OpenInterval( pivotMin, pivotMax ), roots, offset, pivoting, sturm );
+                    searchRealRoots( varMinLeft, p, seq, OpenInterval( pivotMax, i.right() ), roots, offset, pivoting, sturm );
                 }
                 return;
         }
@@ -449,16 +453,20 @@ namespace GiNaCRA
 
     const RealAlgebraicNumberPtr RealAlgebraicNumberFactory::evaluateIR( const UnivariatePolynomial& p,
                                                                          const vector<RealAlgebraicNumberIRPtr>& a,
-                                                                         const vector<symbol>& v )
+                                                                         const vector<symbol>& v,
+                                                                         RealAlgebraicNumberSettings::SturmSequenceStrategy sturm )
             throw ( invalid_argument )
     {
         evalmap m = evalmap();
         for( unsigned i = 0; i < v.size(); ++i )
             m[v.at( i )] = a.at( i );
-        return RealAlgebraicNumberFactory::evaluateIR( p, m );
+        return RealAlgebraicNumberFactory::evaluateIR( p, m, sturm );
     }
 
-    const RealAlgebraicNumberPtr RealAlgebraicNumberFactory::evaluateIR( const UnivariatePolynomial& p, const evalmap m ) throw ( invalid_argument )
+    const RealAlgebraicNumberPtr RealAlgebraicNumberFactory::evaluateIR( const UnivariatePolynomial& p,
+                                                                         const evalmap m,
+                                                                         RealAlgebraicNumberSettings::SturmSequenceStrategy sturm )
+            throw ( invalid_argument )
     {
         //        cout << "call evalIR( " << p << "( " << p.variable() <<  " ) , [";
         //        for( evalmap::const_iterator iter = m.begin(); iter != m.end(); ++iter )
@@ -484,7 +492,7 @@ namespace GiNaCRA
         //        cout << "current resultant: " << currentResultant << endl;
         RationalUnivariatePolynomial r = RationalUnivariatePolynomial( currentResultant, y );    // r in y??
         //        cout << "current resultant poly: " << r << endl;
-        list<RationalUnivariatePolynomial> seq = RationalUnivariatePolynomial::standardSturmSequence( r, r.diff() );
+        list<RationalUnivariatePolynomial> seq = RationalUnivariatePolynomial::sturmSequence( r, r.diff(), sturm );
         OpenInterval interval = OpenInterval::evaluate( p, mInterval );
         // refine the result interval until it isolates exactly one real root of the result polynomial
         //        cout << "p = " << r << endl;
@@ -499,6 +507,6 @@ namespace GiNaCRA
             interval = OpenInterval::evaluate( p, mInterval );
         }
         //        cout << "evalIR Result: " << std::tr1::shared_ptr<RealAlgebraicNumber>( new RealAlgebraicNumberIR( r, interval )) << endl;
-        return std::tr1::shared_ptr<RealAlgebraicNumber>( new RealAlgebraicNumberIR( r, interval ));
+        return std::tr1::shared_ptr<RealAlgebraicNumber>( new RealAlgebraicNumberIR( r, interval, list<RationalUnivariatePolynomial>(), true, true, sturm ));
     }
 }
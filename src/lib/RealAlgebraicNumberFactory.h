@@ -42,7 +42,7 @@ namespace GiNaCRA
      * A class providing useful static methods which produce instances of RealAlgebraicNumberIR.
      *
      * @since 2011-10-18
-     * @version 2012-03-15
+     * @version 2026-10-18
      * @author Joachim Redies
      * @author Ulrich Loup
      */
@@ -95,10 +95,12 @@ namespace GiNaCRA
              *
              * @param p rational univariate polynomial
              * @param pivoting strategy selection according to RealAlgebraicNumberSettings::IsolationStrategy (standard option is RealAlgebraicNumberSettings::DEFAULT_ISOLATIONSTRATEGY)
+             * @param sturm sequence used for counting real roots, also by the resulting numbers (standard option is RealAlgebraicNumberSettings::DEFAULT_STURMSEQUENCESTRATEGY)
              * @return list containing the real roots of the given polynomial
              */
             static list<RealAlgebraicNumberPtr> realRoots( const RationalUnivariatePolynomial& p,
-                                                           RealAlgebraicNumberSettings::IsolationStrategy pivoting = RealAlgebraicNumberSettings::DEFAULT_ISOLATIONSTRATEGY );
+                                                           RealAlgebraicNumberSettings::IsolationStrategy pivoting = RealAlgebraicNumberSettings::DEFAULT_ISOLATIONSTRATEGY,
+                                                           RealAlgebraicNumberSettings::SturmSequenceStrategy sturm = RealAlgebraicNumberSettings::DEFAULT_STURMSEQUENCESTRATEGY );
 
             /**
              * Isolates the real roots of the given univariate polynomial by evaluating its parameterized coefficients according to the given evalmap map.
@@ -106,11 +108,13 @@ namespace GiNaCRA
              * @param p possibly parameterized univariate polynomial
              * @param m evaluation map for the coefficients of p
              * @param pivoting strategy selection according to RealAlgebraicNumberSettings::IsolationStrategy (standard option is RealAlgebraicNumberSettings::DEFAULT_ISOLATIONSTRATEGY)
+             * @param sturm sequence used for counting real roots, also by the resulting numbers (standard option is RealAlgebraicNumberSettings::DEFAULT_STURMSEQUENCESTRATEGY)
              * @return list containing the real roots of the given polynomial, which is evaluated according to the given evalmap map
              */
             static list<RealAlgebraicNumberPtr> realRootsEval( const UnivariatePolynomial& p,
                                                                const evalmap& m,
-                                                               RealAlgebraicNumberSettings::IsolationStrategy pivoting = RealAlgebraicNumberSettings::DEFAULT_ISOLATIONSTRATEGY )
+                                                               RealAlgebraicNumberSettings::IsolationStrategy pivoting = RealAlgebraicNumberSettings::DEFAULT_ISOLATIONSTRATEGY,
+                                                               RealAlgebraicNumberSettings::SturmSequenceStrategy sturm = RealAlgebraicNumberSettings::DEFAULT_STURMSEQUENCESTRATEGY )
                     throw ( invalid_argument );
 
             /**
@@ -120,12 +124,14 @@ namespace GiNaCRA
              * @param a vector with interval-represented RealAlgebraicNumbers
              * @param v the variables for evaluation corresponding to the real algebraic point
              * @param pivoting strategy selection according to RealAlgebraicNumberSettings::IsolationStrategy (standard option is RealAlgebraicNumberSettings::DEFAULT_ISOLATIONSTRATEGY)
+             * @param sturm sequence used for counting real roots, also by the resulting numbers (standard option is RealAlgebraicNumberSettings::DEFAULT_STURMSEQUENCESTRATEGY)
              * @return list containing the real roots of the given polynomial, which is evaluated according to the given variables/numbers
              */
             static list<RealAlgebraicNumberPtr> realRootsEval( const UnivariatePolynomial& p,
                                                                const vector<RealAlgebraicNumberIRPtr>& a,
                                                                const vector<symbol>& v,
-                                                               RealAlgebraicNumberSettings::IsolationStrategy pivoting = RealAlgebraicNumberSettings::DEFAULT_ISOLATIONSTRATEGY )
+                                                               RealAlgebraicNumberSettings::IsolationStrategy pivoting = RealAlgebraicNumberSettings::DEFAULT_ISOLATIONSTRATEGY,
+                                                               RealAlgebraicNumberSettings::SturmSequenceStrategy sturm = RealAlgebraicNumberSettings::DEFAULT_STURMSEQUENCESTRATEGY )
                     throw ( invalid_argument );
 
             /**
@@ -148,12 +154,14 @@ namespace GiNaCRA
              * @param p polynomial to be evaluated in the given variables.
              * @param a vector with interval-represented RealAlgebraicNumbers
              * @param v the variables for evaluation corresponding to the real algebraic point
+             * @param sturm sequence used for counting real roots, also by the resulting numbers (standard option is RealAlgebraicNumberSettings::DEFAULT_STURMSEQUENCESTRATEGY)
              * @return Real algebraic number representing the value of <code>p</code> evaluated at <code>r</code>
              * @see Constraint::satisfiedBy and CAD::samples for usages of this method
              */
             static const RealAlgebraicNumberPtr evaluateIR( const UnivariatePolynomial& p,
                                                             const vector<RealAlgebraicNumberIRPtr>& a,
-                                                            const vector<symbol>& v )
+                                                            const vector<symbol>& v,
+                                                            RealAlgebraicNumberSettings::SturmSequenceStrategy sturm = RealAlgebraicNumberSettings::DEFAULT_STURMSEQUENCESTRATEGY )
                     throw ( invalid_argument );
 
             /**
@@ -166,10 +174,14 @@ namespace GiNaCRA
              * </p>
              * @param p polynomial to be evaluated in the given variables. This should be a univariate polynomial in a variable <i>not</i> occurring in <code>variables</code>.
              * @param m map assigning each variable of <code>p</code> an interval-represented RealAlgebraicNumber
+             * @param sturm sequence used for counting real roots, also by the resulting numbers (standard option is RealAlgebraicNumberSettings::DEFAULT_STURMSEQUENCESTRATEGY)
              * @return Real algebraic number representing the value of <code>p</code> evaluated according to <code>m</code>
              * @see Constraint::satisfiedBy and CAD::samples for usages of this method
              */
-            static const RealAlgebraicNumberPtr evaluateIR( const UnivariatePolynomial& p, const evalmap m ) throw ( invalid_argument );
+            static const RealAlgebraicNumberPtr evaluateIR( const UnivariatePolynomial& p,
+                                                            const evalmap m,
+                                                            RealAlgebraicNumberSettings::SturmSequenceStrategy sturm = RealAlgebraicNumberSettings::DEFAULT_STURMSEQUENCESTRATEGY )
+                    throw ( invalid_argument );
 
         private:
 
@@ -182,11 +194,12 @@ namespace GiNaCRA
              * All have in common that 0 is returned as <code>RealAlgebraicNumberNR</code> if it happens to be a valid root. For details on the strategies @see
              * @param varMinLeft number of sign variations of seq at the minimal left endpoint
              * @param p polynomial whose roots are searched
-             * @param seq standard Sturm of p
+             * @param seq Sturm sequence of p
              * @param i isolating interval which shall be searched for real roots recursively
              * @param offset the number of roots to subtract from the actual root count in the interval <code>i</code>. The standard value is 0 which also holds for the initial call by the Cauchy bounds. The offset should be set to <code>(p.sgn(i.Left()) == GiNaC::ZERO_SIGN) + (p.sgn(i.Right()) == GiNaC::ZERO_SIGN)</code>.
              * @param roots list of roots found so far
              * @param pivoting strategy selection according to RealAlgebraicNumberSettings::IsolationStrategy
+             * @param sturm strategy seq was generated with, passed to the roots found
              */
             static void searchRealRoots( const unsigned varMinLeft,
                                          const RationalUnivariatePolynomial& p,
@@ -194,7 +207,8 @@ namespace GiNaCRA
                                          const OpenInterval& i,
                                          list<RealAlgebraicNumberPtr>* roots,
                                          unsigned offset,
-                                         RealAlgebraicNumberSettings::IsolationStrategy pivoting );
+                                         RealAlgebraicNumberSettings::IsolationStrategy pivoting,
+                                         RealAlgebraicNumberSettings::SturmSequenceStrategy sturm );
 
     };
 
@@ -27,7 +27,7 @@
  *
  * @author Ulrich Loup
  * @since 2010-07-28
- * @version 2012-05-15
+ * @version 2026-10-18
  * @see ISBN 0-387-94090-1 and ISBN-13: 978-3642069642
  */
 
@@ -56,7 +56,8 @@ namespace GiNaCRA
         RealAlgebraicNumber( true, true, 0 ),
         mPolynomial(),
         mInterval(),
-        mSturmSequence( RationalUnivariatePolynomial::standardSturmSequence( mPolynomial, mPolynomial.diff() )),
+        mSturmSequence( RationalUnivariatePolynomial::sturmSequence( mPolynomial, mPolynomial.diff() )),
+        mSturmSequenceStrategy( RealAlgebraicNumberSettings::DEFAULT_STURMSEQUENCESTRATEGY ),
         mRefinementCount( 0 )
     {
         setflag( GiNaC::status_flags::expanded );
@@ -66,7 +67,8 @@ namespace GiNaCRA
         RealAlgebraicNumber( true, true, 0 ),
         mPolynomial( s, s ),
         mInterval( 0, 0 ),
-        mSturmSequence( RationalUnivariatePolynomial::standardSturmSequence( mPolynomial, mPolynomial.diff() )),
+        mSturmSequence( RationalUnivariatePolynomial::sturmSequence( mPolynomial, mPolynomial.diff() )),
+        mSturmSequenceStrategy( RealAlgebraicNumberSettings::DEFAULT_STURMSEQUENCESTRATEGY ),
         mRefinementCount( 0 )
     {
         setflag( status_flags::expanded );
@@ -76,7 +78,8 @@ namespace GiNaCRA
                                                   const OpenInterval& i,
                                                   const list<RationalUnivariatePolynomial>& seq,
                                                   const bool normalize,
-                                                  const bool isRoot )
+                                                  const bool isRoot,
+                                                  RealAlgebraicNumberSettings::SturmSequenceStrategy strategy )
             throw ( invalid_argument ):
         RealAlgebraicNumber( isRoot,
                              false,
@@ -87,7 +90,8 @@ namespace GiNaCRA
         mPolynomial( p ),
 #endif
         mInterval( i ),
-        mSturmSequence( seq.empty() ? RationalUnivariatePolynomial::standardSturmSequence( p, p.diff() ) : seq ),
+        mSturmSequence( seq.empty() ? RationalUnivariatePolynomial::sturmSequence( p, p.diff(), strategy ) : seq ),
+        mSturmSequenceStrategy( strategy ),
         mRefinementCount( 0 )
     {
         if( mPolynomial.isConstant() )
@@ -196,8 +200,9 @@ namespace GiNaCRA
     {
         mInterval        = o.mInterval;
         mPolynomial      = o.mPolynomial;
-        mSturmSequence   = o.mSturmSequence;
-        mRefinementCount = o.mRefinementCount;
+        mSturmSequence         = o.mSturmSequence;
+        mSturmSequenceStrategy = o.mSturmSequenceStrategy;
+        mRefinementCount       = o.mRefinementCount;
         if( mInterval.contains( 0 ))
             mIsNumeric = true;
         else
@@ -375,7 +380,7 @@ namespace GiNaCRA
 
     GiNaC::sign RealAlgebraicNumberIR::sgn( const RationalUnivariatePolynomial& p ) const
     {
-        list<RationalUnivariatePolynomial> seq = RationalUnivariatePolynomial::standardSturmSequence(
+        list<RationalUnivariatePolynomial> seq = RationalUnivariatePolynomial::sturmSequence(
                                                      mPolynomial,
                                                      mPolynomial.isCompatible( p )
                                                      ? (RationalUnivariatePolynomial)mPolynomial.diff() * p
@@ -383,7 +388,8 @@ namespace GiNaCRA
                                                          mPolynomial.diff()
                                                          * p.subs(
                                                              GiNaC::lst( p.variable() ),
-                                                             GiNaC::lst( mPolynomial.variable() )), mPolynomial.variable() ));
+                                                             GiNaC::lst( mPolynomial.variable() )), mPolynomial.variable() ),
+                                                     mSturmSequenceStrategy );
         switch( RationalUnivariatePolynomial::signVariations( seq, (mInterval).left() )
                 - RationalUnivariatePolynomial::signVariations( seq, (mInterval).right() ))
         {
@@ -410,7 +416,7 @@ namespace GiNaCRA
         ex res = UnivariatePolynomial( mPolynomial.subs( x == static_cast<ex>(x)-static_cast<ex>(y) ),
                                        y ).resultant( UnivariatePolynomial( o.mPolynomial.subs( x_o == y ), y ));
         RationalUnivariatePolynomial p = RationalUnivariatePolynomial( res, x ).primpart();
-        list<RationalUnivariatePolynomial> seq = RationalUnivariatePolynomial::standardSturmSequence( p, p.diff() );
+        list<RationalUnivariatePolynomial> seq = RationalUnivariatePolynomial::sturmSequence( p, p.diff(), mSturmSequenceStrategy );
         OpenInterval i = mInterval + o.mInterval;    // interval of the new real algebraic number, possibly needs to be refined
         while( RationalUnivariatePolynomial::signVariations( seq, i.left() ) - RationalUnivariatePolynomial::signVariations( seq, i.right() ) > 1 )
         {    // refine as long as exactly one sign variation within the new interval
@@ -418,7 +424,7 @@ namespace GiNaCRA
             o.refine();
             i = mInterval + o.mInterval;    // refined interval of the new algebraic number
         }
-        return *new RealAlgebraicNumberIR( p, i, seq );
+        return *new RealAlgebraicNumberIR( p, i, seq, true, true, mSturmSequenceStrategy );
     }
 
     RealAlgebraicNumberIR& RealAlgebraicNumberIR::minus() const
@@ -427,7 +433,7 @@ namespace GiNaCRA
             return *new RealAlgebraicNumberIR( *this );
         RationalUnivariatePolynomial p( mPolynomial.subs( mPolynomial.variable() == -static_cast<ex>(mPolynomial.variable())),
                                         mPolynomial.variable() );
-        return *new RealAlgebraicNumberIR( p, -mInterval, list<RationalUnivariatePolynomial>(), false );    // prohibit normalization
+        return *new RealAlgebraicNumberIR( p, -mInterval, list<RationalUnivariatePolynomial>(), false, true, mSturmSequenceStrategy );    // prohibit normalization
     }
 
     RealAlgebraicNumberIR& RealAlgebraicNumberIR::mul( RealAlgebraicNumberIR& o ) throw ( invalid_argument )
@@ -441,7 +447,7 @@ namespace GiNaCRA
         p = RationalUnivariatePolynomial( resultant( GiNaC::pow( y, mPolynomial.degree() )
                                                      * mPolynomial.subs( x == (static_cast<ex>(x) / static_cast<ex>(y)) ), o.mPolynomial.subs( x_o
                                                                          == y ), y ), x ).primpart();
-        list<RationalUnivariatePolynomial> seq = RationalUnivariatePolynomial::standardSturmSequence( p, p.diff() );
+        list<RationalUnivariatePolynomial> seq = RationalUnivariatePolynomial::sturmSequence( p, p.diff(), mSturmSequenceStrategy );
         OpenInterval i = mInterval * o.mInterval;    // interval of the new real algebraic number, possibly needs to be refined
         while( RationalUnivariatePolynomial::signVariations( seq, i.left() ) - RationalUnivariatePolynomial::signVariations( seq, i.right() )
                 > numeric( 1 ))
@@ -450,7 +456,7 @@ namespace GiNaCRA
             o.refine();
             i = mInterval * o.mInterval;    // refined interval of the new algebraic number
         }
-        return *new RealAlgebraicNumberIR( p, i, seq );
+        return *new RealAlgebraicNumberIR( p, i, seq, true, true, mSturmSequenceStrategy );
     }
 
     RealAlgebraicNumberIR& RealAlgebraicNumberIR::inverse() const throw ( invalid_argument )
@@ -459,7 +465,11 @@ namespace GiNaCRA
             (GiNaC::pow( mPolynomial.variable(), mPolynomial.degree() )
              * (mPolynomial.subs(
                  mPolynomial.variable() == (numeric( 1 ) / static_cast<ex>(mPolynomial.variable()))))).expand(), mPolynomial.variable() ).primpart(),
-                                           OpenInterval( mInterval.right().inverse(), mInterval.left().inverse() ));
+                                           OpenInterval( mInterval.right().inverse(), mInterval.left().inverse() ),
+                                           list<RationalUnivariatePolynomial>(),
+                                           true,
+                                           true,
+                                           mSturmSequenceStrategy );
     }
 
     RealAlgebraicNumberIR& RealAlgebraicNumberIR::pow( int e ) throw ( invalid_argument )
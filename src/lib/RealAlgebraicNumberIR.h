@@ -46,7 +46,7 @@ namespace GiNaCRA
      *
      * @author Ulrich Loup
      * @since 2010-07-28
-     * @version 2012-05-07
+     * @version 2026-10-18
      * @see ISBN 0-387-94090-1 and ISBN-13: 978-3642069642
      */
     class RealAlgebraicNumberIR:
@@ -79,15 +79,17 @@ namespace GiNaCRA
              *
              * @param p polynomial having the real algebraic number as one of its roots
              * @param i open interval ]l, r[ containing the real algebraic number (should be normalized)
-             * @param s standard Sturm sequence
+             * @param s Sturm sequence of p and its derivative, see RationalUnivariatePolynomial::sturmSequence (computed if empty)
              * @param normalize if set to false, the interval will not be normalized in the constructor (default is true)
              * @param isRoot true marks this real algebraic number to stem from a root computation
+             * @param strategy sequence used for counting real roots of p, also by the numbers computed from this one (should be the one s was computed with)
              */
             RealAlgebraicNumberIR( const RationalUnivariatePolynomial& p,
                                    const OpenInterval& i,
                                    const list<RationalUnivariatePolynomial>& s = list<RationalUnivariatePolynomial>(),
                                    const bool normalize = true,
-                                   const bool isRoot = true )
+                                   const bool isRoot = true,
+                                   RealAlgebraicNumberSettings::SturmSequenceStrategy strategy = RealAlgebraicNumberSettings::DEFAULT_STURMSEQUENCESTRATEGY )
                     throw ( invalid_argument );
 
             /**
@@ -123,14 +125,23 @@ namespace GiNaCRA
             }
 
             /**
-             * Returns a pre-computed standard Sturm sequence of the polynomial and its derivative.
-             * @return standard Sturm sequence of the polynomial and its derivative.
+             * Returns a pre-computed Sturm sequence of the polynomial and its derivative, see RationalUnivariatePolynomial::sturmSequence.
+             * @return Sturm sequence of the polynomial and its derivative.
              */
             const list<RationalUnivariatePolynomial> sturmSequence() const
             {
                 return mSturmSequence;
             }
 
+            /**
+             * Selects the strategy the Sturm sequence of this real algebraic number and of the numbers computed from it are generated with.
+             * @return strategy for the Sturm sequences of this real algebraic number
+             */
+            RealAlgebraicNumberSettings::SturmSequenceStrategy sturmSequenceStrategy() const
+            {
+                return mSturmSequenceStrategy;
+            }
+
             /** Returns how often one of the refine methods was called before.
              * @return number of refinement steps executed on this real algebraic number
              */
@@ -315,8 +326,10 @@ namespace GiNaCRA
             RationalUnivariatePolynomial mPolynomial;
             /// isolating interval of this interval representation
             OpenInterval mInterval;
-            /// Standard Sturm sequence of the polynomial and its derivative
+            /// Sturm sequence of the polynomial and its derivative
             list<RationalUnivariatePolynomial> mSturmSequence;
+            /// strategy mSturmSequence was generated with
+            RealAlgebraicNumberSettings::SturmSequenceStrategy mSturmSequenceStrategy;
             /// number of refinements executed to the isolating interval
             unsigned mRefinementCount;
 
@@ -27,13 +27,16 @@
  *
  * @author Ulrich Loup
  * @since 2010-08-03
- * @version 2012-04-19
+ * @version 2026-10-18
  * @see ISBN 0-387-94090-1 and ISBN-13: 978-3642069642
  */
 
 #include <assert.h>
 
 #include "UnivariatePolynomial.h"
+#include "ModularSubresultants.h"
+#include "DenseUnivariateArithmetic.h"
+#include "ModularGcd.h"
 #include "operators.h"
 #include "RealAlgebraicNumberIR.h"
 
@@ -100,6 +103,16 @@ namespace GiNaCRA
             return UnivariatePolynomial( e - e.lcoeff( ex_s ) * pow( this->variable(), e.degree( ex_s )), this->variable(), mEnabledPolynomialCheck );
     }
 
+    ex UnivariatePolynomial::content() const
+    {
+        return ModularGcd::content( *this, mVariable );
+    }
+
+    UnivariatePolynomial UnivariatePolynomial::primpart() const
+    {
+        return UnivariatePolynomial( ex::primpart( mVariable, content() ), mVariable, mEnabledPolynomialCheck );
+    }
+
     UnivariatePolynomial UnivariatePolynomial::sepapart() const
     {
         if( isConstant() )    // prevent division by zero
@@ -122,6 +135,44 @@ namespace GiNaCRA
     // Arithmetic Operations //
     ///////////////////////////
 
+    const UnivariatePolynomial UnivariatePolynomial::rem( const UnivariatePolynomial& o ) const
+    {
+        DenseUnivariateArithmetic::RationalPolynomial a, b, quotient, remainder;
+        if( degree() >= DenseUnivariateArithmetic::DEGREE_THRESHOLD && !o.isZero() && DenseUnivariateArithmetic::coefficients( *this, mVariable, a )
+                && DenseUnivariateArithmetic::coefficients( o, mVariable, b ))
+        {
+            DenseUnivariateArithmetic::divide( a, b, quotient, remainder );
+            return UnivariatePolynomial( DenseUnivariateArithmetic::expression( remainder, mVariable ), mVariable );
+        }
+        return UnivariatePolynomial( GiNaC::rem( *this, o, mVariable ), mVariable );
+    }
+
+    const UnivariatePolynomial UnivariatePolynomial::quo( const UnivariatePolynomial& o ) const
+    {
+        DenseUnivariateArithmetic::RationalPolynomial a, b, quotient, remainder;
+        if( degree() >= DenseUnivariateArithmetic::DEGREE_THRESHOLD && !o.isZero() && DenseUnivariateArithmetic::coefficients( *this, mVariable, a )
+                && DenseUnivariateArithmetic::coefficients( o, mVariable, b ))
+        {
+            DenseUnivariateArithmetic::divide( a, b, quotient, remainder );
+            return UnivariatePolynomial( DenseUnivariateArithmetic::expression( quotient, mVariable ), mVariable, mEnabledPolynomialCheck );
+        }
+        return UnivariatePolynomial( GiNaC::quo( *this, o, mVariable ), mVariable, mEnabledPolynomialCheck );
+    }
+
+    const UnivariatePolynomial UnivariatePolynomial::gcd( const UnivariatePolynomial& o ) const
+    {
+        DenseUnivariateArithmetic::RationalPolynomial a, b;
+        if( degree() >= DenseUnivariateArithmetic::DEGREE_THRESHOLD && o.degree() >= DenseUnivariateArithmetic::DEGREE_THRESHOLD
+                && DenseUnivariateArithmetic::coefficients( *this, mVariable, a ) && DenseUnivariateArithmetic::coefficients( o, mVariable, b )
+                && integer_content().is_integer() && o.integer_content().is_integer() )
+        {
+            // the monic gcd over the rationals determines the gcd over the integers up to the contents
+            ex g = DenseUnivariateArithmetic::expression( DenseUnivariateArithmetic::gcd( a, b ), mVariable );
+            return UnivariatePolynomial( GiNaC::gcd( integer_content(), o.integer_content() ) * g.primpart( mVariable ), mVariable, mEnabledPolynomialCheck );
+        }
+        return UnivariatePolynomial( ModularGcd::gcd( *this, o ), mVariable, mEnabledPolynomialCheck );
+    }
+
     const list<UnivariatePolynomial> UnivariatePolynomial::subresultants( const UnivariatePolynomial& p,
                                                                           const UnivariatePolynomial& q,
                                                                           const subresultantStrategy strategy )
@@ -152,13 +203,14 @@ namespace GiNaCRA
         subresultants.push_front( b );
         //            if( aDeg < 2 )
         //                return subresultants;
+        // the principal coefficient of the subresultant with the index of the smaller degree
+        ex subresLcoeff = GiNaC::pow( b.lcoeff(), a.degree() - b.degree() );
         UnivariatePolynomial tmp = UnivariatePolynomial( b );    // the smaller degree
         b                        = UnivariatePolynomial( GiNaC::prem( a, -b, variable, false ), variable, false );
         a                        = tmp;
 
         int aDeg = a.degree();
         int bDeg = b.degree();
-        ex subresLcoeff = GiNaC::pow( a.lcoeff(), aDeg - bDeg );    // initialized on the basis of the smaller-degree polynomial
 
         // MAIN: start main loop containing different computation strategies
         while( true )
@@ -176,17 +228,19 @@ namespace GiNaCRA
                 {
                     case GENERIC_SUBRESULTANTSTRATEGY:
                     {
-                        ex reductionCoeff;
-                        GiNaC::divide( GiNaC::pow( b.lcoeff(), delta - 1 ), GiNaC::pow( subresLcoeff, delta - 1 ), reductionCoeff, false );
+                        ex reductionCoeff = exactQuotient( GiNaC::pow( b.lcoeff(), delta - 1 ), GiNaC::pow( subresLcoeff, delta - 1 ));
                         c = UnivariatePolynomial( reductionCoeff * b, variable, false );
                         break;
                     }
                     case LAZARDS_SUBRESULTANTSTRATEGY:
-                        /// @todo implement using page 151 of the above mentioned article
-                        break;
                     case DUCOS_SUBRESULTANTSTRATEGY:
-                        /// @todo implement using page 154 of the above mentioned article
+                    case MODULAR_SUBRESULTANTSTRATEGY:
+                    {
+                        // page 151 of the above mentioned article: divide by subresLcoeff after each squaring
+                        ex reducedB = exactQuotient( GiNaC::expand( lazardsPower( b.lcoeff(), subresLcoeff, delta - 1 ) * b ), subresLcoeff );
+                        c = UnivariatePolynomial( reducedB, variable, false );
                         break;
+                    }
                 }
                 subresultants.push_front( c );
             }
@@ -196,17 +250,15 @@ namespace GiNaCRA
             switch( strategy )
             {
                 case GENERIC_SUBRESULTANTSTRATEGY:
+                case LAZARDS_SUBRESULTANTSTRATEGY:
                 {
-                    ex reducedNewB;
-                    GiNaC::divide( GiNaC::prem( a, -b, variable, false ), GiNaC::pow( subresLcoeff, delta ) * a.lcoeff(), reducedNewB, false );
+                    ex reducedNewB = exactQuotient( GiNaC::prem( a, -b, variable, false ), GiNaC::pow( subresLcoeff, delta ) * a.lcoeff() );
                     b = UnivariatePolynomial( reducedNewB, variable, false );
                     break;
                 }
-                case LAZARDS_SUBRESULTANTSTRATEGY:
-                    /// @todo implement using page 151 of the above mentioned article
-                    break;
                 case DUCOS_SUBRESULTANTSTRATEGY:
-                    /// @todo implement using page 154 of the above mentioned article
+                case MODULAR_SUBRESULTANTSTRATEGY:
+                    b = ducosReduction( a, b, c, subresLcoeff );
                     break;
             }
             a            = c;
@@ -229,6 +281,8 @@ namespace GiNaCRA
                                                                               const UnivariatePolynomial& b,
                                                                               const subresultantStrategy strategy )
     {
+        if( strategy == MODULAR_SUBRESULTANTSTRATEGY )
+            return ModularSubresultants::principalSubresultantCoefficients( a, b );
         list<UnivariatePolynomial> subres       = UnivariatePolynomial::subresultants( a, b, strategy );
         vector<ex>                 subresCoeffs = vector<ex>( subres.size() );
         int                        i            = 0;
@@ -261,6 +315,22 @@ namespace GiNaCRA
         ex p            = a, q = b;
         symbol variable = a.mVariable;
         seq.push_back( a );
+        DenseUnivariateArithmetic::RationalPolynomial denseP, denseQ, quotient, remainder;
+        if( (a.degree() >= DenseUnivariateArithmetic::DEGREE_THRESHOLD || b.degree() >= DenseUnivariateArithmetic::DEGREE_THRESHOLD)
+                && DenseUnivariateArithmetic::coefficients( a, variable, denseP ) && DenseUnivariateArithmetic::coefficients( b, variable, denseQ ))
+        {
+            // the same remainder sequence on dense coefficient vectors
+            while( !denseQ.empty() )
+            {
+                seq.push_back( UnivariatePolynomial( DenseUnivariateArithmetic::expression( denseQ, variable ), variable ));
+                DenseUnivariateArithmetic::divide( denseP, denseQ, quotient, remainder );
+                for( unsigned i = 0; i < remainder.size(); ++i )
+                    remainder[i] = -remainder[i];
+                denseP.swap( denseQ );
+                denseQ.swap( remainder );
+            }
+            return seq;
+        }
         while( !q.is_zero() )
         {
             seq.push_back( UnivariatePolynomial( q, variable ));
@@ -301,5 +371,67 @@ namespace GiNaCRA
     {
         return (a.degree() < b.degree() && GiNaC::is_even( a.degree() )) || (a.degree() == b.degree() && univariatePolynomialIsLess( a, b ));
     }
+
+    ///////////////////////
+    // Auxiliary Methods //
+    ///////////////////////
+
+    const ex UnivariatePolynomial::lazardsPower( const ex& x, const ex& y, int n ) throw ( invalid_argument )
+    {
+        // binary powering of x, keeping the intermediate results small by exact divisions by y
+        int a = 1;
+        while( 2 * a <= n )
+            a *= 2;
+        ex result = x;
+        n -= a;
+        while( a != 1 )
+        {
+            a /= 2;
+            result = exactQuotient( GiNaC::expand( result * result ), y );
+            if( n >= a )
+            {
+                result = exactQuotient( GiNaC::expand( result * x ), y );
+                n -= a;
+            }
+        }
+        return result;
+    }
+
+    const UnivariatePolynomial UnivariatePolynomial::ducosReduction( const UnivariatePolynomial& a,
+                                                                     const UnivariatePolynomial& b,
+                                                                     const UnivariatePolynomial& c,
+                                                                     const ex& s ) throw ( invalid_argument )
+    {
+        // page 154 of the above mentioned article: the pseudo-remainder of a by b is composed from the reductions of x^j * c by b
+        symbol variable = a.mVariable;
+        int    d        = a.degree();
+        int    e        = b.degree();
+        ex     cLcoeff  = c.lcoeff();
+        ex     bLcoeff  = b.lcoeff();
+        vector<ex> h = vector<ex>( d );
+        for( int j = 0; j < e; ++j )
+            h[j] = cLcoeff * GiNaC::pow( variable, j );
+        h[e] = GiNaC::expand( cLcoeff * GiNaC::pow( variable, e ) - c );
+        for( int j = e + 1; j < d; ++j )
+        {
+            ex shifted = GiNaC::expand( variable * h[j - 1] );
+            h[j] = GiNaC::expand( shifted - exactQuotient( GiNaC::expand( shifted.coeff( variable, e ) * b ), bLcoeff ));
+        }
+        ex sum = 0;
+        for( int j = 0; j < d; ++j )
+            sum += a.coeff( j ) * h[j];
+        ex reducedSum = exactQuotient( GiNaC::expand( sum ), a.lcoeff() );
+        ex shifted    = GiNaC::expand( variable * h[d - 1] );
+        ex result     = exactQuotient( GiNaC::expand( bLcoeff * (shifted + reducedSum) - shifted.coeff( variable, e ) * b ), s );
+        return UnivariatePolynomial( (d - e) % 2 == 0 ? -result : result, variable, false );
+    }
+
+    const ex UnivariatePolynomial::exactQuotient( const ex& a, const ex& b ) throw ( invalid_argument )
+    {
+        ex quotient;
+        if( !GiNaC::divide( a, b, quotient, false ))
+            throw invalid_argument( "The coefficients do not allow the exact divisions of the subresultant computation." );
+        return quotient;
+    }
 }    // namespace GiNaC
 
@@ -45,7 +45,7 @@ namespace GiNaCRA
      *
      * @author Ulrich Loup
      * @since 2010-08-03
-     * @version 2012-05-19
+     * @version 2026-10-18
      * @see ISBN 0-387-94090-1 and ISBN-13: 978-3642069642
      */
     class UnivariatePolynomial:
@@ -167,12 +167,11 @@ namespace GiNaCRA
             }
 
             /**
+             * The content is the gcd of the coefficients of this polynomial, which are computed by the modular multivariate gcd of ModularGcd
+             * if they are integer polynomials in further variables.
              * @return the content of this polynomial
              */
-            ex content() const
-            {
-                return ex::content( mVariable );
-            }
+            ex content() const;
 
             /**
              * @param nth
@@ -225,10 +224,7 @@ namespace GiNaCRA
             /**
              * @return primitive part of the univariate polynomial
              */
-            UnivariatePolynomial primpart() const
-            {
-                return UnivariatePolynomial( ex::primpart( mVariable ), mVariable, mEnabledPolynomialCheck );
-            }
+            UnivariatePolynomial primpart() const;
 
             /**
              * @param content precomputed content of this polynomial
@@ -285,23 +281,21 @@ namespace GiNaCRA
 
             /**
              * Compute the remainder of <code>o</code> modulo the given polynomial in <b>this</b> variable.
+             *
+             * For rational polynomials of degree at least DenseUnivariateArithmetic::DEGREE_THRESHOLD, the remainder is computed by Newton iteration.
              * @param o other polynomial
              * @return
              */
-            const UnivariatePolynomial rem( const UnivariatePolynomial& o ) const
-            {
-                return UnivariatePolynomial( GiNaC::rem( *this, o, mVariable ), mVariable );
-            }
+            const UnivariatePolynomial rem( const UnivariatePolynomial& o ) const;
 
             /**
              * Compute the quotient of division by <code>o</code> in <b>this</b> variable.
+             *
+             * For rational polynomials of degree at least DenseUnivariateArithmetic::DEGREE_THRESHOLD, the quotient is computed by Newton iteration.
              * @param o other polynomial
              * @return
              */
-            const UnivariatePolynomial quo( const UnivariatePolynomial& o ) const
-            {
-                return UnivariatePolynomial( GiNaC::quo( *this, o, mVariable ), mVariable, mEnabledPolynomialCheck );
-            }
+            const UnivariatePolynomial quo( const UnivariatePolynomial& o ) const;
 
             /**
              * Compute the sum of this and <code>o</code> in <b>this</b> variable.
@@ -343,15 +337,15 @@ namespace GiNaCRA
             }
 
             /**
-             * Computes the greatest common divisor of this polynomial and the given by Euclid's algorithm.
+             * Computes the greatest common divisor of this polynomial and the given.
              *
+             * For integer polynomials of degree at least DenseUnivariateArithmetic::DEGREE_THRESHOLD, the half-gcd algorithm is used and
+             * the result is the primitive greatest common divisor with positive leading coefficient, multiplied by the gcd of the contents.
+             * Other integer polynomials, possibly in further variables, are handled by the modular algorithm of ModularGcd.
              * @param o
              * @return the greatest common divisor of this polynomial and the given
              */
-            const UnivariatePolynomial gcd( const UnivariatePolynomial& o ) const
-            {
-                return UnivariatePolynomial( GiNaC::gcd( *this, o ), mVariable, mEnabledPolynomialCheck );
-            }
+            const UnivariatePolynomial gcd( const UnivariatePolynomial& o ) const;
 
             /**
              * Compute the resultant of <code>o</code> and the given polynomial in <b>this</b> variable.
@@ -387,6 +381,9 @@ namespace GiNaCRA
             /**
              * Generates a standard Sturm sequence by generating an additively inverted polynomial remainder sequence.
              *
+             * For rational polynomials of degree at least DenseUnivariateArithmetic::DEGREE_THRESHOLD, the remainders are computed by
+             * Newton iteration on dense coefficient vectors.
+             *
              * Convention: If one polynomial is zero, the corresponding Sturm sequence is zero followed by the other polynomial.
              *
              * @param a
@@ -463,6 +460,7 @@ namespace GiNaCRA
                 GENERIC_SUBRESULTANTSTRATEGY = 0,    /* * Generic algorithm. */
                 LAZARDS_SUBRESULTANTSTRATEGY = 1,    /* * Perform Lazard's optimization. */
                 DUCOS_SUBRESULTANTSTRATEGY = 2,    /* * Perform Ducos' optimization. */
+                MODULAR_SUBRESULTANTSTRATEGY = 3,    /* * Principal subresultant coefficients by ModularSubresultants, otherwise Ducos' optimization. */
             };
 
             /**
@@ -476,6 +474,7 @@ namespace GiNaCRA
              * @param b the second Polynomial
              * @param strategy choice of optimization. Standard is none, other possibilities are due to the sections 2 and 3 of the paper.
              * @return the subresultant sequence in descending order of degree.
+             * @throws invalid_argument if one of the divisions which are exact by the subresultant theory fails
              * @complexity O( deg(a)*deg(b) )
              */
             static const list<UnivariatePolynomial> subresultants( const UnivariatePolynomial& a,
@@ -498,6 +497,9 @@ namespace GiNaCRA
             /**
              * Returns the i-th coefficients of the i-th subresultant of a and b at the i-th position of the result vector.
              *
+             * With MODULAR_SUBRESULTANTSTRATEGY, the coefficients are computed by ModularSubresultants::principalSubresultantCoefficients,
+             * which returns the principal subresultant coefficients for all indices up to the smaller degree.
+             *
              * @param a the first Polynomial
              * @param b the second Polynomial
              * @param strategy choice of optimization. Standard is none, other possibilities are due to the sections 2 and 3 of the paper.
@@ -529,6 +531,40 @@ namespace GiNaCRA
             // Auxiliary Methods //
             ///////////////////////
 
+            /**
+             * Computes x^n / y^(n-1) by Lazard's optimization, i.e., by binary powering with an exact division by y
+             * after each multiplication, which keeps the intermediate results small.
+             * @param x
+             * @param y
+             * @param n positive exponent
+             * @return x^n / y^(n-1), which has to be a polynomial
+             * @throws invalid_argument if one of the intermediate divisions by y is not exact
+             */
+            static const ex lazardsPower( const ex& x, const ex& y, int n ) throw ( invalid_argument );
+
+            /**
+             * Computes the next subresultant following Ducos' optimization instead of a pseudo-division.
+             * @param a subresultant of degree d
+             * @param b subresultant of index d-1 and degree e
+             * @param c subresultant of index and degree e
+             * @param s principal coefficient of a
+             * @return subresultant of index e-1
+             * @throws invalid_argument if one of the divisions by the leading coefficients of a, b or by s is not exact
+             */
+            static const UnivariatePolynomial ducosReduction( const UnivariatePolynomial& a,
+                                                              const UnivariatePolynomial& b,
+                                                              const UnivariatePolynomial& c,
+                                                              const ex& s ) throw ( invalid_argument );
+
+            /**
+             * Divides a by b, where the subresultant theory guarantees that the division is exact.
+             * @param a dividend
+             * @param b divisor
+             * @return a / b as polynomial
+             * @throws invalid_argument if b does not divide a, i.e., the input broke an assumption of the subresultant computation
+             */
+            static const ex exactQuotient( const ex& a, const ex& b ) throw ( invalid_argument );
+
     };    // class UnivariatePolynomial
 
 }    // namespace GiNaC
@@ -0,0 +1,90 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#include "UnivariatePolynomialPool.h"
+
+/**
+ * Implementation of UnivariatePolynomialPool.
+ * @since 2026-10-18
+ * @version 2026-10-18
+ */
+
+namespace GiNaCRA
+{
+    std::vector<UnivariatePolynomial> UnivariatePolynomialPool::mPolynomials;
+    std::unordered_map<UnivariatePolynomial, unsigned, UnivariatePolynomialSetHasher, UnivariatePolynomialSetEquals> UnivariatePolynomialPool::mIds;
+    std::map<UnivariatePolynomialPool::Key, std::vector<unsigned> > UnivariatePolynomialPool::mCache;
+    unsigned UnivariatePolynomialPool::mUsers = 0;
+
+    ///////////////
+    // Selectors //
+    ///////////////
+
+    unsigned UnivariatePolynomialPool::intern( const UnivariatePolynomial& p )
+    {
+        // the id of p is the id of its canonical representative, only the representatives are stored
+        UnivariatePolynomial representative = canonical( p );
+        std::unordered_map<UnivariatePolynomial, unsigned, UnivariatePolynomialSetHasher, UnivariatePolynomialSetEquals>::const_iterator id = mIds.find( representative );
+        if( id != mIds.end() )
+            return id->second;
+        unsigned result = mPolynomials.size();
+        mPolynomials.push_back( representative );
+        mIds[representative] = result;
+        return result;
+    }
+
+    const UnivariatePolynomial UnivariatePolynomialPool::canonical( const UnivariatePolynomial& p )
+    {
+        if( p.isZero() )
+            return p;
+        ex e = p;
+        return UnivariatePolynomial( (e / (e.integer_content() * e.unit( p.variable() ))).expand(), p.variable() );
+    }
+
+    bool UnivariatePolynomialPool::cached( const Key& key, std::vector<unsigned>& value )
+    {
+        std::map<Key, std::vector<unsigned> >::const_iterator entry = mCache.find( key );
+        if( entry == mCache.end() )
+            return false;
+        value = entry->second;
+        return true;
+    }
+
+    ///////////////
+    // Modifiers //
+    ///////////////
+
+    void UnivariatePolynomialPool::clear()
+    {
+        mPolynomials.clear();
+        mIds.clear();
+        mCache.clear();
+    }
+
+    void UnivariatePolynomialPool::release()
+    {
+        if( mUsers > 0 && --mUsers == 0 )
+            clear();
+    }
+
+}    // namespace GiNaCRA
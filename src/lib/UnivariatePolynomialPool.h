@@ -0,0 +1,162 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef GINACRA_UNIVARIATEPOLYNOMIALPOOL_H
+#define GINACRA_UNIVARIATEPOLYNOMIALPOOL_H
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "UnivariatePolynomialSet.h"
+
+namespace GiNaCRA
+{
+    /**
+     * Global pool interning univariate polynomials by unique ids.
+     *
+     * Every polynomial is identified with its canonical representative, which is the polynomial divided by its integer content
+     * and by its unit, i.e., it has coprime integer coefficients and a positive leading coefficient, with the same main variable.
+     * Two polynomials get the same id if and only if they coincide up to a non-zero rational factor, so that they have the same
+     * real zeros. Comparing and hashing ids is an integer operation, and every canonical representative is stored only once.
+     *
+     * Furthermore, the pool provides a cache of id lists keyed by id lists, which can be used to store results of operations on
+     * interned polynomials, such as CAD projections.
+     *
+     * The ids are only used as keys of this cache. UnivariatePolynomialSet still stores the polynomials themselves and compares them
+     * structurally, because its users work with the polynomials, not with ids. So interning saves recomputing projections of polynomials
+     * seen before, but it does not make the comparisons within the projection sets cheaper.
+     *
+     * The pool lives as long as it has users: every CAD object registers itself by acquire and unregisters by release, and the pool
+     * is cleared when the last user is gone. Code using the pool without a CAD object, e.g., the static CAD::eliminationSet, should
+     * call clear when it is done. The pool is global to the process and has no locking, so it must only be used by one thread at a
+     * time. In particular, CAD objects sharing the pool must not be used concurrently.
+     *
+     * @since 2026-10-18
+     * @version 2026-10-18
+     */
+    class UnivariatePolynomialPool
+    {
+        public:
+
+            /// key of the cache, composed of ids and other integer parameters
+            typedef std::vector<unsigned> Key;
+
+            ///////////////
+            // Selectors //
+            ///////////////
+
+            /**
+             * Returns the id of the canonical representative of p, adding the representative to the pool if necessary.
+             * @param p
+             * @return the id of p
+             */
+            static unsigned intern( const UnivariatePolynomial& p );
+
+            /**
+             * @param id an id returned by intern
+             * @return the canonical representative with the given id
+             */
+            static const UnivariatePolynomial polynomial( unsigned id )
+            {
+                return mPolynomials[id];
+            }
+
+            /**
+             * @return number of canonical representatives in the pool
+             */
+            static unsigned size()
+            {
+                return mPolynomials.size();
+            }
+
+            /**
+             * @return number of registered users of the pool
+             */
+            static unsigned users()
+            {
+                return mUsers;
+            }
+
+            /**
+             * Computes the canonical representative of p, which has coprime integer coefficients and a positive leading coefficient.
+             * @param p
+             * @return the canonical representative of p
+             */
+            static const UnivariatePolynomial canonical( const UnivariatePolynomial& p );
+
+            /**
+             * Looks up the cache.
+             * @param key
+             * @param value is set to the cached value if there is one
+             * @return true if a value is cached for key, otherwise false
+             */
+            static bool cached( const Key& key, std::vector<unsigned>& value );
+
+            ///////////////
+            // Modifiers //
+            ///////////////
+
+            /**
+             * Stores a value in the cache.
+             * @param key
+             * @param value
+             */
+            static void cache( const Key& key, const std::vector<unsigned>& value )
+            {
+                mCache[key] = value;
+            }
+
+            /**
+             * Removes all polynomials and cached values from the pool. All ids obtained so far become invalid.
+             */
+            static void clear();
+
+            /**
+             * Registers a user of the pool.
+             */
+            static void acquire()
+            {
+                ++mUsers;
+            }
+
+            /**
+             * Unregisters a user of the pool. If there are no users left, the pool is cleared.
+             */
+            static void release();
+
+        protected:
+
+            /// canonical representatives by id
+            static std::vector<UnivariatePolynomial> mPolynomials;
+            /// ids of the canonical representatives
+            static std::unordered_map<UnivariatePolynomial, unsigned, UnivariatePolynomialSetHasher, UnivariatePolynomialSetEquals> mIds;
+            /// cached results of operations on ids
+            static std::map<Key, std::vector<unsigned> > mCache;
+            /// number of registered users
+            static unsigned mUsers;
+    };
+
+}    // namespace GiNaCRA
+
+#endif
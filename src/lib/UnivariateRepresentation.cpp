@@ -20,105 +20,172 @@
  */
 
 
-// #define GINACRA_INTERVALREPRESENTATION_DEBUG
 
 /**
+ * Implementation of the class UnivariateRepresentation.
  *
  * @author Ulrich Loup
  * @since 2011-04-30
- * @version 2011-04-30
+ * @version 2026-10-18
  * @see ISBN 0-387-94090-1 and ISBN-13: 978-3642069642
  *
  * Notation is following http://www.possibility.com/Cpp/CppCodingStandard.html.
  */
 
 #include "UnivariateRepresentation.h"
+#include "RealAlgebraicNumberFactory.h"
+#include "RealAlgebraicNumberIR.h"
+#include "RealAlgebraicNumberNR.h"
 
-namespace GiNaC
+namespace GiNaCRA
 {
-    // Call GiNaC macro (registrar.h) for completing the implementation into the basic type.
-    GINAC_IMPLEMENT_REGISTERED_CLASS_OPT(UnivariateRepresentation, basic, print_func<print_context>( &UnivariateRepresentation::do_print ))
-
     //////////////////////////
     // Con- and destructors //
     //////////////////////////
 
-    ///////////////
-    // Selectors //
-    ///////////////
-
-    /////////////////////////
-    // Methods from basic  //
-    /////////////////////////
-
-    // // * @todo
-    // int UnivariateRepresentation::compare_same_type(const basic & other) const
-    // {
-    //  UnivariateRepresentation o = static_cast<const UnivariateRepresentation &>(other);
-    //  // the following is correct since always l <= r
-    //  if(mInterval == o.mInterval)
-    //      return 0;
-    //  else if(mInterval <= o.mInterval)
-    //      return -1;
-    //  else if(mInterval >= o.mInterval)
-    //      return 1;
-    //  return 0;
-    //  // return this->compare(other);
-    // }
-
-    // // * @todo
-    // bool UnivariateRepresentation::is_equal_same_type(const basic & other)
-    // {
-    //  UnivariateRepresentation o = static_cast<const UnivariateRepresentation &>(other);
-    //  return this->isEqual(o);
-    // }
-
-    // void UnivariateRepresentation::do_print(const print_context & c, unsigned level) const
-    // {
-    //  // print_context::s is a reference to an ostream
-    //  c.s << '{' << static_cast<UnivariatePolynomial>(mPolynomial) << ": " << mInterval << '}';
-    // }
-
-    // ex UnivariateRepresentation::eval(int level) const
-    // {
-    //  // this->refine(); up to a certain bound ?
-    //  return this->hold();
-    // }
-
-    ///////////////
-    // Operators //
-    ///////////////
-
-    // arithmetic operators
-
-    // relational operators
-
-    // assignment operators
-
-    // const UnivariateRepresentation& UnivariateRepresentation::operator=(const UnivariateRepresentation& o)
-    // {
-    //     mInterval = o.mInterval;
-    //     mPolynomial = o.mPolynomial;
-    //     mSturmSequence = o.mSturmSequence;
-    //     mOrder = o.mOrder;
-    //     return *this;
-    // }
+    UnivariateRepresentation::UnivariateRepresentation( const RationalUnivariatePolynomial& rootSource,
+                                                        const RationalUnivariatePolynomial& denominator,
+                                                        const list<RationalUnivariatePolynomial>& numerators,
+                                                        const vector<symbol>& variables,
+                                                        const vector<numeric>& separatingForm )
+            throw ( invalid_argument ):
+        mRootSource( rootSource ),
+        mDenominator( denominator ),
+        mNumerators( numerators ),
+        mVariables( variables ),
+        mSeparatingForm( separatingForm )
+    {
+        if( !rootSource.isCompatible( denominator ))
+            throw invalid_argument( "Symbols of the root source and the denominator do not match." );
+        for( list<RationalUnivariatePolynomial>::const_iterator n = numerators.begin(); n != numerators.end(); ++n )
+        {
+            if( !rootSource.isCompatible( *n ))
+                throw invalid_argument( "Symbols of the root source and the numerators do not match." );
+        }
+        if( numerators.size() != variables.size() )
+            throw invalid_argument( "The number of numerators does not match the number of variables." );
+        if( !separatingForm.empty() && separatingForm.size() != variables.size() )
+            throw invalid_argument( "The separating form does not match the number of variables." );
+        if( !rootSource.gcd( denominator ).isConstant() )
+            throw invalid_argument( "The denominator and the root source have a common root." );
+    }
+
+    UnivariateRepresentation::~UnivariateRepresentation(){}
 
     ////////////////
     // Operations //
     ////////////////
 
-    ///////////////////////////
-    // Arithmetic Operations //
-    ///////////////////////////
-
-    ///////////////////////////
-    // Relational Operations //
-    ///////////////////////////
+    unsigned UnivariateRepresentation::nrOfRealSolutions() const
+    {
+        if( mRootSource.isConstant() )
+            return 0;
+        return mRootSource.countRealRoots();
+    }
+
+    list<RealAlgebraicPoint> UnivariateRepresentation::realSolutions() const
+    {
+        list<RealAlgebraicPoint> solutions = list<RealAlgebraicPoint>();
+        if( mRootSource.isConstant() )
+            return solutions;
+        symbol t = mRootSource.variable();
+        // the components are polynomials in the roots of the root source after inverting the denominator modulo the root source
+        UnivariatePolynomial         inverse    = inverseModulo( mDenominator, mRootSource );
+        vector<UnivariatePolynomial> components = vector<UnivariatePolynomial>();
+        for( list<RationalUnivariatePolynomial>::const_iterator n = mNumerators.begin(); n != mNumerators.end(); ++n )
+            components.push_back( UnivariatePolynomial( GiNaC::rem( GiNaC::expand( static_cast<ex>( *n ) * static_cast<ex>( inverse )), mRootSource, t ), t ));
+
+        list<RealAlgebraicNumberPtr> roots = RealAlgebraicNumberFactory::realRoots( mRootSource );
+        for( list<RealAlgebraicNumberPtr>::const_iterator root = roots.begin(); root != roots.end(); ++root )
+        {
+            RealAlgebraicNumberNRPtr rootNR = std::tr1::dynamic_pointer_cast<RealAlgebraicNumberNR>( *root );
+            RealAlgebraicPoint       point  = RealAlgebraicPoint();
+            for( vector<UnivariatePolynomial>::const_iterator c = components.begin(); c != components.end(); ++c )
+            {
+                if( c->isConstant() )
+                    point.push_back( RealAlgebraicNumberPtr( new RealAlgebraicNumberNR( GiNaC::ex_to<numeric>( c->coeff( 0 )))));
+                else if( rootNR != 0 )
+                    point.push_back( RealAlgebraicNumberPtr( new RealAlgebraicNumberNR( RationalUnivariatePolynomial( *c ).evaluateAt( *rootNR ))));
+                else
+                    point.push_back( RealAlgebraicNumberFactory::evaluateIR( *c,
+                                                                             vector<RealAlgebraicNumberIRPtr>( 1, std::tr1::dynamic_pointer_cast<RealAlgebraicNumberIR>( *root )),
+                                                                             vector<symbol>( 1, t )));
+            }
+            solutions.push_back( point );
+        }
+        return solutions;
+    }
+
+    bool UnivariateRepresentation::initialize( unsigned nrOfSolutions, const vector<numeric>& powerSums, const vector<vector<numeric> >& traces )
+    {
+        symbol   t = symbol( "t" );
+        unsigned d = powerSums.size() - 1;
+        // the characteristic polynomial of the multiplication by u, whose coefficients follow from the power sums by Newton's identities
+        vector<numeric> elementary = vector<numeric>( d + 1, numeric( 0 ));
+        elementary[0] = 1;
+        ex characteristic = GiNaC::pow( t, d );
+        for( unsigned k = 1; k <= d; ++k )
+        {
+            for( unsigned i = 1; i <= k; ++i )
+                elementary[k] = i % 2 == 1 ? elementary[k] + elementary[k - i] * powerSums[i] : elementary[k] - elementary[k - i] * powerSums[i];
+            elementary[k] = elementary[k] / k;
+            characteristic += (k % 2 == 1 ? -elementary[k] : elementary[k]) * GiNaC::pow( t, d - k );
+        }
+        // the square-free part has one root per value of u, so u is separating iff it has one root per solution
+        ex rootSource = d == 0 ? ex( 1 ) : ex( UnivariatePolynomial( characteristic, t ).sepapart() );
+        unsigned delta = rootSource.degree( t );
+        if( delta != nrOfSolutions )
+            return false;
+        rootSource = GiNaC::expand( rootSource / rootSource.lcoeff( t ));
+
+        // the Horner polynomials t^j + a_(delta-1) * t^(j-1) + ... + a_(delta-j) of the root source
+        vector<ex> horner = vector<ex>( delta );
+        ex         h      = 0;
+        for( unsigned j = 0; j < delta; ++j )
+        {
+            h         = GiNaC::expand( h * t + rootSource.coeff( t, delta - j ));
+            horner[j] = h;
+        }
+        // sum_i trace(x_k * u^i) * H_(delta-1-i) takes the value mu * x_k * f'(u) at the solutions with multiplicity mu
+        ex denominator = delta == 0 ? ex( 1 ) : ex( 0 );
+        for( unsigned i = 0; i < delta; ++i )
+            denominator += powerSums[i] * horner[delta - 1 - i];
+        list<RationalUnivariatePolynomial> numerators = list<RationalUnivariatePolynomial>();
+        for( unsigned k = 0; k < traces.size(); ++k )
+        {
+            ex numerator = 0;
+            for( unsigned i = 0; i < delta; ++i )
+                numerator += traces[k][i] * horner[delta - 1 - i];
+            numerators.push_back( RationalUnivariatePolynomial( numerator, t ));
+        }
+        mRootSource  = RationalUnivariatePolynomial( rootSource, t );
+        mDenominator = RationalUnivariatePolynomial( denominator, t );
+        mNumerators  = numerators;
+        return true;
+    }
 
     ////////////////////
     // Static Methods //
     ////////////////////
 
-}    // namespace GiNaC
+    UnivariatePolynomial UnivariateRepresentation::inverseModulo( const UnivariatePolynomial& a, const UnivariatePolynomial& m )
+    {
+        symbol x = m.variable();
+        // extended Euclidean algorithm maintaining s0 * a = r0 and s1 * a = r1 modulo m
+        ex r0 = m, r1 = GiNaC::rem( a, m, x );
+        ex s0 = 0, s1 = 1;
+        while( !r1.is_zero() )
+        {
+            ex q  = GiNaC::quo( r0, r1, x );
+            ex r2 = GiNaC::rem( r0, r1, x );
+            ex s2 = GiNaC::expand( s0 - q * s1 );
+            r0 = r1;
+            r1 = r2;
+            s0 = s1;
+            s1 = s2;
+        }
+        // r0 is a greatest common divisor of a and m, which is a non-zero number since they are coprime
+        return UnivariatePolynomial( GiNaC::rem( GiNaC::expand( s0 / r0 ), m, x ), x );
+    }
 
+}    // namespace GiNaC
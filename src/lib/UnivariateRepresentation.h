@@ -20,36 +20,46 @@
  */
 
 
+
 #ifndef GINACRA_UNIVARIATEREPRESENTATION_H
 #define GINACRA_UNIVARIATEREPRESENTATION_H
 
-#include <ginac/flags.h>
-#include <ginac/registrar.h>
 #include <ginac/ginac.h>
 #include <stdexcept>
 
 #include "RationalUnivariatePolynomial.h"
+#include "RealAlgebraicPoint.h"
+#include "QuotientRingMultiplicationTable.h"
 #include "operators.h"
 
-namespace GiNaC
+namespace GiNaCRA
 {
     /**
-     * An implementation of a multi dimensional real algebraic number providing arithmetic and relational operations.
-     * @todo Write comprehensive description of how real algebraic number is represented via univariate representation and how the other features like getOrder() etc. are implemented.
+     * A rational univariate representation (RUR) of the solutions of a zero-dimensional polynomial system.
+     *
+     * The solutions are represented by a separating linear form u = c_0 * x_0 + ... + c_{n-1} * x_{n-1}, which takes
+     * distinct values at distinct solutions, and by univariate polynomials f, g and g_0, ..., g_{n-1} in a new variable
+     * t, such that the solutions are in one-to-one correspondence with the roots of the square-free root source f via
+     *
+     * x_i = g_i(t) / g(t) for f(t) = 0.
+     *
+     * The denominator g and the root source are coprime. Thus, the real solutions are obtained by one real root
+     * isolation of f, followed by the evaluation of rational functions, instead of lifting through several levels of
+     * real algebraic numbers.
+     *
+     * The representation is computed from the traces in the quotient ring (Rouillier's method): The power sums of the
+     * values of u give its characteristic polynomial, whose square-free part is f, and the traces of x_i * u^j give the
+     * numerators.
      *
      * @author Ulrich Loup
      * @since 2011-04-30
-     * @version 2011-10-30
-     * @see ISBN 0-387-94090-1 and ISBN-13: 978-3642069642
+     * @version 2026-10-18
+     * @see F. Rouillier: Solving Zero-Dimensional Systems Through the Rational Univariate Representation. AAECC 9 (1999) 433-461
      *
      * Notation is following http://www.possibility.com/Cpp/CppCodingStandard.html.
      */
-    class UnivariateRepresentation:
-        public basic
+    class UnivariateRepresentation
     {
-        // Call GiNaC macro (registrar.h) for initiating the implementation into the basic type.
-        GINAC_DECLARE_REGISTERED_CLASS(UnivariateRepresentation, basic)
-
         public:
 
             //////////////////////////
@@ -57,19 +67,47 @@ namespace GiNaC
             //////////////////////////
 
             /**
+             * Constructs the representation from its polynomials.
              *
-             *
-             * @param rootSource
-             * @param denominator
-             * @param numerators
-             * @param variables
+             * @param rootSource square-free polynomial whose roots correspond to the solutions
+             * @param denominator the common denominator of the rational functions, coprime to the root source
+             * @param numerators the numerators of the rational functions, one for each variable
+             * @param variables the variables of the solutions
+             * @param separatingForm the coefficients of the separating linear form in the variables, if known
+             * @throws invalid_argument if the polynomials are not in the same variable, the numbers of numerators and
+             * variables differ or the denominator and the root source have a common root
              */
             UnivariateRepresentation( const RationalUnivariatePolynomial& rootSource,
                                       const RationalUnivariatePolynomial& denominator,
                                       const list<RationalUnivariatePolynomial>& numerators,
-                                      const vector<symbol>& variables )
+                                      const vector<symbol>& variables,
+                                      const vector<numeric>& separatingForm = vector<numeric>() )
                     throw ( invalid_argument );
 
+            /**
+             * Computes the rational univariate representation of the solutions of a zero-dimensional ideal.
+             *
+             * @param groebner a solved and reduced Groebner basis of the ideal
+             * @throws invalid_argument if the basis is not reduced, the ideal is not zero-dimensional or has non-numeric
+             * coefficients
+             * @throws domain_error if the coefficient domain has positive characteristic
+             */
+            template<class Coeff>
+            explicit UnivariateRepresentation( const GroebnerT<Coeff>& groebner )
+                    throw ( invalid_argument, std::domain_error );
+
+            /**
+             * Computes the rational univariate representation of the solutions of a zero-dimensional ideal from the
+             * multiplication table of its quotient ring.
+             *
+             * @param table
+             * @throws invalid_argument if the table has non-numeric coefficients
+             * @throws domain_error if the coefficient domain has positive characteristic
+             */
+            template<class Coeff>
+            explicit UnivariateRepresentation( const QuotientRingMultiplicationTableT<Coeff>& table )
+                    throw ( invalid_argument, std::domain_error );
+
             ~UnivariateRepresentation();
 
             ///////////////
@@ -80,92 +118,62 @@ namespace GiNaC
              *
              * @return polynomial being the source of the roots for evaluating with the rational functions
              */
-            const RationalUnivariatePolynomial RootSource() const;
+            const RationalUnivariatePolynomial RootSource() const
+            {
+                return mRootSource;
+            }
 
             /**
              *
              * @return the denominator of the rational functions
              */
-            const RationalUnivariatePolynomial Denominator() const;
+            const RationalUnivariatePolynomial Denominator() const
+            {
+                return mDenominator;
+            }
 
             /**
              *
              * @return polynomial being the numerators of the rational functions
              */
-            const list<RationalUnivariatePolynomial> Numerators() const;
-
-            ///////////////
-            // Operators //
-            ///////////////
-
-            // // binary arithmetic operators
-            // const UnivariateRepresentation operator+(UnivariateRepresentation);
-            // const UnivariateRepresentation operator-(UnivariateRepresentation);
-            // const UnivariateRepresentation operator*(UnivariateRepresentation);
-            // const UnivariateRepresentation operator/(UnivariateRepresentation);
-
-            // // unary arithmetic operators
-            // const UnivariateRepresentation operator-();
-
-            // relational operators
-            // const bool operator==(const UnivariateRepresentation&);
-            // const bool operator!=(const UnivariateRepresentation&);
-            // const bool operator<(const UnivariateRepresentation&);
-            // const bool operator>(const UnivariateRepresentation&);
-            // const bool operator<=(const UnivariateRepresentation&);
-            // const bool operator>=(const UnivariateRepresentation&);
+            const list<RationalUnivariatePolynomial> Numerators() const
+            {
+                return mNumerators;
+            }
 
-            // assignment operators
+            /**
+             *
+             * @return the variables of the solutions, in the order of the numerators
+             */
+            const vector<symbol> Variables() const
+            {
+                return mVariables;
+            }
 
             /**
-             * This number gets all values of the other.
+             *
+             * @return the coefficients of the separating linear form, or an empty vector if they are unknown
              */
-            // const UnivariateRepresentation& operator=(const UnivariateRepresentation&);
+            const vector<numeric> SeparatingForm() const
+            {
+                return mSeparatingForm;
+            }
 
             ////////////////
             // Operations //
             ////////////////
 
-            ///////////////////////////
-            // Arithmetic Operations //
-            ///////////////////////////
-
-            /** Adds two real algebraic numbers and returns a reference to their sum, allocated on the heap.
-             * @param o
-             * @return sum allocated on the heap
-             */
-            const UnivariateRepresentation add( UnivariateRepresentation o ) throw ( invalid_argument );
-
-            /** Returns the negative value, allocated on the heap.
-             * @return negative value allocated on the heap
-             */
-            const UnivariateRepresentation minus() const;
-
-            /** Multiplies two real algebraic numbers and returns a reference to their product, allocated on the heap.
-             * @param o
-             * @return product allocated on the heap
+            /**
+             * @return the number of distinct real solutions
              */
-            const UnivariateRepresentation mul( UnivariateRepresentation o ) throw ( invalid_argument );
+            unsigned nrOfRealSolutions() const;
 
-            /** Returns the inverse, allocated on the heap.
-             * @return inverse value allocated on the heap
+            /**
+             * Isolates the real roots of the root source and evaluates the rational functions at them.
+             *
+             * @return the real solutions, each with the components ordered like Variables()
              */
-            const UnivariateRepresentation inverse() const throw ( invalid_argument );
-
-            ////////////////////
-            // Static Methods //
-            ////////////////////
-
-        protected:
-
-            ////////////////////////
-            // Methods from basic //
-            ////////////////////////
-
-            bool is_equal_same_type( const basic& other );
-            void do_print( const print_context& c, unsigned level = 0 ) const;
-            ex eval( int level = 0 ) const;
-            // unsigned calchash() const;
+            list<RealAlgebraicPoint> realSolutions() const;
 
         private:
 
@@ -174,24 +182,61 @@ namespace GiNaC
             ////////////////
 
             RationalUnivariatePolynomial       mRootSource;
-            RationalUnivariatePolynomial       mDenominator;    // mDenominator and mRootSource are coprime, i.e., they have a nonzero gcd
+            RationalUnivariatePolynomial       mDenominator;    // mDenominator and mRootSource are coprime, i.e., they have no common root
             list<RationalUnivariatePolynomial> mNumerators;
             vector<symbol>                     mVariables;
-
-            //////////////////////////
-            // Con- and destructors //
-            //////////////////////////
+            vector<numeric>                    mSeparatingForm;
 
             ////////////////
             // Operations //
             ////////////////
 
-            ///////////////////////////
-            // Relational Operations //
-            ///////////////////////////
+            /**
+             * Searches a separating linear form for the given table and computes the representation.
+             * @param table
+             */
+            template<class Coeff>
+            void compute( const QuotientRingMultiplicationTableT<Coeff>& table ) throw ( invalid_argument, std::domain_error );
+
+            /**
+             * Tries a linear form for the given table and computes the representation if it separates the solutions.
+             * @param table
+             * @param form coefficients of the linear form in the variables of the table
+             * @param nrOfSolutions the number of distinct complex solutions
+             * @return true if the linear form is separating
+             */
+            template<class Coeff>
+            bool initialize( const QuotientRingMultiplicationTableT<Coeff>& table, const vector<Coeff>& form, unsigned nrOfSolutions )
+                    throw ( invalid_argument );
+
+            /**
+             * Computes the representation from the power sums of the values of the linear form and the traces of the
+             * variables times its powers, in case the linear form is separating.
+             * @param nrOfSolutions the number of distinct complex solutions
+             * @param powerSums the traces of u^0, ..., u^d for the dimension d of the quotient ring
+             * @param traces for each variable x_i, the traces of x_i * u^0, ..., x_i * u^{d-1}
+             * @return true if the linear form is separating
+             */
+            bool initialize( unsigned nrOfSolutions, const vector<numeric>& powerSums, const vector<vector<numeric> >& traces );
+
+            /**
+             * @param c a coefficient of a numeric coefficient domain
+             * @return the coefficient as numeric
+             * @throws invalid_argument if the coefficient is not a number
+             */
+            template<class Coeff>
+            static numeric toNumeric( const Coeff& c ) throw ( invalid_argument );
 
+            /**
+             * @param a
+             * @param m
+             * @return the inverse of a modulo m, provided that a and m are coprime
+             */
+            static UnivariatePolynomial inverseModulo( const UnivariatePolynomial& a, const UnivariatePolynomial& m );
     };
 
 }    // namespace GiNaC
 
+#include "UnivariateRepresentation.tpp"
+
 #endif
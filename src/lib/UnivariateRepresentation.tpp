@@ -0,0 +1,96 @@
+/**
+ * Implementation of the template methods of the class UnivariateRepresentation. Included by UnivariateRepresentation.h.
+ */
+
+#include "VariableListPool.h"
+
+namespace GiNaCRA
+{
+    template<class Coeff>
+    UnivariateRepresentation::UnivariateRepresentation( const GroebnerT<Coeff>& groebner ) throw ( invalid_argument, std::domain_error )
+    {
+        compute( QuotientRingMultiplicationTableT<Coeff>( groebner ));
+    }
+
+    template<class Coeff>
+    UnivariateRepresentation::UnivariateRepresentation( const QuotientRingMultiplicationTableT<Coeff>& table )
+            throw ( invalid_argument, std::domain_error )
+    {
+        compute( table );
+    }
+
+    template<class Coeff>
+    void UnivariateRepresentation::compute( const QuotientRingMultiplicationTableT<Coeff>& table ) throw ( invalid_argument, std::domain_error )
+    {
+        if( !Coeff::isOrdered )
+            throw std::domain_error( "The rational univariate representation requires a coefficient domain of characteristic zero." );
+        const std::vector<unsigned>& variables = table.variables();
+        mVariables.clear();
+        for( std::vector<unsigned>::const_iterator v = variables.begin(); v != variables.end(); ++v )
+            mVariables.push_back( VariableListPool::getVariableSymbol( *v ));
+        unsigned nrOfSolutions = table.nrOfComplexSolutions();
+        // u = x_0 + c * x_1 + ... + c^(n-1) * x_(n-1) separates two distinct solutions for all but at most n-1 values of c
+        for( long c = 0; ; ++c )
+        {
+            vector<Coeff> form;
+            Coeff         weight = Coeff( 1 );
+            for( unsigned k = 0; k < variables.size(); ++k )
+            {
+                form.push_back( weight );
+                weight = weight * Coeff( c );
+            }
+            if( initialize( table, form, nrOfSolutions ))
+                return;
+        }
+    }
+
+    template<class Coeff>
+    bool UnivariateRepresentation::initialize( const QuotientRingMultiplicationTableT<Coeff>& table, const vector<Coeff>& form, unsigned nrOfSolutions )
+            throw ( invalid_argument )
+    {
+        typedef typename QuotientRingMultiplicationTableT<Coeff>::Vector Vector;
+
+        unsigned                 d = table.dimension();
+        vector<numeric>          powerSums;
+        vector<vector<numeric> > traces( form.size() );
+        // the powers of u, starting at 1 which is the first standard monomial
+        Vector power = Vector( d, Coeff( 0 ));
+        if( d > 0 )
+            power[0] = Coeff( 1 );
+        for( unsigned i = 0; i <= d; ++i )
+        {
+            powerSums.push_back( toNumeric( table.trace( power )));
+            if( i == d )
+                break;
+            Vector next = Vector( d, Coeff( 0 ));
+            for( unsigned k = 0; k < form.size(); ++k )
+            {
+                Vector product = table.multiplyByVariable( power, k );
+                traces[k].push_back( toNumeric( table.trace( product )));
+                if( form[k].isZero() )
+                    continue;
+                for( unsigned j = 0; j < d; ++j )
+                {
+                    if( !product[j].isZero() )
+                        next[j] = next[j] + form[k] * product[j];
+                }
+            }
+            power = next;
+        }
+        if( !initialize( nrOfSolutions, powerSums, traces ))
+            return false;
+        mSeparatingForm.clear();
+        for( unsigned k = 0; k < form.size(); ++k )
+            mSeparatingForm.push_back( toNumeric( form[k] ));
+        return true;
+    }
+
+    template<class Coeff>
+    numeric UnivariateRepresentation::toNumeric( const Coeff& c ) throw ( invalid_argument )
+    {
+        ex e = c.getExpression();
+        if( !GiNaC::is_a<numeric>( e ))
+            throw invalid_argument( "The coefficients of the polynomial system are not numbers." );
+        return GiNaC::ex_to<numeric>( e );
+    }
+}
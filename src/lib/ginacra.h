@@ -59,21 +59,31 @@
 #include "Constraint.h"
 #include "UnivariatePolynomial.h"
 #include "RationalUnivariatePolynomial.h"
+#include "ModularSubresultants.h"
+#include "DenseUnivariateArithmetic.h"
+#include "ModularGcd.h"
 #include "OpenInterval.h"
 #include "MultivariateMonomialMR.h"
+#include "MonomialOrder.h"
+#include "MonomialDivisorIndex.h"
 #include "MultivariateTermMR.h"
 #include "MultivariatePolynomialMR.h"
 #include "Groebner.h"
+#include "ModularGroebner.h"
+#include "JanetBasis.h"
+#include "FGLM.h"
+#include "QuotientRingMultiplicationTable.h"
 //#include "MultivariatePolynomialFactory.h"
-//#include "SpecialQuotientRingMultiplicationTable.h"
 
 #include "RealAlgebraicNumber.h"
 #include "RealAlgebraicNumberNR.h"
 #include "RealAlgebraicNumberIR.h"
 #include "RealAlgebraicNumberFactory.h"
 #include "UnivariatePolynomialSet.h"
+#include "UnivariatePolynomialPool.h"
 #include "tree.h"
 #include "RealAlgebraicPoint.h"
+#include "UnivariateRepresentation.h"
 #include "CAD.h"
 #include "operators.h"
 
@@ -27,7 +27,7 @@
  *
  * @author Ulrich Loup
  * @since 2010-09-20
- * @version 2012-04-20
+ * @version 2026-10-18
  */
 
 #include <assert.h>
@@ -352,36 +352,36 @@ namespace GiNaCRA
     {
         RationalUnivariatePolynomial p( rh.polynomial().subs( rh.polynomial().variable() == (rh.polynomial().variable() - lh) ),
                                         rh.polynomial().variable() );
-        while( RationalUnivariatePolynomial::countRealRoots( p, rh.interval() + lh ) != 1 )    // refine rh until a unique number representation is found
+        while( RationalUnivariatePolynomial::countRealRoots( p, rh.interval() + lh, rh.sturmSequenceStrategy() ) != 1 )    // refine rh until a unique number representation is found
             rh.refine();
-        return *new RealAlgebraicNumberIR( p, rh.interval() + lh );
+        return *new RealAlgebraicNumberIR( p, rh.interval() + lh, list<RationalUnivariatePolynomial>(), true, true, rh.sturmSequenceStrategy() );
     }
 
     RealAlgebraicNumberIR& operator +( RealAlgebraicNumberIR& lh, const GiNaC::numeric& rh )
     {
         RationalUnivariatePolynomial p( lh.polynomial().subs( lh.polynomial().variable() == (lh.polynomial().variable() - rh) ),
                                         lh.polynomial().variable() );
-        while( RationalUnivariatePolynomial::countRealRoots( p, rh + lh.interval() ) != 1 )    // refine rh until a unique number representation is found
+        while( RationalUnivariatePolynomial::countRealRoots( p, rh + lh.interval(), lh.sturmSequenceStrategy() ) != 1 )    // refine rh until a unique number representation is found
             lh.refine();
-        return *new RealAlgebraicNumberIR( p, rh + lh.interval() );
+        return *new RealAlgebraicNumberIR( p, rh + lh.interval(), list<RationalUnivariatePolynomial>(), true, true, lh.sturmSequenceStrategy() );
     }
 
     RealAlgebraicNumberIR& operator -( const GiNaC::numeric& lh, RealAlgebraicNumberIR& rh )
     {
         RationalUnivariatePolynomial p( rh.polynomial().subs( rh.polynomial().variable() == (rh.polynomial().variable() + lh) ),
                                         rh.polynomial().variable() );
-        while( RationalUnivariatePolynomial::countRealRoots( p, rh.interval() - lh ) != 1 )    // refine rh until a unique number representation is found
+        while( RationalUnivariatePolynomial::countRealRoots( p, rh.interval() - lh, rh.sturmSequenceStrategy() ) != 1 )    // refine rh until a unique number representation is found
             rh.refine();
-        return *new RealAlgebraicNumberIR( p, rh.interval() - lh );
+        return *new RealAlgebraicNumberIR( p, rh.interval() - lh, list<RationalUnivariatePolynomial>(), true, true, rh.sturmSequenceStrategy() );
     }
 
     RealAlgebraicNumberIR& operator -( RealAlgebraicNumberIR& lh, const GiNaC::numeric& rh )
     {
         RationalUnivariatePolynomial p( lh.polynomial().subs( lh.polynomial().variable() == (lh.polynomial().variable() + rh) ),
                                         lh.polynomial().variable() );
-        while( RationalUnivariatePolynomial::countRealRoots( p, rh - lh.interval() ) != 1 )    // refine rh until a unique number representation is found
+        while( RationalUnivariatePolynomial::countRealRoots( p, rh - lh.interval(), lh.sturmSequenceStrategy() ) != 1 )    // refine rh until a unique number representation is found
             lh.refine();
-        return *new RealAlgebraicNumberIR( p, rh - lh.interval() );
+        return *new RealAlgebraicNumberIR( p, rh - lh.interval(), list<RationalUnivariatePolynomial>(), true, true, lh.sturmSequenceStrategy() );
     }
 
     RealAlgebraicNumberIR& operator *( const GiNaC::numeric& lh, RealAlgebraicNumberIR& rh )
@@ -390,9 +390,9 @@ namespace GiNaCRA
             return *RealAlgebraicNumberIR::zero( rh.polynomial().variable() );
         RationalUnivariatePolynomial p( rh.polynomial().subs( rh.polynomial().variable() == (rh.polynomial().variable() * lh.inverse())),
                                         rh.polynomial().variable() );
-        while( RationalUnivariatePolynomial::countRealRoots( p, rh.interval() * lh ) != 1 )    // refine rh until a unique number representation is found
+        while( RationalUnivariatePolynomial::countRealRoots( p, rh.interval() * lh, rh.sturmSequenceStrategy() ) != 1 )    // refine rh until a unique number representation is found
             rh.refine();
-        return *new RealAlgebraicNumberIR( p, rh.interval() * lh );
+        return *new RealAlgebraicNumberIR( p, rh.interval() * lh, list<RationalUnivariatePolynomial>(), true, true, rh.sturmSequenceStrategy() );
     }
 
     RealAlgebraicNumberIR& operator *( RealAlgebraicNumberIR& lh, const GiNaC::numeric& rh )
@@ -401,9 +401,9 @@ namespace GiNaCRA
             return *RealAlgebraicNumberIR::zero( lh.polynomial().variable() );
         RationalUnivariatePolynomial p( lh.polynomial().subs( lh.polynomial().variable() == (lh.polynomial().variable() * rh.inverse())),
                                         lh.polynomial().variable() );
-        while( RationalUnivariatePolynomial::countRealRoots( p, rh * lh.interval() ) != 1 )    // refine rh until a unique number representation is found
+        while( RationalUnivariatePolynomial::countRealRoots( p, rh * lh.interval(), lh.sturmSequenceStrategy() ) != 1 )    // refine rh until a unique number representation is found
             lh.refine();
-        return *new RealAlgebraicNumberIR( p, rh * lh.interval() );
+        return *new RealAlgebraicNumberIR( p, rh * lh.interval(), list<RationalUnivariatePolynomial>(), true, true, lh.sturmSequenceStrategy() );
     }
 
     RealAlgebraicNumberIR& operator /( const GiNaC::numeric& lh, RealAlgebraicNumberIR& rh )
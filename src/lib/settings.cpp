@@ -24,7 +24,7 @@
  * @author Sebastian Junges
  * @author Ulrich Loup
  * @since 2012-01-17
- * @version 2012-01-17
+ * @version 2026-10-18
  */
 
 #include "settings.h"
@@ -33,4 +33,9 @@ namespace GiNaCRA
 {
     std::string CPPUNITSettings::TESTSUITE_ALL        = "All Tests";
     std::string CPPUNITSettings::TESTSUITE_UNIVARIATE = "Univariate Tests";
+
+    // definitions of the constants initialized in the class, needed if they are bound to references
+    const GroebnerSettings::PairSelectionStrategy GroebnerSettings::DEFAULT_PAIRSELECTIONSTRATEGY;
+    const GroebnerSettings::Engine                GroebnerSettings::DEFAULT_ENGINE;
+    const unsigned                                GroebnerSettings::DEFAULT_THREADS;
 }
@@ -27,7 +27,7 @@
  * @author Sebastian Junges
  * @author Ulrich Loup
  * @since 2010-11-01
- * @version 2012-05-15
+ * @version 2026-10-18
  */
 
 #include <limits.h>
@@ -71,6 +71,44 @@ namespace GiNaCRA
             }
     };
 
+    //////////////
+    // Groebner //
+    //////////////
+
+    /** Collection of Groebner related settings.
+     */
+    struct GroebnerSettings
+    {
+        /// Predefined flags for the order in which GroebnerT::solve selects the critical pairs.
+        enum PairSelectionStrategy
+        {
+            /// Pairs whose least common multiple of the leading monomials has the lowest total degree come first, ties are broken by the monomial order.
+            DEGREE_PAIRSELECTIONSTRATEGY,
+            /// Pairs with the lowest sugar degree come first, ties are broken as in DEGREE_PAIRSELECTIONSTRATEGY.
+            SUGAR_PAIRSELECTIONSTRATEGY
+        };
+
+        /// The default setting for the pair selection strategy, used if no other option is specified.
+        static const PairSelectionStrategy DEFAULT_PAIRSELECTIONSTRATEGY = SUGAR_PAIRSELECTIONSTRATEGY;
+
+        /// Predefined flags for the algorithm used by GroebnerT::solve.
+        enum Engine
+        {
+            /// Buchberger's algorithm reducing one S-polynomial at a time.
+            BUCHBERGER_ENGINE,
+            /// Faugere's F4 algorithm reducing all pairs of the lowest degree at once by row-echelon forms of sparse Macaulay matrices. Only used over fields.
+            F4_ENGINE,
+            /// A signature-based algorithm in the style of F5, adding the generators one by one and discarding pairs by the syzygy and rewrite criteria. No S-polynomial reduces to zero if the generators form a regular sequence. Only used over fields.
+            SIGNATURE_ENGINE
+        };
+
+        /// The default setting for the engine, used if no other option is specified.
+        static const Engine DEFAULT_ENGINE = BUCHBERGER_ENGINE;
+
+        /// The default number of threads reducing S-polynomials concurrently in GroebnerT::solve, 1 disables the parallel reduction.
+        static const unsigned DEFAULT_THREADS = 1;
+    };
+
     /////////
     // CAD //
     /////////
@@ -94,12 +132,41 @@ namespace GiNaCRA
         /// the elimination uses real root counting to simplify the bottom-most level
         REALROOTCOUNT_CADSETTING = 32,
         /// the elimination uses square-free/separable polynomials in every level
-        SQUAREFREEELIMINATION_CADSETTING = 64
+        SQUAREFREEELIMINATION_CADSETTING = 64,
+        /// the elimination computes subresultants with Lazard's optimization
+        LAZARDSSUBRESULTANTS_CADSETTING = 128,
+        /// the elimination computes subresultants with Lazard's and Ducos' optimizations
+        DUCOSSUBRESULTANTS_CADSETTING = 256,
+        /// the elimination computes principal subresultant coefficients modulo primes by evaluation and interpolation
+        MODULARSUBRESULTANTS_CADSETTING = 512,
+        /// the elimination replaces the polynomials by their irreducible factors over the integers in every level
+        FACTORIZATION_CADSETTING = 1024,
+        /// the elimination replaces every level by a gcd-free basis of square-free, pairwise coprime polynomials
+        GCDFREEBASIS_CADSETTING = 2048,
+        /// the elimination uses McCallum's projection operator if the input is well-oriented and Hong's projection operator otherwise
+        MCCALLUMPROJECTION_CADSETTING = 4096,
+        /// the elimination uses Brown's reduced projection operator in the last elimination and McCallum's projection operator elsewhere
+        BROWNPROJECTION_CADSETTING = 8192,
+        /// the elimination uses Lazard's projection operator, and the lifting uses Lazard's evaluation
+        LAZARDPROJECTION_CADSETTING = 16384
     };
 
     /// The default setting for CAD settings, which is chosen if the CAD object is initialized without any other parameter.
     static const CADSettingsType DEFAULT_CADSETTING = LOWDEG_CADSETTING;
 
+    /// Predefined flags for the projection operator used by CAD::eliminationSet.
+    enum ProjectionOperator
+    {
+        /// Hong's improvement of Collins' projection operator, using the truncations and all principal subresultant coefficients.
+        HONG_PROJECTIONOPERATOR,
+        /// McCallum's projection operator on a square-free basis, using coefficients, discriminants and resultants. If the input is not well-oriented, Hong's operator is used for the whole elimination instead.
+        MCCALLUM_PROJECTIONOPERATOR,
+        /// Brown's reduction of McCallum's operator on a square-free basis, using leading coefficients, discriminants and resultants. It is only used if one variable remains, McCallum's operator is used instead otherwise.
+        BROWN_PROJECTIONOPERATOR,
+        /// Lazard's projection operator on a square-free basis, using leading and trailing coefficients, discriminants and resultants. It requires Lazard's evaluation in the lifting, which CAD::samples computes exactly at every sample, interval-represented components included.
+        LAZARD_PROJECTIONOPERATOR
+    };
+
     /////////////////////////
     // RealAlgebraicNumber //
     /////////////////////////
@@ -147,6 +214,20 @@ namespace GiNaCRA
 
         /// Maximum bound of an isolating interval so that the OpenInterval::sample method is used for splitting point selection.
         static const long MAX_FASTSAMPLE_BOUND = SHRT_MAX;
+
+        /// Predefined flags for the sequences whose sign variations count real roots, see RationalUnivariatePolynomial::sturmSequence.
+        enum SturmSequenceStrategy
+        {
+            /// Signed remainder sequence over the rational numbers (RationalUnivariatePolynomial::standardSturmSequence).
+            STANDARD_STURMSEQUENCESTRATEGY,
+            /// Sturm-Habicht sequence with integer coefficients (RationalUnivariatePolynomial::sturmHabichtSequence).
+            STURMHABICHT_STURMSEQUENCESTRATEGY
+        };
+
+        /// The default setting for the sequences used for real root counting, isolation and refinement. Other strategies are selected per call of
+        /// RealAlgebraicNumberFactory::realRoots, RealAlgebraicNumberFactory::realRootsEval, RealAlgebraicNumberFactory::evaluateIR or the
+        /// RealAlgebraicNumberIR constructor, and are inherited by the real algebraic numbers computed from the resulting ones.
+        static const SturmSequenceStrategy DEFAULT_STURMSEQUENCESTRATEGY = STANDARD_STURMSEQUENCESTRATEGY;
     };
 }
 #endif   /** GINACRA_SETTINGS_H */
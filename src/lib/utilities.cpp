@@ -25,10 +25,11 @@
  *
  * @author Ulrich Loup
  * @since 2010-11-01
- * @version 2012-05-14
+ * @version 2026-10-18
  *
  */
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 #include <assert.h>
@@ -89,6 +90,39 @@ namespace GiNaC
         return b / gcd( a, b );
     }
 
+    const cln::cl_I chineseRemainder( const cln::cl_I& a, const cln::cl_I& m, const cln::cl_I& b, const cln::cl_I& n ) throw ( invalid_argument )
+    {
+        cln::cl_I u, v;
+        if( cln::xgcd( m, n, &u, &v ) != 1 )
+            throw invalid_argument( "The moduli are not coprime." );
+        // u*m + v*n = 1, so u is the inverse of m modulo n
+        cln::cl_I mn = m * n;
+        return cln::mod( a + m * cln::mod( (b - a) * u, n ), mn );
+    }
+
+    bool rationalReconstruction( const cln::cl_I& a, const cln::cl_I& m, cln::cl_RA& result )
+    {
+        cln::cl_I bound;
+        cln::isqrt( cln::floor1( m, 2 ), &bound );
+        // invariant: r_i = t_i * a mod m
+        cln::cl_I r0 = m, r1 = cln::mod( a, m );
+        cln::cl_I t0 = 0, t1 = 1;
+        while( r1 > bound )
+        {
+            cln::cl_I q  = cln::floor1( r0, r1 );
+            cln::cl_I r2 = r0 - q * r1;
+            cln::cl_I t2 = t0 - q * t1;
+            r0 = r1;
+            r1 = r2;
+            t0 = t1;
+            t1 = t2;
+        }
+        if( cln::abs( t1 ) > bound || cln::gcd( r1, t1 ) != 1 )
+            return false;
+        result = cln::cl_RA( r1 ) / cln::cl_RA( t1 );
+        return true;
+    }
+
     bool is_constant( const ex& polynomial, const vector<symbol>& symbolLst )
     {
         for( vector<symbol>::const_iterator it = symbolLst.begin(); it != symbolLst.end(); ++it )
@@ -266,134 +300,169 @@ namespace GiNaC
         return sA.str().compare( sB.str() ) <= 0;
     }
 
-    const map<int, ex> signedSubresultants( const ex& A, const ex& B, const symbol& sym )
+    /** Divides a by b, where the division is known to be exact.
+     * @param a
+     * @param b nonzero
+     * @return a / b
+     * @throw invalid_argument if b does not divide a
+     */
+    static const ex exactDivide( const ex& a, const ex& b ) throw ( invalid_argument )
     {
-        ex P      = A;
-        ex Q      = B;
-        ex ex_sym = sym;    // avoid complicated casts like symbol -> ex
-        int p = P.degree( ex_sym );
-        int q = Q.degree( ex_sym );
-        ex a             = P.lcoeff( ex_sym );    // leading coefficient of P
-        ex b             = Q.lcoeff( ex_sym );    // leading coefficient of Q
-        ex epsilon_p_q_1 = pow( (-1), (p - q - 1) * (p - q - 1 + 1) / 2 );
-
-        int          j, k;
-        map<int, ex> H;
-        map<int, ex> h;
-        map<int, ex> h_;
+        if( a.is_zero() || b.is_equal( _ex1 ))
+            return a;
+        if( is_exactly_a<numeric>( b ))
+            return (a * ex_to<numeric>( b ).inverse()).expand();
+        ex quotient;
+        if( !divide( a, b, quotient ))
+            throw invalid_argument( "Inexact division in the signed subresultant sequence." );
+        return quotient;
+    }
 
-        if( p > q )
+    /** Scales the dense polynomial a by c, dividing by d exactly.
+     * @param c
+     * @param a coefficients, the one of degree i at position i
+     * @param d nonzero
+     * @return c * a / d with stripped vanishing leading coefficients
+     * @throw invalid_argument if d does not divide c * a
+     */
+    static const vector<ex> denseScale( const ex& c, const vector<ex>& a, const ex& d = _ex1 ) throw ( invalid_argument )
+    {
+        vector<ex> result = vector<ex>( a.size() );
+        for( unsigned i = 0; i < a.size(); ++i )
+            result[i] = exactDivide( (c * a[i]).expand(), d );
+        while( !result.empty() && result.back().is_zero() )
+            result.pop_back();
+        return result;
+    }
+
+    /** Computes -rem( c * a, b ) on dense polynomials as GiNaC::rem does, i.e., every leading coefficient is divided exactly by the one of b.
+     * @param c
+     * @param a coefficients, the one of degree i at position i
+     * @param b coefficients with nonzero leading coefficient
+     * @return the negated remainder with stripped vanishing leading coefficients
+     * @throw invalid_argument if a leading coefficient is not divisible by the one of b
+     */
+    static const vector<ex> denseNegatedRemainder( const ex& c, const vector<ex>& a, const vector<ex>& b ) throw ( invalid_argument )
+    {
+        vector<ex> r = denseScale( -c, a );
+        while( r.size() >= b.size() )
         {
-            j        = q;
-            h[q]     = epsilon_p_q_1 * pow( b, p - q );
-            H[q]     = epsilon_p_q_1 * pow( b, p - q - 1 ) * Q;
-            H[q - 1] = -rem( b * h[q] * P, Q, ex_sym, false );
+            ex       term  = exactDivide( r.back(), b.back() );
+            unsigned shift = r.size() - b.size();
+            r.pop_back();    // cancels by construction
+            for( unsigned i = 0; i + 1 < b.size(); ++i )
+                r[shift + i] = (r[shift + i] - term * b[i]).expand();
+            while( !r.empty() && r.back().is_zero() )
+                r.pop_back();
         }
+        return r;
+    }
 
+    const vector<vector<ex> > signedSubresultants( const vector<ex>& P, const vector<ex>& Q ) throw ( invalid_argument )
+    {
+        int p = (int)P.size() - 1;
+        int q = (int)Q.size() - 1;
+        if( p < 0 || q < 0 )
+            throw invalid_argument( "The polynomials must not be zero." );
+        ex a = P.back();    // leading coefficient of P
+        ex b = Q.back();    // leading coefficient of Q
+
+        // all sequences are indexed by the degree and allocated once
+        vector<vector<ex> > H  = vector<vector<ex> >( std::max( p, q ) + 1 );
+        vector<ex>          h  = vector<ex>( H.size() );
+        vector<ex>          h_ = vector<ex>( H.size() );
+        int                 j;
+        if( p > q )
+        {
+            ex epsilon_p_q_1 = ((p - q - 1) * (p - q) / 2) % 2 == 0 ? _ex1 : _ex_1;
+            j    = q;
+            h[q] = (epsilon_p_q_1 * pow( b, p - q )).expand();
+            H[q] = denseScale( epsilon_p_q_1 * pow( b, p - q - 1 ), Q );
+            if( q > 0 )
+                H[q - 1] = denseNegatedRemainder( b * h[q], P, Q );
+        }
         else if( p == q )
         {
-            j        = q;
-            h[q]     = 1;
-            H[q - 1] = -rem( b * P, Q, ex_sym );
+            j    = q;
+            h[q] = 1;
+            if( q > 0 )
+                H[q - 1] = denseNegatedRemainder( b, P, Q );
         }
-
         else    // p < q
         {
-            j        = p;
-            h[p]     = pow( a, q - p );
-            H[p]     = pow( a, q - p - 1 ) * P;
-            H[p - 1] = -rem( a * h[p] * Q, P, ex_sym, false );
+            j    = p;
+            h[p] = pow( a, q - p ).expand();
+            H[p] = denseScale( pow( a, q - p - 1 ), P );
+            if( p > 0 )
+                H[p - 1] = denseNegatedRemainder( a * h[p], Q, P );
         }
 
-        map<int, ex>::const_iterator itti = H.find( j - 1 );
-        if( itti != H.end() && H[j - 1] == 0 )
-            return H;
-        else
+        while( j > 0 && !H[j - 1].empty() )
         {
-            k = H[j - 1].degree( ex_sym );
-            while( true )
+            int k = (int)H[j - 1].size() - 1;
+            // for p == q, the first remainders are taken from Q and divided by its leading coefficient
+            bool              fromQ    = p == q && q == j;
+            const vector<ex>& previous = fromQ ? Q : H[j];
+            ex                divisor  = fromQ ? b : pow( h[j], 2 ).expand();
+            if( k == j - 1 )
             {
-                if( k == j - 1 )
-                {
-                    // The following line is missing in the paper
-                    // but the algorithm is not working
-                    // without it. If it is missing
-                    // h[j-1] is just initialized with 0.
-                    // See the definition of h on page 5 in the paper !
-                    h[j - 1] = H[j - 1].lcoeff( ex_sym );
-                    //H[k-1] = -rem(pow(h[j-1], 2) * H[j], H[j-1], ex_sym, false) / pow(h[j], 2);
-                    if( !divide( -rem( pow( h[j - 1], 2 ) * H[j], H[j - 1], ex_sym, false ), pow( h[j], 2 ), H[k - 1] ))
-                        assert( false == true );    // Division Error!
-
-                    if( p == q && q == j )
-                    {
-                        //H[q-2] = -rem(pow(h[q-1], 2) * Q, H[q-1], ex_sym, false) / b;
-                        if( !divide( -rem( pow( h[q - 1], 2 ) * Q, H[q - 1], ex_sym, false ), b, H[q - 2] ))
-                            assert( false == true );    // Division Error!
-                    }
-                }
-
-                if( k < j - 1 )
-                {
-                    h_[j - 1] = H[j - 1].lcoeff( ex_sym );
-
-                    for( int delta = 1; delta <= j - k - 1; delta++ )
-                    {
-                        //h_[j-delta-1] = pow(-1, delta) * (h_[j-1] * h_[j-delta]) / h[j];
-                        if( !divide( pow( -1, delta ) * (h_[j - 1] * h_[j - delta]), h[j], h_[j - delta - 1] ))
-                            assert( false == true );    // Division Error!
-                    }
-
-                    h[k] = h_[k];
-
-                    //H[k] = (h[k] * H[j-1])/h_[j-1];
-                    if( !divide( (h[k] * H[j - 1]), h_[j - 1], H[k] ))
-                        assert( false == true );    // Division Error!
-
-                    //H[k-1] = -rem(h_[j-1] * h[k] * H[j], H[j-1], ex_sym, false) / pow(h[j], 2);
-                    if( !divide( -rem( h_[j - 1] * h[k] * H[j], H[j - 1], ex_sym, false ), pow( h[j], 2 ), H[k - 1] ))
-                        assert( false == true );    // Division Error!
-
-                    if( p == q && q == j )
-                    {
-                        //H[k-1] = -rem(h_[q-1] * h[k] * Q, H[j-1], ex_sym, false) / b;
-                        if( !divide( -rem( h_[q - 1] * h[k] * Q, H[j - 1], ex_sym, false ), b, H[k - 1] ))
-                            assert( false == true );    // Division Error!
-                    }
-                }
-
-                itti = H.find( k - 1 );
-
-                if( itti != H.end() && H[k - 1] == 0 )
-                    return H;
-
-                else
-                {
-                    j = k;
-                    k = H[k - 1].degree( ex_sym );
-                }
+                // The following line is missing in the paper but the algorithm is not working without it.
+                // If it is missing h[j-1] is just initialized with 0. See the definition of h on page 5 in the paper!
+                h[j - 1] = H[j - 1].back();
+                if( k > 0 )
+                    H[k - 1] = denseScale( 1, denseNegatedRemainder( pow( h[j - 1], 2 ), previous, H[j - 1] ), divisor );
+            }
+            else
+            {
+                h_[j - 1] = H[j - 1].back();
+                for( int delta = 1; delta <= j - k - 1; ++delta )
+                    h_[j - delta - 1] = exactDivide( ((delta % 2 == 0 ? _ex1 : _ex_1) * h_[j - 1] * h_[j - delta]).expand(), h[j] );
+                h[k] = h_[k];
+                H[k] = denseScale( h[k], H[j - 1], h_[j - 1] );
+                if( k > 0 )
+                    H[k - 1] = denseScale( 1, denseNegatedRemainder( h_[j - 1] * h[k], previous, H[j - 1] ), divisor );
             }
+            j = k;
         }
-
         return H;
     }
 
+    const map<int, ex> signedSubresultants( const ex& A, const ex& B, const symbol& sym ) throw ( invalid_argument )
+    {
+        vector<vector<ex> > H      = signedSubresultants( denseCoefficients( A, sym ), denseCoefficients( B, sym ));
+        map<int, ex>        result = map<int, ex>();
+        for( unsigned i = 0; i < H.size(); ++i )
+        {
+            if( H[i].empty() )
+                continue;
+            ex subresultant = 0;
+            for( unsigned d = 0; d < H[i].size(); ++d )
+                subresultant += H[i][d] * pow( sym, d );
+            result[i] = subresultant;
+        }
+        return result;
+    }
+
     const vector<ex> signedSubresultantsCoefficients( const ex& A, const ex& B, const symbol& sym ) throw ( invalid_argument )
     {
-        ex ex_x = sym;
-        int a = A.degree( ex_x );
-        // may if (a < b && a != 0 && b != 0) ??
-        //if( a <= b )    // VERY DANGEROUS USE !!
-        //    throw invalid_argument( "The degree of A must be greater than the degree of B!" );
-        //else
-        //{
-        map<int, ex> H = signedSubresultants( A, B, sym );
-        vector<ex>   sRes( a + 1 );
-        for( int i = 0; i < a; i++ )
-            sRes[i] = ex( H[i].coeff( ex_x, i ));
-        sRes[a] = ex( A.coeff( ex_x, a ));
+        vector<ex>          P    = denseCoefficients( A, sym );
+        vector<vector<ex> > H    = signedSubresultants( P, denseCoefficients( B, sym ));
+        int                 a    = (int)P.size() - 1;
+        vector<ex>          sRes = vector<ex>( a + 1, 0 );
+        for( int i = 0; i < a; ++i )
+            if( (int)H[i].size() > i )
+                sRes[i] = H[i][i];
+        sRes[a] = P.back();
         return sRes;
-        //}
+    }
+
+    const vector<ex> denseCoefficients( const ex& p, const symbol& sym )
+    {
+        ex         expanded = p.expand();
+        vector<ex> result   = vector<ex>( expanded.is_zero() ? 0 : expanded.degree( sym ) + 1 );
+        for( unsigned i = 0; i < result.size(); ++i )
+            result[i] = expanded.coeff( sym, i );
+        return result;
     }
 
 }    // namespace GiNaC
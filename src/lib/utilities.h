@@ -28,7 +28,7 @@
  *
  * @author Ulrich Loup
  * @since 2010-11-14
- * @version 2012-05-14
+ * @version 2026-10-18
  */
 
 #include <ginac/ginac.h>
@@ -88,6 +88,26 @@ namespace GiNaC
      */
     long denominator( long a, long b );
 
+    /** Combines the residues a modulo m and b modulo n by the Chinese remainder theorem.
+     * @param a residue modulo m
+     * @param m positive modulus
+     * @param b residue modulo n
+     * @param n positive modulus coprime to m
+     * @return the unique x in [0, m*n) with x = a mod m and x = b mod n
+     * @complexity one extended gcd of m and n
+     */
+    const cln::cl_I chineseRemainder( const cln::cl_I& a, const cln::cl_I& m, const cln::cl_I& b, const cln::cl_I& n ) throw ( invalid_argument );
+
+    /** Reconstructs a fraction r/s from its image a modulo m, such that |r| and s are bounded by sqrt(m/2).
+     * @param a residue modulo m
+     * @param m positive modulus
+     * @param result receives r/s if the reconstruction succeeds
+     * @return true if such a fraction with gcd(r, s) = 1 exists, false otherwise
+     * @see Wang, Guy, Davenport: P-adic reconstruction of rational numbers. SIGSAM Bull. 16(2), 1982
+     * @complexity O( digits( m )^2 )
+     */
+    bool rationalReconstruction( const cln::cl_I& a, const cln::cl_I& m, cln::cl_RA& result );
+
     /** Determines whether the given polynomial expression is constant in the given list of variables.
      * @param polynomial
      * @param symbolLst
@@ -203,8 +223,23 @@ namespace GiNaC
      * @param sym the main variable
      * @complexity O( deg(A)*deg(B) )
      * @return a map from int to ex, where the i-th index corresponds to the i-th subresultant in the subresultant sequence
+     * @throw invalid_argument if A or B is zero or an exact division fails
+     * @see signedSubresultants( const vector<ex>&, const vector<ex>& )
+     */
+    const map<int, ex> signedSubresultants( const ex& A, const ex& B, const symbol& sym ) throw ( invalid_argument );
+
+    /**
+     * Returns the signed subresultant sequence of two polynomials given by their dense coefficient vectors.
+     * The sequences of the algorithm are preallocated vectors indexed by the degree. Divisions by numbers are
+     * carried out as multiplications with the inverse, all other divisions are exact divisions.
+     *
+     * @param P coefficients of the first polynomial, the one of degree i at position i, with nonzero leading coefficient
+     * @param Q coefficients of the second polynomial, the one of degree i at position i, with nonzero leading coefficient
+     * @complexity O( deg(P)*deg(Q) ) operations on the coefficients
+     * @return a vector of max(deg(P), deg(Q)) + 1 dense polynomials, the i-th one being the i-th signed subresultant (empty if it is zero)
+     * @throw invalid_argument if P or Q is empty or an exact division fails
      */
-    const map<int, ex> signedSubresultants( const ex& A, const ex& B, const symbol& sym );
+    const vector<vector<ex> > signedSubresultants( const vector<ex>& P, const vector<ex>& Q ) throw ( invalid_argument );
 
     /**
      * Returns the Signed Subresultant Coefficient sequence.
@@ -221,6 +256,15 @@ namespace GiNaC
      */
     const vector<ex> signedSubresultantsCoefficients( const ex& A, const ex& B, const symbol& sym ) throw ( invalid_argument );
 
+    /**
+     * Returns the dense coefficient vector of a polynomial.
+     *
+     * @param p a polynomial in sym
+     * @param sym the main variable
+     * @return vector containing the expanded coefficient of degree i at position i, without vanishing leading coefficients
+     */
+    const vector<ex> denseCoefficients( const ex& p, const symbol& sym );
+
 }    // namespace GiNaC
 
 namespace GiNaCRA
@@ -27,7 +27,7 @@
  *
  * @author Ulrich Loup
  * @since 2011-12-06
- * @version 2012-03-21
+ * @version 2026-10-18
  */
 
 #include "CAD_unittest.h"
@@ -54,6 +54,7 @@ using GiNaCRA::Polynomial;
 using GiNaCRA::Constraint;
 using GiNaCRA::RealAlgebraicNumberFactory;
 using GiNaCRA::CAD;
+using GiNaCRA::UnivariatePolynomialPool;
 
 // test suite
 CPPUNIT_TEST_SUITE_REGISTRATION( CAD_unittest );
@@ -270,3 +271,272 @@ void CAD_unittest::testAddPolynomials()
     constraints.push_back( Constraint( polys.back(), ZERO_SIGN, cad.variables() ));
     CPPUNIT_ASSERT( cad.check( constraints, r ));    // only the new constraint is of course sat
 }
+
+void CAD_unittest::testPolynomialPool()
+{
+    symbol x( "x" ), y( "y" );
+    ex     e  = 2 * x * x * y - 4 * y + 6;
+    unsigned id = UnivariatePolynomialPool::intern( UnivariatePolynomial( e, x ));
+    // polynomials coinciding up to a rational factor share the id of their canonical representative
+    CPPUNIT_ASSERT_EQUAL( id, UnivariatePolynomialPool::intern( UnivariatePolynomial( -3 * e / 2, x )));
+    CPPUNIT_ASSERT( id != UnivariatePolynomialPool::intern( UnivariatePolynomial( e, y )));
+    CPPUNIT_ASSERT( (UnivariatePolynomialPool::polynomial( id ) - (x * x * y - 2 * y + 3)).expand().is_zero() );
+
+    // scaled copies are eliminated once, and the second elimination is answered from the cache
+    UnivariatePolynomialSet s;
+    s.insert( UnivariatePolynomial( e, x ));
+    s.insert( UnivariatePolynomial( 3 * e, x ));
+    s.insert( UnivariatePolynomial( x - y, x ));
+    UnivariatePolynomialSet first = CAD::eliminationSet( s, y );
+    unsigned size = UnivariatePolynomialPool::size();
+    UnivariatePolynomialSet second = CAD::eliminationSet( s, y );
+    CPPUNIT_ASSERT_EQUAL( size, UnivariatePolynomialPool::size() );
+    CPPUNIT_ASSERT_EQUAL( first.size(), second.size() );
+    for( UnivariatePolynomialSet::const_iterator i = first.begin(); i != first.end(); ++i )
+        CPPUNIT_ASSERT( second.find( *i ) != second.end() );
+
+    // every CAD object is a user of the pool while it exists
+    unsigned users = UnivariatePolynomialPool::users();
+    {
+        vector<symbol> v = vector<symbol>( 1, x );
+        v.push_back( y );
+        CAD local = CAD( s, v );
+        CAD copy  = local;
+        CPPUNIT_ASSERT_EQUAL( users + 2, UnivariatePolynomialPool::users() );
+    }
+    CPPUNIT_ASSERT_EQUAL( users, UnivariatePolynomialPool::users() );
+
+    // clearing drops the representatives and the cache, a later elimination fills them again
+    UnivariatePolynomialPool::clear();
+    CPPUNIT_ASSERT_EQUAL( (unsigned)0, UnivariatePolynomialPool::size() );
+    UnivariatePolynomialSet third = CAD::eliminationSet( s, y );
+    CPPUNIT_ASSERT_EQUAL( first.size(), third.size() );
+    CPPUNIT_ASSERT( UnivariatePolynomialPool::size() > 0 );
+    // the static eliminations above do not register as users, so leave the pool empty for the other tests
+    UnivariatePolynomialPool::clear();
+}
+
+void CAD_unittest::testFactorization()
+{
+    symbol x( "x" ), y( "y" );
+    vector<symbol> v = vector<symbol>();
+    v.push_back( x );
+    v.push_back( y );
+    UnivariatePolynomialSet s;
+    s.insert( UnivariatePolynomial( (pow( x, 2 ) - pow( y, 2 )) * (x - 2), x ));
+    s.insert( UnivariatePolynomial( 3 * pow( x * y - 1, 2 ), x ));
+    CAD factoredCAD = CAD( s, v, GiNaCRA::CADSettings::getSettings( GiNaCRA::FACTORIZATION_CADSETTING ));
+    vector<vector<UnivariatePolynomial> > elimSets = factoredCAD.eliminationSets();
+    // the top-most level consists of the irreducible factors x - y, x + y, x - 2 and x*y - 1
+    CPPUNIT_ASSERT_EQUAL( (size_t)4, elimSets.front().size() );
+    for( unsigned i = 0; i != elimSets.size(); ++i )
+        for( vector<UnivariatePolynomial>::const_iterator j = elimSets[i].begin(); j != elimSets[i].end(); ++j )
+            CPPUNIT_ASSERT( GiNaC::is_exactly_a<GiNaC::numeric>( j->content() ) && j->degree() <= 2 );
+    // the factors have the same zeros as the input
+    RealAlgebraicPoint r = RealAlgebraicPoint();
+    vector<Constraint> constraints = vector<Constraint>();
+    constraints.push_back( Constraint( UnivariatePolynomial( (pow( x, 2 ) - pow( y, 2 )) * (x - 2), x ), ZERO_SIGN, v ));
+    constraints.push_back( Constraint( UnivariatePolynomial( x * y - 1, x ), ZERO_SIGN, v ));
+    CPPUNIT_ASSERT( factoredCAD.check( constraints, r ));
+}
+
+void CAD_unittest::testGcdFreeBasis()
+{
+    symbol x( "x" ), y( "y" );
+    vector<symbol> v = vector<symbol>();
+    v.push_back( x );
+    v.push_back( y );
+    UnivariatePolynomialSet s;
+    s.insert( UnivariatePolynomial( ((x - y) * (x + 1)).expand(), x ));
+    s.insert( UnivariatePolynomial( (pow( x - y, 2 ) * (x - 1)).expand(), x ));
+    s.insert( UnivariatePolynomial( (y * (x + 1)).expand(), x ));
+    CAD basisCAD = CAD( s, v, GiNaCRA::CADSettings::getSettings( GiNaCRA::GCDFREEBASIS_CADSETTING ));
+    vector<vector<UnivariatePolynomial> > elimSets = basisCAD.eliminationSets();
+    // the top-most level is the basis x - y, x + 1, x - 1 and y
+    CPPUNIT_ASSERT_EQUAL( (size_t)4, elimSets.front().size() );
+    for( unsigned i = 0; i != elimSets.size(); ++i )
+        for( unsigned j = 0; j < elimSets[i].size(); ++j )
+            for( unsigned k = j + 1; k < elimSets[i].size(); ++k )
+                CPPUNIT_ASSERT( GiNaC::is_exactly_a<GiNaC::numeric>( elimSets[i][j].gcd( elimSets[i][k] )));
+    RealAlgebraicPoint r = RealAlgebraicPoint();
+    vector<Constraint> constraints = vector<Constraint>();
+    constraints.push_back( Constraint( UnivariatePolynomial( (pow( x - y, 2 ) * (x - 1)).expand(), x ), ZERO_SIGN, v ));
+    constraints.push_back( Constraint( UnivariatePolynomial( y * (x + 1), x ), POSITIVE_SIGN, v ));
+    CPPUNIT_ASSERT( basisCAD.check( constraints, r ));
+}
+
+void CAD_unittest::testMcCallumProjection()
+{
+    symbol x( "x" ), y( "y" ), z( "z" ), w( "w" );
+    vector<symbol> v = vector<symbol>();
+    v.push_back( x );
+    v.push_back( y );
+    v.push_back( z );
+    v.push_back( w );
+
+    // the coefficients of y*x + z vanish simultaneously at a point only if two variables remain, which is admissible in the first elimination
+    UnivariatePolynomialSet t;
+    t.insert( UnivariatePolynomial( y * x + z, x ));
+    CPPUNIT_ASSERT( CAD::wellOriented( t, 2, true ));
+    CPPUNIT_ASSERT( !CAD::wellOriented( t, 2, false ));
+    CPPUNIT_ASSERT( !CAD::wellOriented( t, 3, true ));
+    // a non-zero constant coefficient or a content not containing x exclude the nullification
+    t.clear();
+    t.insert( UnivariatePolynomial( x * x + y * x + z, x ));
+    t.insert( UnivariatePolynomial( y * x + y * z, x ));
+    CPPUNIT_ASSERT( CAD::wellOriented( t, 3, false ));
+
+    // the first elimination of x, x - y*z - w and x^2 + y is well-oriented, but the resultant y*z + w vanishes identically in y at z = w = 0
+    UnivariatePolynomial p1( x, x ), p2( x - y * z - w, x ), p3( x * x + y, x );
+    UnivariatePolynomialSet s;
+    s.insert( p1 );
+    s.insert( p2 );
+    s.insert( p3 );
+    CPPUNIT_ASSERT( CAD::wellOriented( s, 3, true ));
+    CAD mcCallumCAD = CAD( s, v, GiNaCRA::CADSettings::getSettings( GiNaCRA::MCCALLUMPROJECTION_CADSETTING ));
+    CAD hongCAD     = CAD( s, v );
+    vector<vector<UnivariatePolynomial> > mcCallumSets = mcCallumCAD.eliminationSets();
+    vector<vector<UnivariatePolynomial> > hongSets     = hongCAD.eliminationSets();
+    CPPUNIT_ASSERT_EQUAL( hongSets.size(), mcCallumSets.size() );
+    for( unsigned i = 0; i < hongSets.size(); ++i )
+    {    // hence the whole tower is eliminated by Hong's operator
+        CPPUNIT_ASSERT_EQUAL( hongSets[i].size(), mcCallumSets[i].size() );
+        for( unsigned j = 0; j < hongSets[i].size(); ++j )
+            CPPUNIT_ASSERT( hongSets[i][j].isEqual( mcCallumSets[i][j] ));
+    }
+    RealAlgebraicPoint r = RealAlgebraicPoint();
+    vector<Constraint> constraints = vector<Constraint>();
+    constraints.push_back( Constraint( p1, ZERO_SIGN, v ));
+    constraints.push_back( Constraint( p2, ZERO_SIGN, v ));
+    constraints.push_back( Constraint( p3, POSITIVE_SIGN, v ));
+    CPPUNIT_ASSERT( mcCallumCAD.check( constraints, r ));
+
+    // a well-oriented tower in x, y, z: every projection factor has a non-zero numeric coefficient in its main variable
+    vector<symbol> xyz = vector<symbol>( v.begin(), v.begin() + 3 );
+    UnivariatePolynomial q1( x * x + y * y + z - 1, x ), q2( x * x + y * x - z, x ), q3( z - 1, x );
+    s.clear();
+    s.insert( q1 );
+    s.insert( q2 );
+    s.insert( q3 );
+    CPPUNIT_ASSERT( CAD::wellOriented( s, 2, true ));
+    mcCallumCAD = CAD( s, xyz, GiNaCRA::CADSettings::getSettings( GiNaCRA::MCCALLUMPROJECTION_CADSETTING ));
+    hongCAD     = CAD( s, xyz );
+    mcCallumSets = mcCallumCAD.eliminationSets();
+    hongSets     = hongCAD.eliminationSets();
+    CPPUNIT_ASSERT_EQUAL( (size_t)3, mcCallumSets.size() );
+    CPPUNIT_ASSERT_EQUAL( hongSets.size(), mcCallumSets.size() );
+    CPPUNIT_ASSERT( CAD::wellOriented( UnivariatePolynomialSet( mcCallumSets[1].begin(), mcCallumSets[1].end() ), 1, false ));
+    // Hong's operator adds the principal subresultant coefficient y of q1 and q2, which McCallum's operator does not need
+    CPPUNIT_ASSERT( mcCallumSets[1].size() < hongSets[1].size() );
+    unsigned mcCallumSize = 0, hongSize = 0;
+    for( unsigned i = 0; i < hongSets.size(); ++i )
+    {
+        CPPUNIT_ASSERT( mcCallumSets[i].size() <= hongSets[i].size() );
+        mcCallumSize += mcCallumSets[i].size();
+        hongSize     += hongSets[i].size();
+    }
+    CPPUNIT_ASSERT( mcCallumSize < hongSize );
+    // both decompositions decide the same constraints
+    vector<vector<Constraint> > constraintSets = vector<vector<Constraint> >( 4 );
+    // satisfiable: q1 = q2 = 0 at y = 0, x^2 = 1/2, z = 1/2
+    constraintSets[0].push_back( Constraint( q1, ZERO_SIGN, xyz ));
+    constraintSets[0].push_back( Constraint( q2, ZERO_SIGN, xyz ));
+    // satisfiable at (0, 0, -1)
+    constraintSets[1].push_back( Constraint( q1, NEGATIVE_SIGN, xyz ));
+    constraintSets[1].push_back( Constraint( q2, POSITIVE_SIGN, xyz ));
+    constraintSets[1].push_back( Constraint( q3, NEGATIVE_SIGN, xyz ));
+    // unsatisfiable: q1 < 0 implies z < 1 - x^2 - y^2 <= 1
+    constraintSets[2].push_back( Constraint( q1, NEGATIVE_SIGN, xyz ));
+    constraintSets[2].push_back( Constraint( q3, POSITIVE_SIGN, xyz ));
+    // unsatisfiable: q1 = 0 implies z <= 1
+    constraintSets[3].push_back( Constraint( q1, ZERO_SIGN, xyz ));
+    constraintSets[3].push_back( Constraint( q3, POSITIVE_SIGN, xyz ));
+    for( unsigned i = 0; i < constraintSets.size(); ++i )
+    {
+        RealAlgebraicPoint mcCallumPoint = RealAlgebraicPoint();
+        RealAlgebraicPoint hongPoint     = RealAlgebraicPoint();
+        bool               satisfiable   = i < 2;
+        CPPUNIT_ASSERT_EQUAL( satisfiable, hongCAD.check( constraintSets[i], hongPoint ));
+        CPPUNIT_ASSERT_EQUAL( satisfiable, mcCallumCAD.check( constraintSets[i], mcCallumPoint ));
+    }
+}
+
+void CAD_unittest::testReducedProjections()
+{
+    symbol x( "x" ), y( "y" ), z( "z" );
+    vector<symbol> v = vector<symbol>();
+    v.push_back( x );
+    v.push_back( y );
+    v.push_back( z );
+
+    // Brown's operator drops the coefficient z of y*x^2 + z*x + 1 only if one variable remains
+    UnivariatePolynomialSet t;
+    t.insert( UnivariatePolynomial( y * x * x + z * x + 1, x ));
+    UnivariatePolynomialSet mcCallum = CAD::eliminationSet( t, y, UnivariatePolynomial::GENERIC_SUBRESULTANTSTRATEGY, GiNaCRA::MCCALLUM_PROJECTIONOPERATOR, 2 );
+    UnivariatePolynomialSet brown    = CAD::eliminationSet( t, y, UnivariatePolynomial::GENERIC_SUBRESULTANTSTRATEGY, GiNaCRA::BROWN_PROJECTIONOPERATOR, 2 );
+    CPPUNIT_ASSERT_EQUAL( mcCallum.size(), brown.size() );
+    CPPUNIT_ASSERT( mcCallum.find( UnivariatePolynomial( z, y )) != mcCallum.end() );
+    CPPUNIT_ASSERT( brown.find( UnivariatePolynomial( z, y )) != brown.end() );
+    brown = CAD::eliminationSet( t, y, UnivariatePolynomial::GENERIC_SUBRESULTANTSTRATEGY, GiNaCRA::BROWN_PROJECTIONOPERATOR, 1 );
+    CPPUNIT_ASSERT_EQUAL( mcCallum.size() - 1, brown.size() );
+    CPPUNIT_ASSERT( brown.find( UnivariatePolynomial( z, y )) == brown.end() );
+
+    // the unit sphere meets the plane x = y, but not the plane x = 2
+    UnivariatePolynomial sphere( x * x + y * y + z * z - 1, x ), diagonal( x - y, x ), plane( x - 2, x );
+    UnivariatePolynomialSet s;
+    s.insert( sphere );
+    s.insert( diagonal );
+    s.insert( plane );
+    CAD brownCAD = CAD( s, v, GiNaCRA::CADSettings::getSettings( GiNaCRA::BROWNPROJECTION_CADSETTING ));
+    RealAlgebraicPoint r = RealAlgebraicPoint();
+    vector<Constraint> constraints = vector<Constraint>();
+    constraints.push_back( Constraint( sphere, ZERO_SIGN, v ));
+    constraints.push_back( Constraint( diagonal, ZERO_SIGN, v ));
+    CPPUNIT_ASSERT( brownCAD.check( constraints, r ));
+    constraints.back() = Constraint( plane, ZERO_SIGN, v );
+    CPPUNIT_ASSERT( !brownCAD.check( constraints, r ));
+
+    // Lazard's operator keeps the leading and the trailing coefficient only
+    UnivariatePolynomialSet lazard = CAD::eliminationSet( t, y, UnivariatePolynomial::GENERIC_SUBRESULTANTSTRATEGY, GiNaCRA::LAZARD_PROJECTIONOPERATOR, 2 );
+    CPPUNIT_ASSERT( lazard.find( UnivariatePolynomial( y, y )) != lazard.end() );
+    CPPUNIT_ASSERT( lazard.find( UnivariatePolynomial( z, y )) == lazard.end() );
+
+    // y*x + z vanishes identically at y = z = 0, where Lazard's evaluation is x
+    list<RealAlgebraicNumberPtr> sample = list<RealAlgebraicNumberPtr>();
+    sample.push_back( RealAlgebraicNumberPtr( new RealAlgebraicNumberNR( 0 )));
+    sample.push_back( RealAlgebraicNumberPtr( new RealAlgebraicNumberNR( 0 )));
+    list<symbol> variables = list<symbol>();
+    variables.push_back( y );
+    variables.push_back( z );
+    SampleList currentSamples = SampleList();
+    SampleList lazardSamples  = CAD::samples( UnivariatePolynomial( y * x + z, x ), sample, variables, currentSamples,
+                                              GiNaCRA::CADSettings::getSettings( GiNaCRA::LAZARDPROJECTION_CADSETTING ));
+    CPPUNIT_ASSERT_EQUAL( (size_t)3, lazardSamples.size() );
+    CPPUNIT_ASSERT( !lazardSamples.emptyRoot() );
+
+    // (y^2 - 2)*x + z vanishes identically at z = 0 and y = sqrt(2), where Lazard's evaluation is x
+    sample.front() = RealAlgebraicNumberPtr( new RealAlgebraicNumberIR( RationalUnivariatePolynomial( y * y - 2, y ), GiNaCRA::OpenInterval( 1, 2 )));
+    currentSamples = SampleList();
+    lazardSamples  = CAD::samples( UnivariatePolynomial( (y * y - 2) * x + z, x ), sample, variables, currentSamples,
+                                   GiNaCRA::CADSettings::getSettings( GiNaCRA::LAZARDPROJECTION_CADSETTING ));
+    CPPUNIT_ASSERT_EQUAL( (size_t)3, lazardSamples.size() );
+    CPPUNIT_ASSERT( !lazardSamples.emptyRoot() );
+
+    // y*x + z^2 - 2 vanishes identically at y = 0 above the interval-represented base component z = sqrt(2), where Lazard's evaluation is x
+    sample.front() = RealAlgebraicNumberPtr( new RealAlgebraicNumberNR( 0 ));
+    sample.back()  = RealAlgebraicNumberPtr( new RealAlgebraicNumberIR( RationalUnivariatePolynomial( z * z - 2, z ), GiNaCRA::OpenInterval( 1, 2 )));
+    currentSamples = SampleList();
+    lazardSamples  = CAD::samples( UnivariatePolynomial( y * x + z * z - 2, x ), sample, variables, currentSamples,
+                                   GiNaCRA::CADSettings::getSettings( GiNaCRA::LAZARDPROJECTION_CADSETTING ));
+    CPPUNIT_ASSERT_EQUAL( (size_t)3, lazardSamples.size() );
+    CPPUNIT_ASSERT( !lazardSamples.emptyRoot() );
+
+    // (y^2 - 2)*x + z^2 - 3 vanishes identically at the interval-represented components y = sqrt(2) and z = sqrt(3), where Lazard's evaluation is x
+    sample.front() = RealAlgebraicNumberPtr( new RealAlgebraicNumberIR( RationalUnivariatePolynomial( y * y - 2, y ), GiNaCRA::OpenInterval( 1, 2 )));
+    sample.back()  = RealAlgebraicNumberPtr( new RealAlgebraicNumberIR( RationalUnivariatePolynomial( z * z - 3, z ), GiNaCRA::OpenInterval( 1, 2 )));
+    currentSamples = SampleList();
+    lazardSamples  = CAD::samples( UnivariatePolynomial( (y * y - 2) * x + z * z - 3, x ), sample, variables, currentSamples,
+                                   GiNaCRA::CADSettings::getSettings( GiNaCRA::LAZARDPROJECTION_CADSETTING ));
+    CPPUNIT_ASSERT_EQUAL( (size_t)3, lazardSamples.size() );
+    CPPUNIT_ASSERT( !lazardSamples.emptyRoot() );
+}
@@ -52,6 +52,11 @@ class CAD_unittest:
     CPPUNIT_TEST( testSamples );
     CPPUNIT_TEST( testElimination );
     CPPUNIT_TEST( testAddPolynomials );
+    CPPUNIT_TEST( testPolynomialPool );
+    CPPUNIT_TEST( testFactorization );
+    CPPUNIT_TEST( testGcdFreeBasis );
+    CPPUNIT_TEST( testMcCallumProjection );
+    CPPUNIT_TEST( testReducedProjections );
 
  // declare each test case
  CPPUNIT_TEST_SUITE_END()
@@ -76,6 +81,11 @@ class CAD_unittest:
      void testSamples();
      void testElimination();
      void testAddPolynomials();
+     void testPolynomialPool();
+     void testFactorization();
+     void testGcdFreeBasis();
+     void testMcCallumProjection();
+     void testReducedProjections();
 
 };
 #endif // GINACRA_CAD_TEST_H
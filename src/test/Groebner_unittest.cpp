@@ -20,6 +20,9 @@
  */
 
 
+#include <algorithm>
+#include <thread>
+
 #include "Groebner_unittest.h"
 #include "VariableListPool.h"
 #include "MultivariateMonomialMR_unittest.h"
@@ -28,6 +31,12 @@ CPPUNIT_TEST_SUITE_REGISTRATION( Groebner_unittest );
 
 using namespace GiNaCRA;
 
+static void setModulusInThread( unsigned p, unsigned* modulus )
+{
+    ModularCoefficientMR::setModulus( p );
+    *modulus = ModularCoefficientMR::modulus();
+}
+
 Groebner_unittest::Groebner_unittest(){}
 
 void Groebner_unittest::setUp()
@@ -65,6 +74,31 @@ void Groebner_unittest::setUp()
 
 void Groebner_unittest::tearDown(){}
 
+std::list<MultivariatePolynomialMRQ> Groebner_unittest::cyclic3( const MonomMRCompare& order )
+{
+    symbol x = VariableListPool::getVariableSymbol( 0 );
+    symbol y = VariableListPool::getVariableSymbol( 1 );
+    symbol z = VariableListPool::getVariableSymbol( 2 );
+    std::list<MultivariatePolynomialMRQ> input;
+    input.push_back( MultivariatePolynomialMRQ( x + y + z, order ));
+    input.push_back( MultivariatePolynomialMRQ( x * y + y * z + z * x, order ));
+    input.push_back( MultivariatePolynomialMRQ( x * y * z - 1, order ));
+    return input;
+}
+
+std::list<MultivariatePolynomialMRQ> Groebner_unittest::cyclic3LexBasis()
+{
+    MonomMRCompare lex = MonomMRCompare( &MultivariateMonomialMR::LexCompare );
+    symbol x = VariableListPool::getVariableSymbol( 0 );
+    symbol y = VariableListPool::getVariableSymbol( 1 );
+    symbol z = VariableListPool::getVariableSymbol( 2 );
+    std::list<MultivariatePolynomialMRQ> base;
+    base.push_back( MultivariatePolynomialMRQ( pow( z, 3 ) - 1, lex ));
+    base.push_back( MultivariatePolynomialMRQ( y * y + y * z + z * z, lex ));
+    base.push_back( MultivariatePolynomialMRQ( x + y + z, lex ));
+    return base;
+}
+
 void Groebner_unittest::testGroebner()
 {
     MonomMRCompare lex   = MonomMRCompare( &MultivariateMonomialMR::LexCompare );
@@ -147,3 +181,493 @@ void Groebner_unittest::testGroebner()
     h6.reduce();
     CPPUNIT_ASSERT( !h6.hasBeenReduced() );
 }
+
+void Groebner_unittest::testCoefficientDomains()
+{
+    MonomMRCompare lex = MonomMRCompare( &MultivariateMonomialMR::LexCompare );
+    symbol x = VariableListPool::getVariableSymbol( 0 );
+    symbol y = VariableListPool::getVariableSymbol( 1 );
+
+    // reduced basis of <x^2 + 2xy^2, xy + 2y^3 - 1> w.r.t. lex is {x, y^3 - 1/2}
+    GroebnerQ hq = GroebnerQ( MultivariatePolynomialMRQ( x * x + 2 * x * y * y, lex ), MultivariatePolynomialMRQ( x * y + 2 * pow( y, 3 ) - 1, lex ));
+    hq.solve();
+    hq.reduce();
+    std::list<MultivariatePolynomialMRQ> baseQ = hq.getBase();
+    CPPUNIT_ASSERT_EQUAL( (unsigned)2, hq.size() );
+    for( std::list<MultivariatePolynomialMRQ>::const_iterator i = baseQ.begin(); i != baseQ.end(); ++i )
+        CPPUNIT_ASSERT( i->toEx().is_equal( x ) || i->toEx().is_equal( pow( y, 3 ) - numeric( 1, 2 )));
+
+    // over the integers, the basis elements are primitive
+    GroebnerZ hz = GroebnerZ( MultivariatePolynomialMRZ( x * x + 2 * x * y * y, lex ), MultivariatePolynomialMRZ( x * y + 2 * pow( y, 3 ) - 1, lex ));
+    hz.solve();
+    hz.reduce();
+    std::list<MultivariatePolynomialMRZ> baseZ = hz.getBase();
+    CPPUNIT_ASSERT_EQUAL( (unsigned)2, hz.size() );
+    for( std::list<MultivariatePolynomialMRZ>::const_iterator i = baseZ.begin(); i != baseZ.end(); ++i )
+        CPPUNIT_ASSERT( i->toEx().is_equal( x ) || i->toEx().is_equal( 2 * pow( y, 3 ) - 1 ));
+
+    // modulo 7, -1/2 is represented by 3
+    unsigned oldModulus = ModularCoefficientMR::modulus();
+    ModularCoefficientMR::setModulus( 7 );
+    CPPUNIT_ASSERT( (ModularCoefficientMR( 2 ) * ModularCoefficientMR( 4 )) == ModularCoefficientMR( 1 ));
+    CPPUNIT_ASSERT( ModularCoefficientMR( 3 ).inverse() == ModularCoefficientMR( 5 ));
+    GroebnerZp hp = GroebnerZp( MultivariatePolynomialMRZp( x * x + 2 * x * y * y, lex ),
+                                MultivariatePolynomialMRZp( x * y + 2 * pow( y, 3 ) - 1, lex ));
+    hp.solve();
+    hp.reduce();
+    std::list<MultivariatePolynomialMRZp> baseZp = hp.getBase();
+    CPPUNIT_ASSERT_EQUAL( (unsigned)2, hp.size() );
+    for( std::list<MultivariatePolynomialMRZp>::const_iterator i = baseZp.begin(); i != baseZp.end(); ++i )
+        CPPUNIT_ASSERT( i->toEx().is_equal( x ) || i->toEx().is_equal( pow( y, 3 ) + 3 ));
+    // every thread has its own modulus
+    unsigned    threadModulus = 0;
+    std::thread other( &setModulusInThread, 5, &threadModulus );
+    other.join();
+    CPPUNIT_ASSERT_EQUAL( (unsigned)5, threadModulus );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)7, ModularCoefficientMR::modulus() );
+    ModularCoefficientMR::setModulus( oldModulus );
+
+    // converting between the coefficient domains
+    MultivariatePolynomialMR converted = MultivariatePolynomialMR( baseQ.back() );
+    CPPUNIT_ASSERT( converted.toEx().is_equal( baseQ.back().toEx() ));
+    CPPUNIT_ASSERT_THROW( IntegerCoefficientMR( numeric( 1, 2 )), std::domain_error );
+}
+
+void Groebner_unittest::testModularGroebner()
+{
+    MonomMRCompare grlex = MonomMRCompare( &MultivariateMonomialMR::GrLexCompare );
+    symbol x = VariableListPool::getVariableSymbol( 0 );
+    symbol y = VariableListPool::getVariableSymbol( 1 );
+    symbol z = VariableListPool::getVariableSymbol( 2 );
+
+    CPPUNIT_ASSERT_EQUAL( (unsigned)2147483647, ModularGroebner::previousPrime( 2147483648u ));
+    CPPUNIT_ASSERT_EQUAL( (unsigned)7, ModularGroebner::previousPrime( 11 ));
+    CPPUNIT_ASSERT_EQUAL( (unsigned)0, ModularGroebner::previousPrime( 2 ));
+
+    // the coefficients of the reduced basis need more than one word-size prime
+    std::list<MultivariatePolynomialMRQ> input;
+    input.push_back( MultivariatePolynomialMRQ( 144 * pow( y, 2 ) + 96 * pow( x, 2 ) * y + 9 * pow( x, 4 ) + 105 * pow( x, 2 ) + 70 * x - 98, grlex ));
+    input.push_back( MultivariatePolynomialMRQ( x * pow( y, 2 ) + 6 * x * y + pow( x, 3 ) + 9 * x, grlex ));
+    input.push_back( MultivariatePolynomialMRQ( numeric( 1234567, 89 ) * z - numeric( 987654321, 1000003 ) * x * y, grlex ));
+    ModularGroebner modular = ModularGroebner( input.begin(), input.end() );
+    modular.solve();
+    CPPUNIT_ASSERT( modular.isSolved() );
+    CPPUNIT_ASSERT( modular.usedPrimes() >= 2 );
+    CPPUNIT_ASSERT( !modular.isVerified() );
+
+    GroebnerQ rational = GroebnerQ( input.begin(), input.end() );
+    rational.solve();
+    rational.reduce();
+    std::list<MultivariatePolynomialMRQ> expected = rational.getBase();
+    std::list<MultivariatePolynomialMRQ> result   = modular.getBase();
+    CPPUNIT_ASSERT_EQUAL( expected.size(), result.size() );
+    for( std::list<MultivariatePolynomialMRQ>::const_iterator i = expected.begin(), j = result.begin(); i != expected.end(); ++i, ++j )
+        CPPUNIT_ASSERT_EQUAL( *i, *j );
+
+    // the images are computed by F4
+    ModularGroebner modularF4 = ModularGroebner( input.begin(), input.end() );
+    modularF4.setEngine( GroebnerSettings::F4_ENGINE );
+    CPPUNIT_ASSERT_EQUAL( GroebnerSettings::F4_ENGINE, modularF4.engine() );
+    modularF4.solve();
+    result = modularF4.getBase();
+    CPPUNIT_ASSERT_EQUAL( expected.size(), result.size() );
+    for( std::list<MultivariatePolynomialMRQ>::const_iterator i = expected.begin(), j = result.begin(); i != expected.end(); ++i, ++j )
+        CPPUNIT_ASSERT_EQUAL( *i, *j );
+
+    // the images are reduced concurrently
+    ModularGroebner modularParallel = ModularGroebner( input.begin(), input.end() );
+    modularParallel.setThreads( 2 );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)2, modularParallel.threads() );
+    modularParallel.solve();
+    result = modularParallel.getBase();
+    CPPUNIT_ASSERT_EQUAL( expected.size(), result.size() );
+    for( std::list<MultivariatePolynomialMRQ>::const_iterator i = expected.begin(), j = result.begin(); i != expected.end(); ++i, ++j )
+        CPPUNIT_ASSERT_EQUAL( *i, *j );
+
+    // the basis of a homogeneous ideal is verified
+    std::list<MultivariatePolynomialMRQ> homogeneous;
+    homogeneous.push_back( MultivariatePolynomialMRQ( 3 * x * x - numeric( 5, 7 ) * y * z, grlex ));
+    homogeneous.push_back( MultivariatePolynomialMRQ( x * y - 11 * z * z, grlex ));
+    ModularGroebner modularHomogeneous = ModularGroebner( homogeneous.begin(), homogeneous.end() );
+    modularHomogeneous.solve();
+    CPPUNIT_ASSERT( modularHomogeneous.isVerified() );
+    GroebnerQ rationalHomogeneous = GroebnerQ( homogeneous.begin(), homogeneous.end() );
+    rationalHomogeneous.solve();
+    rationalHomogeneous.reduce();
+    CPPUNIT_ASSERT( rationalHomogeneous.getBase() == modularHomogeneous.getBase() );
+
+    // 1 is in the ideal
+    std::list<MultivariatePolynomialMRQ> inconsistent;
+    inconsistent.push_back( MultivariatePolynomialMRQ( x * y - 1, grlex ));
+    inconsistent.push_back( MultivariatePolynomialMRQ( 2 * x, grlex ));
+    ModularGroebner trivial = ModularGroebner( inconsistent.begin(), inconsistent.end() );
+    trivial.solve();
+    CPPUNIT_ASSERT_EQUAL( (unsigned)1, trivial.size() );
+    CPPUNIT_ASSERT( trivial.getBase().front().isConstant() );
+}
+
+void Groebner_unittest::testPairSelection()
+{
+    MonomMRCompare grlex = MonomMRCompare( &MultivariateMonomialMR::GrLexCompare );
+    MonomMRCompare lex   = MonomMRCompare( &MultivariateMonomialMR::LexCompare );
+    symbol x = VariableListPool::getVariableSymbol( 0 );
+    symbol y = VariableListPool::getVariableSymbol( 1 );
+    symbol z = VariableListPool::getVariableSymbol( 2 );
+
+    // under lex, the sugar of x*z + y^9 is much higher than the degree of its leading monomial, so the strategies select different pairs
+    GroebnerQ sugar = GroebnerQ( MultivariatePolynomialMRQ( x * z + pow( y, 9 ), lex ), MultivariatePolynomialMRQ( x * y, lex ),
+                                 MultivariatePolynomialMRQ( pow( y, 5 ), lex ));
+    CPPUNIT_ASSERT_EQUAL( GroebnerSettings::DEFAULT_PAIRSELECTIONSTRATEGY, sugar.pairSelectionStrategy() );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)2, sugar.nrOfPendingPairs() );
+    // the pair of x*y and y^5 has the sugar 6, the pair of x*z + y^9 and x*y the sugar 10
+    CPPUNIT_ASSERT( sugar.nextPairLcm() == MultivariatePolynomialMRQ( x * pow( y, 5 ), lex ).lmon() );
+    GroebnerQ degree = GroebnerQ( MultivariatePolynomialMRQ( x * z + pow( y, 9 ), lex ), MultivariatePolynomialMRQ( x * y, lex ),
+                                  MultivariatePolynomialMRQ( pow( y, 5 ), lex ));
+    degree.setPairSelectionStrategy( GroebnerSettings::DEGREE_PAIRSELECTIONSTRATEGY );
+    CPPUNIT_ASSERT_EQUAL( GroebnerSettings::DEGREE_PAIRSELECTIONSTRATEGY, degree.pairSelectionStrategy() );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)2, degree.nrOfPendingPairs() );
+    // the lcm x*y*z has a lower degree than x*y^5
+    CPPUNIT_ASSERT( degree.nextPairLcm() == MultivariatePolynomialMRQ( x * y * z, lex ).lmon() );
+    sugar.solve();
+    degree.solve();
+    CPPUNIT_ASSERT_EQUAL( (unsigned)0, sugar.nrOfPendingPairs() );
+    CPPUNIT_ASSERT( sugar.nextPairLcm() == MultivariateMonomialMR() );
+    sugar.reduce();
+    degree.reduce();
+    CPPUNIT_ASSERT( sugar.getBase() == degree.getBase() );
+
+    // coprime leading monomials, the product criterion discards the only pair
+    GroebnerQ coprime = GroebnerQ( MultivariatePolynomialMRQ( x * x + 1, grlex ), MultivariatePolynomialMRQ( y * y * y + z, grlex ));
+    CPPUNIT_ASSERT( coprime.isSolved() );
+    coprime.solve();
+    CPPUNIT_ASSERT_EQUAL( (unsigned)2, coprime.size() );
+}
+
+void Groebner_unittest::testF4()
+{
+    MonomMRCompare grlex = MonomMRCompare( &MultivariateMonomialMR::GrLexCompare );
+    MonomMRCompare lex   = MonomMRCompare( &MultivariateMonomialMR::LexCompare );
+    symbol x = VariableListPool::getVariableSymbol( 0 );
+    symbol y = VariableListPool::getVariableSymbol( 1 );
+    symbol z = VariableListPool::getVariableSymbol( 2 );
+
+    // cyclic 3, the reduced bases of both engines coincide
+    std::list<MultivariatePolynomialMRQ> input = cyclic3( lex );
+
+    GroebnerQ f4 = GroebnerQ( input.begin(), input.end() );
+    CPPUNIT_ASSERT_EQUAL( GroebnerSettings::DEFAULT_ENGINE, f4.engine() );
+    f4.setEngine( GroebnerSettings::F4_ENGINE );
+    CPPUNIT_ASSERT_EQUAL( GroebnerSettings::F4_ENGINE, f4.engine() );
+    f4.solve();
+    CPPUNIT_ASSERT( f4.isSolved() );
+    f4.reduce();
+    CPPUNIT_ASSERT( f4.getBase() == cyclic3LexBasis() );
+
+    std::list<MultivariatePolynomialMRZp> inputZp;
+    for( std::list<MultivariatePolynomialMRQ>::const_iterator p = input.begin(); p != input.end(); ++p )
+        inputZp.push_back( MultivariatePolynomialMRZp( *p ));
+    GroebnerZp f4Zp = GroebnerZp( inputZp.begin(), inputZp.end() );
+    f4Zp.setEngine( GroebnerSettings::F4_ENGINE );
+    f4Zp.solve();
+    f4Zp.reduce();
+    GroebnerZp buchbergerZp = GroebnerZp( inputZp.begin(), inputZp.end() );
+    buchbergerZp.solve();
+    buchbergerZp.reduce();
+    CPPUNIT_ASSERT( f4Zp.getBase() == buchbergerZp.getBase() );
+
+    // inconsistent system
+    GroebnerQ inconsistent = GroebnerQ( MultivariatePolynomialMRQ( x * y - 1, grlex ), MultivariatePolynomialMRQ( x * y * z - z + 2, grlex ),
+                                        MultivariatePolynomialMRQ( z - 1, grlex ));
+    inconsistent.setEngine( GroebnerSettings::F4_ENGINE );
+    inconsistent.solve();
+    CPPUNIT_ASSERT( inconsistent.isConstant() );
+
+    // the fraction-free domain falls back to Buchberger's algorithm
+    GroebnerZ fallback = GroebnerZ( MultivariatePolynomialMRZ( x * x - 2 * y, grlex ), MultivariatePolynomialMRZ( x * y - 3, grlex ));
+    fallback.setEngine( GroebnerSettings::F4_ENGINE );
+    fallback.solve();
+    CPPUNIT_ASSERT( fallback.isSolved() );
+}
+
+void Groebner_unittest::testParallelReduction()
+{
+    MonomMRCompare grlex = MonomMRCompare( &MultivariateMonomialMR::GrLexCompare );
+    symbol x = VariableListPool::getVariableSymbol( 0 );
+    symbol y = VariableListPool::getVariableSymbol( 1 );
+    symbol z = VariableListPool::getVariableSymbol( 2 );
+    symbol w = VariableListPool::getVariableSymbol( 3 );
+
+    // cyclic 4
+    std::list<MultivariatePolynomialMRZp> input;
+    input.push_back( MultivariatePolynomialMRZp( x + y + z + w, grlex ));
+    input.push_back( MultivariatePolynomialMRZp( x * y + y * z + z * w + w * x, grlex ));
+    input.push_back( MultivariatePolynomialMRZp( x * y * z + y * z * w + z * w * x + w * x * y, grlex ));
+    input.push_back( MultivariatePolynomialMRZp( x * y * z * w - 1, grlex ));
+
+    GroebnerZp sequential = GroebnerZp( input.begin(), input.end() );
+    CPPUNIT_ASSERT_EQUAL( GroebnerSettings::DEFAULT_THREADS, sequential.threads() );
+    sequential.solve();
+    sequential.reduce();
+    CPPUNIT_ASSERT_EQUAL( (unsigned)7, sequential.size() );
+    for( unsigned threads = 2; threads <= 4; ++threads )
+    {
+        GroebnerZp parallel = GroebnerZp( input.begin(), input.end() );
+        parallel.setThreads( threads );
+        CPPUNIT_ASSERT_EQUAL( threads, parallel.threads() );
+        parallel.solve();
+        parallel.reduce();
+        CPPUNIT_ASSERT( parallel.getBase() == sequential.getBase() );
+    }
+
+    // the worker threads adopt the modulus of the calling thread
+    unsigned oldModulus = ModularCoefficientMR::modulus();
+    ModularCoefficientMR::setModulus( 7 );
+    std::list<MultivariatePolynomialMRZp> input7;
+    input7.push_back( MultivariatePolynomialMRZp( x + y + z + w, grlex ));
+    input7.push_back( MultivariatePolynomialMRZp( x * y + y * z + z * w + w * x, grlex ));
+    input7.push_back( MultivariatePolynomialMRZp( x * y * z + y * z * w + z * w * x + w * x * y, grlex ));
+    input7.push_back( MultivariatePolynomialMRZp( x * y * z * w - 1, grlex ));
+    GroebnerZp sequential7 = GroebnerZp( input7.begin(), input7.end() );
+    sequential7.solve();
+    sequential7.reduce();
+    GroebnerZp parallel7 = GroebnerZp( input7.begin(), input7.end() );
+    parallel7.setThreads( 4 );
+    parallel7.solve();
+    parallel7.reduce();
+    CPPUNIT_ASSERT( parallel7.getBase() == sequential7.getBase() );
+    ModularCoefficientMR::setModulus( oldModulus );
+
+    GroebnerZp hardware = GroebnerZp( input.begin(), input.end() );
+    hardware.setThreads( 0 );
+    CPPUNIT_ASSERT( hardware.threads() >= 1 );
+
+    // inconsistent system
+    GroebnerZp inconsistent = GroebnerZp( MultivariatePolynomialMRZp( x * y - 1, grlex ), MultivariatePolynomialMRZp( x * y * z - z + 2, grlex ),
+                                          MultivariatePolynomialMRZp( z - 1, grlex ));
+    inconsistent.setThreads( 2 );
+    inconsistent.solve();
+    CPPUNIT_ASSERT( inconsistent.isConstant() );
+
+    // the setting is ignored for domains which are not thread-safe
+    GroebnerQ rational = GroebnerQ( MultivariatePolynomialMRQ( x * x - 2 * y, grlex ), MultivariatePolynomialMRQ( x * y - 3, grlex ));
+    rational.setThreads( 4 );
+    rational.solve();
+    CPPUNIT_ASSERT( rational.isSolved() );
+}
+
+void Groebner_unittest::testCheckpoints()
+{
+    MonomMRCompare lex = MonomMRCompare( &MultivariateMonomialMR::LexCompare );
+    symbol x = VariableListPool::getVariableSymbol( 0 );
+    symbol y = VariableListPool::getVariableSymbol( 1 );
+    symbol z = VariableListPool::getVariableSymbol( 2 );
+
+    GroebnerQ g = GroebnerQ( MultivariatePolynomialMRQ( x + y + z, lex ), MultivariatePolynomialMRQ( x * y + y * z + z * x, lex ));
+    CPPUNIT_ASSERT_THROW( g.pop(), std::runtime_error );
+    g.solve();
+    g.reduce();
+    std::list<MultivariatePolynomialMRQ> base = g.getBase();
+
+    // completing cyclic 3 and backtracking
+    g.push();
+    g.addPolynomial( MultivariatePolynomialMRQ( x * y * z - 1, lex ));
+    CPPUNIT_ASSERT( !g.isSolved() );
+    g.solve();
+    g.reduce();
+    CPPUNIT_ASSERT_EQUAL( (unsigned)3, g.size() );
+
+    // an inconsistent extension on top
+    g.push();
+    CPPUNIT_ASSERT_EQUAL( (unsigned)2, g.nrOfCheckpoints() );
+    g.addPolynomial( MultivariatePolynomialMRQ( z - 2, lex ));
+    g.solve();
+    CPPUNIT_ASSERT( g.isConstant() );
+    g.pop();
+    CPPUNIT_ASSERT_EQUAL( (unsigned)3, g.size() );
+    CPPUNIT_ASSERT( !g.isConstant() );
+
+    g.pop();
+    CPPUNIT_ASSERT_EQUAL( (unsigned)0, g.nrOfCheckpoints() );
+    CPPUNIT_ASSERT( g.isSolved() );
+    CPPUNIT_ASSERT( g.getBase() == base );
+
+    // pending pairs are restored as well
+    g.push();
+    g.addPolynomial( MultivariatePolynomialMRQ( x * y * z - 1, lex ));
+    g.pop();
+    CPPUNIT_ASSERT( g.isSolved() );
+    CPPUNIT_ASSERT( g.getBase() == base );
+}
+
+void Groebner_unittest::testInfeasibleSubset()
+{
+    MonomMRCompare grlex = MonomMRCompare( &MultivariateMonomialMR::GrLexCompare );
+    symbol x = VariableListPool::getVariableSymbol( 0 );
+    symbol y = VariableListPool::getVariableSymbol( 1 );
+    symbol z = VariableListPool::getVariableSymbol( 2 );
+
+    // x*y = 1 and x = 0 are inconsistent, the other generators do not matter
+    MultivariatePolynomialMRQ p1 = MultivariatePolynomialMRQ( x * y - 1, grlex );
+    MultivariatePolynomialMRQ p2 = MultivariatePolynomialMRQ( y * y + z, grlex );
+    MultivariatePolynomialMRQ p3 = MultivariatePolynomialMRQ( z * z - y, grlex );
+    MultivariatePolynomialMRQ p4 = MultivariatePolynomialMRQ( x, grlex );
+    std::list<MultivariatePolynomialMRQ> input;
+    input.push_back( p1 );
+    input.push_back( p2 );
+    input.push_back( p3 );
+
+    GroebnerQ g = GroebnerQ( input.begin(), input.end() );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)3, (unsigned)g.getGenerators().size() );
+    g.solve();
+    CPPUNIT_ASSERT( g.getInfeasibleSubset().empty() );
+    std::list<GroebnerQ::Origins> origins = g.getOrigins();
+    CPPUNIT_ASSERT_EQUAL( g.size(), (unsigned)origins.size() );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)3, (unsigned)origins.front().size() );
+
+    g.addPolynomial( p4 );
+    g.solve();
+    CPPUNIT_ASSERT( g.isConstant() );
+    std::list<MultivariatePolynomialMRQ> subset = g.getInfeasibleSubset();
+    CPPUNIT_ASSERT( std::find( subset.begin(), subset.end(), p1 ) != subset.end() );
+    CPPUNIT_ASSERT( std::find( subset.begin(), subset.end(), p4 ) != subset.end() );
+    std::list<MultivariatePolynomialMRQ> minimal = g.getInfeasibleSubset( true );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)2, (unsigned)minimal.size() );
+    CPPUNIT_ASSERT( std::find( minimal.begin(), minimal.end(), p1 ) != minimal.end() );
+    CPPUNIT_ASSERT( std::find( minimal.begin(), minimal.end(), p4 ) != minimal.end() );
+
+    // the F4 engine tracks the origins as well
+    input.push_back( p4 );
+    GroebnerQ f4 = GroebnerQ( input.begin(), input.end() );
+    f4.setEngine( GroebnerSettings::F4_ENGINE );
+    f4.solve();
+    CPPUNIT_ASSERT( f4.isConstant() );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)2, (unsigned)f4.getInfeasibleSubset( true ).size() );
+}
+
+void Groebner_unittest::testJanetBasis()
+{
+    MonomMRCompare lex = MonomMRCompare( &MultivariateMonomialMR::LexCompare );
+    symbol x = VariableListPool::getVariableSymbol( 0 );
+    symbol y = VariableListPool::getVariableSymbol( 1 );
+    symbol z = VariableListPool::getVariableSymbol( 2 );
+
+    std::list<MultivariatePolynomialMRQ> input = cyclic3( lex );
+    JanetBasisQ j = JanetBasisQ( input.begin(), input.end() );
+    CPPUNIT_ASSERT( !j.isSolved() );
+    j.solve();
+    CPPUNIT_ASSERT( j.isSolved() );
+    CPPUNIT_ASSERT( !j.isConstant() );
+    CPPUNIT_ASSERT( j.size() >= 3 );
+
+    std::list<MultivariatePolynomialMRQ> reduced = cyclic3LexBasis();
+    std::list<MultivariatePolynomialMRQ> base = j.getReducedGroebnerBase();
+    CPPUNIT_ASSERT_EQUAL( (unsigned)3, (unsigned)base.size() );
+    for( std::list<MultivariatePolynomialMRQ>::const_iterator p = reduced.begin(); p != reduced.end(); ++p )
+        CPPUNIT_ASSERT( std::find( base.begin(), base.end(), *p ) != base.end() );
+
+    GroebnerQ g = GroebnerQ( input.begin(), input.end() );
+    g.solve();
+    g.reduce();
+    CPPUNIT_ASSERT( g.getBase() == base );
+
+    // the computation continues incrementally
+    j.addPolynomial( MultivariatePolynomialMRQ( z - 2, lex ));
+    CPPUNIT_ASSERT( !j.isSolved() );
+    j.solve();
+    CPPUNIT_ASSERT( j.isConstant() );
+}
+
+void Groebner_unittest::testSignatureEngine()
+{
+    MonomMRCompare grlex = MonomMRCompare( &MultivariateMonomialMR::GrLexCompare );
+    symbol x = VariableListPool::getVariableSymbol( 0 );
+    symbol y = VariableListPool::getVariableSymbol( 1 );
+    symbol z = VariableListPool::getVariableSymbol( 2 );
+
+    // a regular sequence, the only common zero is the origin
+    std::list<MultivariatePolynomialMRQ> input;
+    input.push_back( MultivariatePolynomialMRQ( x * x + y * z, grlex ));
+    input.push_back( MultivariatePolynomialMRQ( y * y + x * z, grlex ));
+    input.push_back( MultivariatePolynomialMRQ( z * z + x * y, grlex ));
+
+    GroebnerQ buchberger = GroebnerQ( input.begin(), input.end() );
+    buchberger.solve();
+    buchberger.reduce();
+    CPPUNIT_ASSERT( buchberger.nrOfZeroReductions() > 0 );
+
+    GroebnerQ g = GroebnerQ( input.begin(), input.end() );
+    g.setEngine( GroebnerSettings::SIGNATURE_ENGINE );
+    CPPUNIT_ASSERT_EQUAL( GroebnerSettings::SIGNATURE_ENGINE, g.engine() );
+    g.solve();
+    CPPUNIT_ASSERT( g.isSolved() );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)0, g.nrOfZeroReductions() );
+    g.reduce();
+    CPPUNIT_ASSERT( g.getBase() == buchberger.getBase() );
+
+    // x^k is in the ideal, so x = 1 is inconsistent
+    g.push();
+    g.addPolynomial( MultivariatePolynomialMRQ( x - 1, grlex ));
+    g.solve();
+    CPPUNIT_ASSERT( g.isConstant() );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)4, (unsigned)g.getInfeasibleSubset( true ).size() );
+    g.pop();
+    CPPUNIT_ASSERT( g.getBase() == buchberger.getBase() );
+}
+
+void Groebner_unittest::testEliminationOrder()
+{
+    MonomMRCompare block = MonomMRCompare( BlockOrder( 1 ));
+    symbol t = VariableListPool::getVariableSymbol( 0 );
+    symbol x = VariableListPool::getVariableSymbol( 1 );
+    symbol y = VariableListPool::getVariableSymbol( 2 );
+    CPPUNIT_ASSERT( block != MonomMRCompare( BlockOrder( 2 )));
+    CPPUNIT_ASSERT( !(block != MonomMRCompare( BlockOrder( 1 ))));
+
+    // the parametrization x = t^2, y = t^3 of the cusp
+    std::list<MultivariatePolynomialMRQ> input;
+    input.push_back( MultivariatePolynomialMRQ( x - t * t, block ));
+    input.push_back( MultivariatePolynomialMRQ( y - pow( t, 3 ), block ));
+
+    GroebnerQ g = GroebnerQ( input.begin(), input.end() );
+    g.solve();
+    g.reduce();
+    std::list<MultivariatePolynomialMRQ> base = g.getBase();
+    // the basis contains the implicit equation, which is free of t
+    MultivariatePolynomialMRQ cusp = MultivariatePolynomialMRQ( pow( x, 3 ) - y * y, block );
+    CPPUNIT_ASSERT( std::find( base.begin(), base.end(), cusp ) != base.end() );
+    for( std::list<MultivariatePolynomialMRQ>::const_iterator p = base.begin(); p != base.end(); ++p )
+        CPPUNIT_ASSERT( p->lmon().exponentOf( 0 ) > 0 || *p == cusp );
+}
+
+void Groebner_unittest::testFGLM()
+{
+    MonomMRCompare lex     = MonomMRCompare( &MultivariateMonomialMR::LexCompare );
+    MonomMRCompare grevlex = MonomMRCompare( &MultivariateMonomialMR::GrRevLexCompare );
+    symbol x = VariableListPool::getVariableSymbol( 0 );
+    symbol y = VariableListPool::getVariableSymbol( 1 );
+    symbol z = VariableListPool::getVariableSymbol( 2 );
+
+    std::list<MultivariatePolynomialMRQ> input = cyclic3( grevlex );
+    std::list<MultivariatePolynomialMRQ> base  = FGLMQ::lexBasis( input.begin(), input.end() );
+    CPPUNIT_ASSERT( base == cyclic3LexBasis() );
+
+    // and back
+    GroebnerQ g = GroebnerQ( input.begin(), input.end() );
+    g.solve();
+    g.reduce();
+    CPPUNIT_ASSERT( FGLMQ::isZeroDimensional( g.getBase() ));
+    CPPUNIT_ASSERT( FGLMQ::convert( base, grevlex ) == g.getBase() );
+
+    // an inconsistent ideal
+    std::list<MultivariatePolynomialMRQ> inconsistent;
+    inconsistent.push_back( MultivariatePolynomialMRQ( x * y - 1, grevlex ));
+    inconsistent.push_back( MultivariatePolynomialMRQ( x, grevlex ));
+    base = FGLMQ::lexBasis( inconsistent.begin(), inconsistent.end() );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)1, (unsigned)base.size() );
+    CPPUNIT_ASSERT( base.front().isConstant() );
+
+    // the line x = y has infinitely many points
+    std::list<MultivariatePolynomialMRQ> line;
+    line.push_back( MultivariatePolynomialMRQ( x - y, grevlex ));
+    CPPUNIT_ASSERT_THROW( FGLMQ::lexBasis( line.begin(), line.end() ), std::invalid_argument );
+}
@@ -25,6 +25,9 @@
 
 #include <cppunit/extensions/HelperMacros.h>
 #include "Groebner.h"
+#include "ModularGroebner.h"
+#include "JanetBasis.h"
+#include "FGLM.h"
 
 using namespace GiNaCRA;
 
@@ -35,6 +38,17 @@ class Groebner_unittest:
         Groebner_unittest();
         CPPUNIT_TEST_SUITE( Groebner_unittest );
         CPPUNIT_TEST( testGroebner );
+        CPPUNIT_TEST( testCoefficientDomains );
+        CPPUNIT_TEST( testModularGroebner );
+        CPPUNIT_TEST( testPairSelection );
+        CPPUNIT_TEST( testF4 );
+        CPPUNIT_TEST( testParallelReduction );
+        CPPUNIT_TEST( testCheckpoints );
+        CPPUNIT_TEST( testInfeasibleSubset );
+        CPPUNIT_TEST( testJanetBasis );
+        CPPUNIT_TEST( testSignatureEngine );
+        CPPUNIT_TEST( testEliminationOrder );
+        CPPUNIT_TEST( testFGLM );
 
      CPPUNIT_TEST_SUITE_END()
 
@@ -44,12 +58,28 @@ class Groebner_unittest:
      void setUp();
      void tearDown();
      void testGroebner();
+     void testCoefficientDomains();
+     void testModularGroebner();
+     void testPairSelection();
+     void testF4();
+     void testParallelReduction();
+     void testCheckpoints();
+     void testInfeasibleSubset();
+     void testJanetBasis();
+     void testSignatureEngine();
+     void testEliminationOrder();
+     void testFGLM();
 
  private:
      MultivariateTermMR       t1, t2, t3, t4, t5, t6;
      MultivariateTermMR       u1, u2, u3, u4, u5, u6, u7;
      MultivariatePolynomialMR f1, f2, f3, f4, f5, f6;
 
+     /// the cyclic 3-roots problem x + y + z, xy + yz + zx, xyz - 1
+     static std::list<MultivariatePolynomialMRQ> cyclic3( const MonomMRCompare& order );
+     /// the reduced lexicographic Groebner basis z^3 - 1, y^2 + yz + z^2, x + y + z of cyclic3
+     static std::list<MultivariatePolynomialMRQ> cyclic3LexBasis();
+
 };
 
 #endif   /** GROEBNER_UNITTEST_H */
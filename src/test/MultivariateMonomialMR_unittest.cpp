@@ -27,7 +27,7 @@
  *
  * @author Sebastian Junges
  * @since 2010-11-27
- * @version 2011-11-27
+ * @version 2026-10-18
  *
  * Notation is following http://www.possibility.com/Cpp/CppCodingStandard.html.
  */
@@ -120,6 +120,61 @@ void MultivariateMonomialMRTest::testgrevorder()
 
 }
 
+void MultivariateMonomialMRTest::testweightedorder()
+{
+    CPPUNIT_ASSERT( GrLexOrder::less( m3, m6 ));
+    CPPUNIT_ASSERT( !GrLexOrder::less( m6, m3 ));
+    CPPUNIT_ASSERT( LexOrder::less( m8, m3 ));
+
+    // x_1 has weight 1, x_2 has weight 5
+    std::vector<unsigned> weights;
+    weights.push_back( 0 );
+    weights.push_back( 1 );
+    weights.push_back( 5 );
+    WeightedOrder weighted = WeightedOrder( weights );
+    CPPUNIT_ASSERT_EQUAL( (unsigned long)2, weighted.weight( m3 ));
+    CPPUNIT_ASSERT_EQUAL( (unsigned long)14, weighted.weight( m5 ));
+    CPPUNIT_ASSERT_EQUAL( (unsigned long)6, weighted.weight( m6 ));
+    CPPUNIT_ASSERT( weighted.less( m3, m8 ));
+    CPPUNIT_ASSERT( weighted.less( m8, m4 ) == false );
+    CPPUNIT_ASSERT( !weighted.less( m1, m1 ));
+
+    // eliminating x_0, x_1, x_2: every monomial containing them is bigger than the monomials in x_3, x_4
+    BlockOrder block = BlockOrder( 3 );
+    CPPUNIT_ASSERT( block.less( m6, m3 ));
+    CPPUNIT_ASSERT( !block.less( m3, m6 ));
+    CPPUNIT_ASSERT( block.less( m5, m7 ));
+    // ties are broken by the given order
+    CPPUNIT_ASSERT( block.less( m3, m8 ) == MultivariateMonomialMR::GrRevLexCompare( m3, m8 ));
+}
+
+void MultivariateMonomialMRTest::testdivisormask()
+{
+    MultivariateMonomialMR monomials[] = { MultivariateMonomialMR(), m1, m2, m3, m4, m5, m6, m7, m8 };
+    for( unsigned i = 0; i < 9; ++i )
+        for( unsigned j = 0; j < 9; ++j )
+            if( monomials[i].dividable( monomials[j] ))
+                CPPUNIT_ASSERT( MultivariateMonomialMR::maskAllowsDivision( monomials[i].divisorMask(), monomials[j].divisorMask() ));
+    // rejected by the masks alone
+    CPPUNIT_ASSERT( !MultivariateMonomialMR::maskAllowsDivision( m3.divisorMask(), m4.divisorMask() ));
+    CPPUNIT_ASSERT( !MultivariateMonomialMR::maskAllowsDivision( m5.divisorMask(), m6.divisorMask() ));
+    // x_1 and x_17 share their bits
+    CPPUNIT_ASSERT_EQUAL( m3.divisorMask(), MultivariateMonomialMR( 17, 2 ).divisorMask() );
+
+    MonomialDivisorIndex index;
+    index.push_back( m6 );
+    index.push_back( m4 );
+    index.push_back( m8 );
+    index.push_back( m3 );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)4, index.size() );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)0, index.findDivisor( m7 ));
+    CPPUNIT_ASSERT_EQUAL( (unsigned)1, index.findDivisor( m7, 1 ));
+    CPPUNIT_ASSERT_EQUAL( (unsigned)3, index.findDivisor( m1, 3 ));
+    CPPUNIT_ASSERT_EQUAL( (unsigned)2, index.findDivisor( m1 ));
+    CPPUNIT_ASSERT_EQUAL( (unsigned)4, index.findDivisor( MultivariateMonomialMR( 1, 1 )));
+    CPPUNIT_ASSERT( index[1] == m4 );
+}
+
 void MultivariateMonomialMRTest::testexpr()
 {
     //std::cout << "testexpr" << std::endl;
@@ -28,7 +28,7 @@
  *
  * @author Sebastian Junges
  * @since 2010-11-27
- * @version 2011-05-27
+ * @version 2026-10-18
  *
  * Notation is following http://www.possibility.com/Cpp/CppCodingStandard.html.
  */
@@ -36,6 +36,8 @@
 #include <cppunit/extensions/HelperMacros.h>
 
 #include "MultivariateMonomialMR.h"
+#include "MonomialOrder.h"
+#include "MonomialDivisorIndex.h"
 #include "operators.h" // need operators on top because of correct operator<< for tests.
 
 using namespace GiNaCRA;
@@ -52,6 +54,8 @@ class MultivariateMonomialMRTest:
     CPPUNIT_TEST( testdeg );
     CPPUNIT_TEST( testlexorder );
     CPPUNIT_TEST( testgrevorder );
+    CPPUNIT_TEST( testweightedorder );
+    CPPUNIT_TEST( testdivisormask );
     CPPUNIT_TEST( testexpr );
 
  CPPUNIT_TEST_SUITE_END()
@@ -72,6 +76,8 @@ class MultivariateMonomialMRTest:
      void testdeg();
      void testlexorder();
      void testgrevorder();
+     void testweightedorder();
+     void testdivisormask();
      void testexpr();
 
 };
@@ -159,6 +159,13 @@ void MultivariatePolynomialMR_unittest::testRem()
     CPPUNIT_ASSERT( f3.CalculateRemainder( l1.begin(), l1.end() ).isZero() );
     l1.push_back( f4 );
     CPPUNIT_ASSERT( f5.CalculateRemainder( l1.begin(), l1.end() ).isZero() );
+
+    // an index built once gives the same remainders and used divisors
+    PolynomialDivisorIndex<std::list<MultivariatePolynomialMR>::const_iterator> divisors( l1.begin(), l1.end() );
+    std::vector<bool> used, usedIndexed;
+    CPPUNIT_ASSERT_EQUAL( f5.CalculateRemainder( l1.begin(), l1.end(), used ), f5.CalculateRemainder( divisors, usedIndexed ));
+    CPPUNIT_ASSERT( used == usedIndexed );
+    CPPUNIT_ASSERT( f3.CalculateRemainder( divisors ).isZero() );
     //CPPUNIT_ASSERT();
 }
 
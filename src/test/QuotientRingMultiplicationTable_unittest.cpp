@@ -0,0 +1,145 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+/**
+ * Unit tests for the class template QuotientRingMultiplicationTableT.
+ *
+ * @author Ulrich Loup
+ * @since 2011-07-12
+ * @version 2026-10-18
+ *
+ * Notation is following http://www.possibility.com/Cpp/CppCodingStandard.html.
+ */
+
+#include "QuotientRingMultiplicationTable_unittest.h"
+#include "VariableListPool.h"
+
+// test suite
+CPPUNIT_TEST_SUITE_REGISTRATION( QuotientRingMultiplicationTableTest );
+
+void QuotientRingMultiplicationTableTest::setUp()
+{
+    grevlex = MonomMRCompare( &MultivariateMonomialMR::GrRevLexCompare );
+    x       = VariableListPool::getVariableSymbol( 0 );
+    y       = VariableListPool::getVariableSymbol( 1 );
+    system.clear();
+    system.push_back( MultivariatePolynomialMRQ( x * x - 2, grevlex ));
+    system.push_back( MultivariatePolynomialMRQ( y * y - x, grevlex ));
+}
+
+void QuotientRingMultiplicationTableTest::tearDown(){}
+
+void QuotientRingMultiplicationTableTest::testConstructor()
+{
+    QuotientRingMultiplicationTableQ T1 = QuotientRingMultiplicationTableQ( system.begin(), system.end() );
+    GroebnerQ                        gb = GroebnerQ( system.begin(), system.end() );
+    gb.solve();
+    gb.reduce();
+    QuotientRingMultiplicationTableQ T2 = QuotientRingMultiplicationTableQ( gb );
+    CPPUNIT_ASSERT( T1 == T2 );
+    // 1, y, x, xy
+    CPPUNIT_ASSERT_EQUAL( (unsigned)4, T1.dimension() );
+    CPPUNIT_ASSERT( T1.standardMonomials().front().constant() );
+
+    std::list<MultivariatePolynomialMRQ> line;
+    line.push_back( MultivariatePolynomialMRQ( x - y, grevlex ));
+    CPPUNIT_ASSERT_THROW( QuotientRingMultiplicationTableQ( line.begin(), line.end() ), std::invalid_argument );
+}
+
+void QuotientRingMultiplicationTableTest::testProduct()
+{
+    QuotientRingMultiplicationTableQ T1 = QuotientRingMultiplicationTableQ( system.begin(), system.end() );
+    // the product of the standard monomials y and y is x
+    const std::vector<MultivariateMonomialMR>& basis = T1.standardMonomials();
+    CPPUNIT_ASSERT( basis[1] == MultivariateMonomialMR( 1, 1 ));
+    CPPUNIT_ASSERT( T1.polynomial( T1.product( 1, 1 )) == MultivariatePolynomialMRQ( x, grevlex ));
+    // (x + y) * (x - y) = x^2 - y^2 = 2 - x
+    QuotientRingMultiplicationTableQ::Vector p = T1.coordinates( MultivariatePolynomialMRQ( x + y, grevlex ));
+    QuotientRingMultiplicationTableQ::Vector q = T1.coordinates( MultivariatePolynomialMRQ( x - y, grevlex ));
+    CPPUNIT_ASSERT( T1.polynomial( T1.multiply( p, q )) == MultivariatePolynomialMRQ( 2 - x, grevlex ));
+}
+
+void QuotientRingMultiplicationTableTest::testTrace()
+{
+    QuotientRingMultiplicationTableQ T1 = QuotientRingMultiplicationTableQ( system.begin(), system.end() );
+    // compare trace to naive trace computation: sum of the coefficients of b_j in the normal forms of p * b_j
+    MultivariatePolynomialMRQ p = MultivariatePolynomialMRQ( 3 * x * y + y + 5, grevlex );
+    RationalCoefficientMR     traceNaive;
+    const std::vector<MultivariateMonomialMR>& basis = T1.standardMonomials();
+    for( unsigned j = 0; j < basis.size(); ++j )
+        traceNaive = traceNaive + T1.coordinates( p.multiply( basis[j] ))[j];
+    CPPUNIT_ASSERT( T1.trace( p ) == traceNaive );
+    // the sum of the four solutions of the x-coordinates (2^(1/2) twice, -2^(1/2) twice) is 0, the trace of 5 is 20
+    CPPUNIT_ASSERT( T1.trace( p ) == RationalCoefficientMR( 20 ));
+}
+
+void QuotientRingMultiplicationTableTest::testRealSolutions()
+{
+    QuotientRingMultiplicationTableQ T1 = QuotientRingMultiplicationTableQ( system.begin(), system.end() );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)4, T1.nrOfComplexSolutions() );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)2, T1.nrOfRealSolutions() );
+    // both real solutions have x = 2^(1/2) > 0, and y = 2^(1/4) resp. -2^(1/4)
+    CPPUNIT_ASSERT_EQUAL( 2, T1.tarskiQuery( MultivariatePolynomialMRQ( x, grevlex )));
+    CPPUNIT_ASSERT_EQUAL( 0, T1.tarskiQuery( MultivariatePolynomialMRQ( y, grevlex )));
+
+    // a double root counts once
+    std::list<MultivariatePolynomialMRQ> square;
+    square.push_back( MultivariatePolynomialMRQ( x * x - 2 * x + 1, grevlex ));
+    QuotientRingMultiplicationTableQ T2 = QuotientRingMultiplicationTableQ( square.begin(), square.end() );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)2, T2.dimension() );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)1, T2.nrOfRealSolutions() );
+
+    // the Hermite form of x modulo x^2 - 1 is ( 0 2, 2 0 ), whose diagonal vanishes
+    std::list<MultivariatePolynomialMRQ> symmetric;
+    symmetric.push_back( MultivariatePolynomialMRQ( x * x - 1, grevlex ));
+    QuotientRingMultiplicationTableQ T5 = QuotientRingMultiplicationTableQ( symmetric.begin(), symmetric.end() );
+    CPPUNIT_ASSERT_EQUAL( 0, T5.tarskiQuery( MultivariatePolynomialMRQ( x, grevlex )));
+    CPPUNIT_ASSERT_EQUAL( 2, T5.tarskiQuery( MultivariatePolynomialMRQ( x * x, grevlex )));
+
+    // no real solutions
+    std::list<MultivariatePolynomialMRQ> circle;
+    circle.push_back( MultivariatePolynomialMRQ( x * x + y * y + 1, grevlex ));
+    circle.push_back( MultivariatePolynomialMRQ( x - y, grevlex ));
+    QuotientRingMultiplicationTableQ T3 = QuotientRingMultiplicationTableQ( circle.begin(), circle.end() );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)2, T3.nrOfComplexSolutions() );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)0, T3.nrOfRealSolutions() );
+
+    // Z/pZ is not ordered
+    std::list<MultivariatePolynomialMRZp> modular;
+    modular.push_back( MultivariatePolynomialMRZp( x * x - 2, grevlex ));
+    QuotientRingMultiplicationTableZp T4 = QuotientRingMultiplicationTableZp( modular.begin(), modular.end() );
+    CPPUNIT_ASSERT_THROW( T4.nrOfRealSolutions(), std::domain_error );
+    // the rank of the trace form only counts the distinct solutions in characteristic zero
+    CPPUNIT_ASSERT_THROW( T4.nrOfComplexSolutions(), std::domain_error );
+
+    // the Hermite form of x^2 - a with a parameter a is ( 2 0, 0 2a ), whose second pivot has an unknown sign
+    GiNaC::symbol a( "a" );
+    std::set<MultivariateTermMR, MonomMRCompare> terms( grevlex );
+    terms.insert( MultivariateTermMR( MultivariatePolynomialMR( x * x, grevlex ).lmon() ));
+    terms.insert( MultivariateTermMR( MultivariateMonomialMR(), GiNaC::ex( -a )));
+    std::list<MultivariatePolynomialMR> parametric;
+    parametric.push_back( MultivariatePolynomialMR( terms.begin(), terms.end(), grevlex ));
+    QuotientRingMultiplicationTable T6 = QuotientRingMultiplicationTable( parametric.begin(), parametric.end() );
+    CPPUNIT_ASSERT_THROW( T6.nrOfRealSolutions(), std::domain_error );
+    CPPUNIT_ASSERT_THROW( T6.tarskiQuery( MultivariatePolynomialMR( x, grevlex )), std::domain_error );
+}
@@ -0,0 +1,69 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef QUOTIENTRINGMULTIPLICATIONTABLE_UNITTEST_H
+#define QUOTIENTRINGMULTIPLICATIONTABLE_UNITTEST_H
+
+/**
+ * Unit tests for the class template QuotientRingMultiplicationTableT.
+ *
+ * @author Ulrich Loup
+ * @since 2011-07-12
+ * @version 2026-10-18
+ */
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "QuotientRingMultiplicationTable.h"
+
+using namespace GiNaCRA;
+
+class QuotientRingMultiplicationTableTest:
+    public CppUnit:: TestFixture
+{
+    // declare test suite
+    CPPUNIT_TEST_SUITE( QuotientRingMultiplicationTableTest );
+    // declare each test case
+    CPPUNIT_TEST( testConstructor );
+    CPPUNIT_TEST( testProduct );
+    CPPUNIT_TEST( testTrace );
+    CPPUNIT_TEST( testRealSolutions );
+    CPPUNIT_TEST_SUITE_END();
+
+    public:
+        void setUp();
+        void tearDown();
+
+        void testConstructor();
+        void testProduct();
+        void testTrace();
+        void testRealSolutions();
+
+    private:
+        MonomMRCompare                       grevlex;
+        symbol                               x, y;
+        /// x^2 - 2, y^2 - x: four complex solutions, two of them real
+        std::list<MultivariatePolynomialMRQ> system;
+};
+
+#endif   /** QUOTIENTRINGMULTIPLICATIONTABLE_UNITTEST_H */
@@ -27,7 +27,7 @@
  *
  * @author Ulrich Loup
  * @since 2010-09-08
- * @version 2012-03-15
+ * @version 2026-10-18
  *
  * Notation is following http://www.possibility.com/Cpp/CppCodingStandard.html.
  */
@@ -139,6 +139,32 @@ void RationalUnivariatePolynomialTest::testSignVariations()
     CPPUNIT_ASSERT_EQUAL( (unsigned)4, RationalUnivariatePolynomial::signVariations( seq, -3 ));
 }
 
+void RationalUnivariatePolynomialTest::testSturmHabichtSequence()
+{
+    list<RationalUnivariatePolynomial> seq = RationalUnivariatePolynomial::sturmHabichtSequence( p6, p6.diff() );
+    CPPUNIT_ASSERT( !seq.empty() );
+    CPPUNIT_ASSERT( (static_cast<ex>( seq.front() ) - static_cast<ex>( p6 )).expand().is_zero() );
+    for( list<RationalUnivariatePolynomial>::const_iterator i = seq.begin(); i != seq.end(); ++i )
+        for( int j = 0; j <= i->degree(); ++j )
+            CPPUNIT_ASSERT( i->coeff( j ).is_integer() );
+    // same root count as the standard Sturm sequence (Example 2.52)
+    CPPUNIT_ASSERT_EQUAL( (unsigned)4,
+                          RationalUnivariatePolynomial::signVariations( seq, -3 ) - RationalUnivariatePolynomial::signVariations( seq, 10 ));
+    seq = RationalUnivariatePolynomial::sturmHabichtSequence( p1, p1.diff() );
+    list<RationalUnivariatePolynomial> sturm = RationalUnivariatePolynomial::standardSturmSequence( p1, p1.diff() );
+    CPPUNIT_ASSERT_EQUAL( RationalUnivariatePolynomial::signVariations( sturm, -2 ) - RationalUnivariatePolynomial::signVariations( sturm, 2 ),
+                          RationalUnivariatePolynomial::signVariations( seq, -2 ) - RationalUnivariatePolynomial::signVariations( seq, 2 ));
+    CPPUNIT_ASSERT_EQUAL( (unsigned)4, p6.countRealRoots());
+
+    // the sequence of 3x^5 + 2x - 4 is defective and contains both 5 - 2x and 2x - 5, whose common root 5/2 must not change the count
+    RationalUnivariatePolynomial defective = RationalUnivariatePolynomial( 3 * pow( x, 5 ) + 2 * x - 4, x );
+    seq = RationalUnivariatePolynomial::sturmHabichtSequence( defective, defective.diff() );
+    CPPUNIT_ASSERT_EQUAL( RationalUnivariatePolynomial::signVariations( seq, numeric( 2005, 2 )),
+                          RationalUnivariatePolynomial::signVariations( seq, numeric( 5, 2 )));
+    CPPUNIT_ASSERT_EQUAL( (unsigned)1,
+                          RationalUnivariatePolynomial::signVariations( seq, 0 ) - RationalUnivariatePolynomial::signVariations( seq, numeric( 5, 2 )));
+}
+
 void RationalUnivariatePolynomialTest::testSturmCauchyIndex()
 {
     //See ISBN-13: 978-3642069642 Example 2.54
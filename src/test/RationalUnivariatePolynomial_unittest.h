@@ -28,7 +28,7 @@
  *
  * @author Ulrich Loup
  * @since 2010-09-08
- * @version 2012-01-11
+ * @version 2026-10-18
  *
  * Notation is following http://www.possibility.com/Cpp/CppCodingStandard.html.
  */
@@ -55,6 +55,7 @@ class RationalUnivariatePolynomialTest:
     CPPUNIT_TEST( testCauchyBound );
     CPPUNIT_TEST( testSturmSequence );
     CPPUNIT_TEST( testSignVariations );
+    CPPUNIT_TEST( testSturmHabichtSequence );
     CPPUNIT_TEST( testSturmCauchyIndex );
     CPPUNIT_TEST( testRemainderTarskiQuery );
     CPPUNIT_TEST( testMemory );
@@ -81,6 +82,7 @@ class RationalUnivariatePolynomialTest:
      void testCauchyBound();
      void testSturmSequence();
      void testSignVariations();
+     void testSturmHabichtSequence();
      void testSturmCauchyIndex();
      void testRemainderTarskiQuery();
      void testSquare();
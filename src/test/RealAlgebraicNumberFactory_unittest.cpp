@@ -24,7 +24,7 @@
  * @file RealAlgebraicNumberFactory_unittest.cpp
  *
  * @since: 2011-04-08
- * @version 2012-05-05
+ * @version 2026-10-18
  * @author: Joachim Redies
  * @author: Ulrich Loup
  */
@@ -40,6 +40,7 @@ using GiNaCRA::RealAlgebraicNumberIR;
 using GiNaCRA::RealAlgebraicNumberFactory;
 using GiNaCRA::UnivariatePolynomial;
 using GiNaCRA::RationalUnivariatePolynomial;
+using GiNaCRA::RealAlgebraicNumberSettings;
 
 // test suite
 CPPUNIT_TEST_SUITE_REGISTRATION( RealAlgebraicNumberFactoryTest );
@@ -147,3 +148,51 @@ void RealAlgebraicNumberFactoryTest::testRealRootsEval()
     //    for( auto i = points.begin(); i != points.end(); ++i )
     //        std::cout << " " << *i << std::endl;
 }
+
+void RealAlgebraicNumberFactoryTest::testSturmHabichtStrategy()
+{
+    symbol x( "x" );
+    // the second polynomial has a defective Sturm-Habicht sequence with proportional neighbours
+    list<RationalUnivariatePolynomial> polynomials;
+    polynomials.push_back( RationalUnivariatePolynomial( pow( x, 4 ) - 2, x ));
+    polynomials.push_back( RationalUnivariatePolynomial( 3 * pow( x, 5 ) + 2 * x - 4, x ));
+    polynomials.push_back( RationalUnivariatePolynomial( pow( x, 5 ) - 3 * pow( x, 4 ) + pow( x, 3 ) - pow( x, 2 ) + 2 * x - 2, x ));
+    polynomials.push_back( RationalUnivariatePolynomial( (x * (x - 5) * (x + 5) * (x - 23) * (x + 2)).expand(), x ));
+    for( list<RationalUnivariatePolynomial>::const_iterator p = polynomials.begin(); p != polynomials.end(); ++p )
+    {
+        list<RealAlgebraicNumberPtr> standard = RealAlgebraicNumberFactory::realRoots( *p );
+        list<RealAlgebraicNumberPtr> habicht  = RealAlgebraicNumberFactory::realRoots( *p, RealAlgebraicNumberSettings::DEFAULT_ISOLATIONSTRATEGY,
+                                                                                       RealAlgebraicNumberSettings::STURMHABICHT_STURMSEQUENCESTRATEGY );
+        CPPUNIT_ASSERT_EQUAL( p->countRealRoots(), p->countRealRoots( RealAlgebraicNumberSettings::STURMHABICHT_STURMSEQUENCESTRATEGY ));
+        CPPUNIT_ASSERT_EQUAL( standard.size(), habicht.size() );
+        standard.sort();
+        habicht.sort();
+        for( list<RealAlgebraicNumberPtr>::const_iterator i = standard.begin(), j = habicht.begin(); i != standard.end(); ++i, ++j )
+        {
+            CPPUNIT_ASSERT( *i == *j );
+            RealAlgebraicNumberIRPtr root = std::tr1::dynamic_pointer_cast<RealAlgebraicNumberIR>( *j );
+            if( root != 0 )
+                CPPUNIT_ASSERT( root->sturmSequenceStrategy() == RealAlgebraicNumberSettings::STURMHABICHT_STURMSEQUENCESTRATEGY );
+        }
+    }
+
+    // refinement and sign determination of 2^(1/4) by Sturm-Habicht sequences
+    list<RealAlgebraicNumberPtr> roots = RealAlgebraicNumberFactory::realRoots( polynomials.front(), RealAlgebraicNumberSettings::DEFAULT_ISOLATIONSTRATEGY,
+                                                                                RealAlgebraicNumberSettings::STURMHABICHT_STURMSEQUENCESTRATEGY );
+    roots.sort();
+    RealAlgebraicNumberIRPtr root = std::tr1::dynamic_pointer_cast<RealAlgebraicNumberIR>( roots.back() );
+    CPPUNIT_ASSERT( root != 0 );
+    root->refine( numeric( 1, 1000 ));
+    CPPUNIT_ASSERT( root->interval().right() - root->interval().left() < numeric( 1, 1000 ));
+    CPPUNIT_ASSERT_EQUAL( (unsigned)1, RationalUnivariatePolynomial::countRealRoots( polynomials.front(), root->interval() ));
+    CPPUNIT_ASSERT( root->interval().left() < numeric( 11893, 10000 ) && numeric( 11892, 10000 ) < root->interval().right() );
+    CPPUNIT_ASSERT_EQUAL( GiNaC::NEGATIVE_SIGN, root->sgn( RationalUnivariatePolynomial( pow( x, 2 ) - 2, x )));
+    CPPUNIT_ASSERT_EQUAL( GiNaC::ZERO_SIGN, root->sgn( RationalUnivariatePolynomial( pow( x, 8 ) - 4, x )));
+    // numbers computed from the root keep the strategy
+    RealAlgebraicNumberIR& negated = root->minus();
+    CPPUNIT_ASSERT( negated.sturmSequenceStrategy() == RealAlgebraicNumberSettings::STURMHABICHT_STURMSEQUENCESTRATEGY );
+    CPPUNIT_ASSERT_EQUAL( GiNaC::NEGATIVE_SIGN, negated.sgn() );
+    CPPUNIT_ASSERT_EQUAL( GiNaC::ZERO_SIGN, negated.sgn( RationalUnivariatePolynomial( pow( x, 4 ) - 2, x )));
+    CPPUNIT_ASSERT_EQUAL( GiNaC::POSITIVE_SIGN, negated.sgn( RationalUnivariatePolynomial( -x, x )));
+    delete &negated;
+}
@@ -24,7 +24,7 @@
  * RealAlgebraicNumberFactory_unittest.h
  *
  * @since: 2011-04-08
- * @version 2012-05-05
+ * @version 2026-10-18
  * @author: Joachim Redies
  * @author: Ulrich Loup
  */
@@ -44,6 +44,7 @@ class RealAlgebraicNumberFactoryTest:
     CPPUNIT_TEST( testRealRoots );
     CPPUNIT_TEST( testCommonRealRoots );
     CPPUNIT_TEST( testRealRootsEval );
+    CPPUNIT_TEST( testSturmHabichtStrategy );
 
  // declare each test case
  CPPUNIT_TEST_SUITE_END()
@@ -60,6 +61,7 @@ class RealAlgebraicNumberFactoryTest:
      void testRealRoots();
      void testCommonRealRoots();
      void testRealRootsEval();
+     void testSturmHabichtStrategy();
 
 };
 
@@ -27,19 +27,23 @@
  *
  * @author Ulrich Loup
  * @since 2010-09-06
- * @version 2012-04-20
+ * @version 2026-10-18
  *
  * Notation is following http://www.possibility.com/Cpp/CppCodingStandard.html.
  */
 
 #include "UnivariatePolynomial_unittest.h"
 #include "utilities.h"
+#include "DenseUnivariateArithmetic.h"
+#include "ModularGcd.h"
 #include "operators.h"
 
 using std::vector;
 using std::map;
 using std::cout;
 using std::endl;
+using GiNaCRA::DenseUnivariateArithmetic;
+using GiNaCRA::ModularGcd;
 
 // test suite
 CPPUNIT_TEST_SUITE_REGISTRATION( UnivariatePolynomialTest );
@@ -259,4 +263,122 @@ void UnivariatePolynomialTest::testSubresultants()
     SUBRESTEST_NONDEFECTIVE( p );
     p = a * pow( x, 5 ) + b * pow( x, 4 ) + c;
     SUBRESTEST_PARTLYDEFECTIVE( p );
+
+    // the optimized strategies compute the same sequence, also in case of large degree gaps
+    ex q = a * pow( x, 2 ) + b;
+    p    = pow( x, 7 ) + c * pow( x, 3 ) + a * x + 1;
+    list<UnivariatePolynomial> generic = UnivariatePolynomial::subresultants( UnivariatePolynomial( p, x ), UnivariatePolynomial( q, x ));
+    // the subresultant of index 0 is the resultant
+    ex resultant = GiNaC::resultant( p, q, x );
+    CPPUNIT_ASSERT( (generic.front() - resultant).expand().is_zero() || (generic.front() + resultant).expand().is_zero() );
+    for( int strategy = UnivariatePolynomial::LAZARDS_SUBRESULTANTSTRATEGY; strategy <= UnivariatePolynomial::DUCOS_SUBRESULTANTSTRATEGY; ++strategy )
+    {
+        list<UnivariatePolynomial> optimized = UnivariatePolynomial::subresultants( UnivariatePolynomial( p, x ), UnivariatePolynomial( q, x ),
+                                                                                    (UnivariatePolynomial::subresultantStrategy)strategy );
+        CPPUNIT_ASSERT_EQUAL( generic.size(), optimized.size() );
+        for( list<UnivariatePolynomial>::const_iterator i = generic.begin(), j = optimized.begin(); i != generic.end(); ++i, ++j )
+            CPPUNIT_ASSERT( (*i - *j).expand().is_zero() );
+        ex         r            = pow( x, 6 ) + a * pow( x, 4 ) + b * pow( x, 3 ) + c;
+        vector<ex> genericPSC   = UnivariatePolynomial::principalSubresultantCoefficients( UnivariatePolynomial( r, x ), UnivariatePolynomial( r.diff( x ), x ));
+        vector<ex> optimizedPSC = UnivariatePolynomial::principalSubresultantCoefficients( UnivariatePolynomial( r, x ), UnivariatePolynomial( r.diff( x ), x ),
+                                                                                           (UnivariatePolynomial::subresultantStrategy)strategy );
+        CPPUNIT_ASSERT_EQUAL( genericPSC.size(), optimizedPSC.size() );
+        for( unsigned k = 0; k < genericPSC.size(); ++k )
+            CPPUNIT_ASSERT( (genericPSC[k] - optimizedPSC[k]).expand().is_zero() );
+    }
+
+    // the first degree gap is 2, the second is 1: the leading coefficient of the first reduction is lcoeff( q )^2, not lcoeff( q )^1
+    p         = 2 * pow( x, 5 ) + x + 1;
+    q         = 3 * pow( x, 3 ) + 1;
+    generic   = UnivariatePolynomial::subresultants( UnivariatePolynomial( p, x ), UnivariatePolynomial( q, x ));
+    resultant = GiNaC::resultant( p, q, x );
+    CPPUNIT_ASSERT( resultant == 8 || resultant == -8 );
+    CPPUNIT_ASSERT( (generic.front() - resultant).expand().is_zero() || (generic.front() + resultant).expand().is_zero() );
+    for( int strategy = UnivariatePolynomial::LAZARDS_SUBRESULTANTSTRATEGY; strategy <= UnivariatePolynomial::DUCOS_SUBRESULTANTSTRATEGY; ++strategy )
+    {
+        list<UnivariatePolynomial> optimized = UnivariatePolynomial::subresultants( UnivariatePolynomial( p, x ), UnivariatePolynomial( q, x ),
+                                                                                    (UnivariatePolynomial::subresultantStrategy)strategy );
+        CPPUNIT_ASSERT( (optimized.front() - generic.front()).expand().is_zero() );
+    }
+}
+
+void UnivariatePolynomialTest::testModularSubresultants()
+{
+    symbol a( "a" ), b( "b" ), c( "c" );
+    // rational coefficients: the discriminant-like coefficients of x^2/2 + b*x + c
+    ex         p   = pow( x, 2 ) / 2 + b * x + c;
+    vector<ex> psc = UnivariatePolynomial::principalSubresultantCoefficients( UnivariatePolynomial( p, x ), UnivariatePolynomial( p.diff( x ), x ),
+                                                                              UnivariatePolynomial::MODULAR_SUBRESULTANTSTRATEGY );
+    CPPUNIT_ASSERT_EQUAL( (size_t)2, psc.size() );
+    CPPUNIT_ASSERT( (psc[0] - (c - pow( b, 2 ) / 2)).expand().is_zero() );
+    CPPUNIT_ASSERT( (psc[1] - 1).expand().is_zero() );
+
+    // the leading coefficient y*x vanishes at an evaluation point; the arguments are swapped
+    psc = UnivariatePolynomial::principalSubresultantCoefficients( UnivariatePolynomial( y * x, x ), UnivariatePolynomial( pow( x, 3 ) + y, x ),
+                                                                   UnivariatePolynomial::MODULAR_SUBRESULTANTSTRATEGY );
+    CPPUNIT_ASSERT_EQUAL( (size_t)2, psc.size() );
+    CPPUNIT_ASSERT( (psc[0] - pow( y, 4 )).expand().is_zero() );
+    CPPUNIT_ASSERT( (psc[1] - pow( y, 2 )).expand().is_zero() );
+
+    // non-defective case: the generic algorithm yields the same coefficients up to sign
+    // (the generic algorithm additionally lists the leading coefficient of p)
+    p = pow( x, 4 ) + a * pow( x, 2 ) + b * x + c;
+    psc = UnivariatePolynomial::principalSubresultantCoefficients( UnivariatePolynomial( p, x ), UnivariatePolynomial( p.diff( x ), x ),
+                                                                   UnivariatePolynomial::MODULAR_SUBRESULTANTSTRATEGY );
+    vector<ex> generic = UnivariatePolynomial::principalSubresultantCoefficients( UnivariatePolynomial( p, x ), UnivariatePolynomial( p.diff( x ), x ));
+    CPPUNIT_ASSERT_EQUAL( (size_t)4, psc.size() );
+    CPPUNIT_ASSERT( generic.size() >= psc.size() );
+    for( unsigned k = 0; k < psc.size(); ++k )
+        CPPUNIT_ASSERT( (generic[k] - psc[k]).expand().is_zero() || (generic[k] + psc[k]).expand().is_zero() );
+}
+
+void UnivariatePolynomialTest::testDenseArithmetic()
+{
+    // all multiplication methods agree
+    DenseUnivariateArithmetic::IntegerPolynomial a, b;
+    for( int i = 0; i < 300; ++i )
+    {
+        a.push_back( cln::cl_I( i * i - 7 * i + 3 ));
+        b.push_back( cln::cl_I( 5 - 11 * i ));
+    }
+    a.back() = cln::expt_pos( cln::cl_I( 10 ), 40 );    // forces several primes
+    DenseUnivariateArithmetic::IntegerPolynomial product = DenseUnivariateArithmetic::schoolbookMultiply( a, b );
+    CPPUNIT_ASSERT_EQUAL( (size_t)599, product.size() );
+    CPPUNIT_ASSERT( product == DenseUnivariateArithmetic::karatsubaMultiply( a, b ));
+    CPPUNIT_ASSERT( product == DenseUnivariateArithmetic::nttMultiply( a, b ));
+    CPPUNIT_ASSERT( product == DenseUnivariateArithmetic::multiply( a, b ));
+
+    // division, gcd and separable part above the degree threshold agree with GiNaC
+    ex f = pow( x + 2, 70 ) + 3 * x - 1;
+    ex g = pow( x, 35 ) / 2 - 5 * pow( x, 2 ) + 7;
+    CPPUNIT_ASSERT( (UnivariatePolynomial( f, x ).rem( UnivariatePolynomial( g, x )) - GiNaC::rem( f, g, x )).expand().is_zero() );
+    CPPUNIT_ASSERT( (UnivariatePolynomial( f, x ).quo( UnivariatePolynomial( g, x )) - GiNaC::quo( f, g, x )).expand().is_zero() );
+    UnivariatePolynomial h = UnivariatePolynomial( ((pow( x, 2 ) + 1) * pow( x + 2, 70 )).expand(), x ).gcd( UnivariatePolynomial( (6 * (pow( x, 2 ) + 1) * pow( x - 1, 66 )).expand(), x ));
+    CPPUNIT_ASSERT( (h - (pow( x, 2 ) + 1)).expand().is_zero() );
+    h = UnivariatePolynomial( (pow( x - 1, 2 ) * pow( x + 2, 70 )).expand(), x ).sepapart();
+    CPPUNIT_ASSERT( (h - (x - 1) * (x + 2)).expand().is_zero() || (h + (x - 1) * (x + 2)).expand().is_zero() );
+}
+
+void UnivariatePolynomialTest::testModularGcd()
+{
+    symbol z( "z" );
+    // the coefficients of g exceed a word, so several primes and the sparse interpolation are needed
+    ex g = numeric( "123456789012345678" ) * pow( x, 2 ) * y - 987654321 * x * pow( z, 3 ) + 5 * y * z - 1;
+    ex a = (6 * g * (pow( x, 3 ) + y * z + 2)).expand();
+    ex b = (4 * g * (x * pow( y, 2 ) - 3 * z + 7)).expand();
+    ex h = ModularGcd::gcd( a, b );
+    CPPUNIT_ASSERT( (h - 2 * g).expand().is_zero() || (h + 2 * g).expand().is_zero() );
+    CPPUNIT_ASSERT( (ModularGcd::gcd( pow( x, 2 ) * y - y, x * y + y ) - (x + 1) * y).expand().is_zero() );
+    CPPUNIT_ASSERT( (ModularGcd::gcd( x + y, x - y ) - 1).expand().is_zero() );
+    // rational coefficients are left to GiNaC
+    CPPUNIT_ASSERT( (ModularGcd::gcd( x / 2 + y / 2, x + y ) - GiNaC::gcd( x / 2 + y / 2, x + y )).expand().is_zero() );
+
+    // content and primitive part with respect to x
+    UnivariatePolynomial p = UnivariatePolynomial( (2 * g * y * (pow( x, 2 ) + 1)).expand(), x );
+    ex c = p.content();
+    CPPUNIT_ASSERT( (c - 2 * y).expand().is_zero() );
+    CPPUNIT_ASSERT( (p.primpart() * c - p).expand().is_zero() );
+    UnivariatePolynomial q = UnivariatePolynomial( (3 * pow( y + z, 2 ) * (pow( x, 2 ) - 1)).expand(), x );
+    CPPUNIT_ASSERT( (q.content() - 3 * pow( y + z, 2 )).expand().is_zero() );
+    CPPUNIT_ASSERT( (q.primpart() - (pow( x, 2 ) - 1)).expand().is_zero() );
 }
@@ -28,7 +28,7 @@
  *
  * @author Ulrich Loup
  * @since 2010-09-06
- * @version 2012-05-15
+ * @version 2026-10-18
  *
  * Notation is following http://www.possibility.com/Cpp/CppCodingStandard.html.
  */
@@ -65,6 +65,9 @@ class UnivariatePolynomialTest:
     CPPUNIT_TEST( testSquare );
     CPPUNIT_TEST( testMemory );
     CPPUNIT_TEST( testSubresultants );
+    CPPUNIT_TEST( testModularSubresultants );
+    CPPUNIT_TEST( testDenseArithmetic );
+    CPPUNIT_TEST( testModularGcd );
 
  CPPUNIT_TEST_SUITE_END()
 
@@ -102,5 +105,8 @@ class UnivariatePolynomialTest:
      void testSquare();
      void testMemory();
      void testSubresultants();
+     void testModularSubresultants();
+     void testDenseArithmetic();
+     void testModularGcd();
 };
 #endif // GINACRA_UNIVARIATEPOLYNOMIAL_TEST_H
@@ -0,0 +1,137 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+/**
+ * Unit tests for the class UnivariateRepresentation.
+ *
+ * @since 2026-10-18
+ * @version 2026-10-18
+ */
+
+#include "UnivariateRepresentation_unittest.h"
+#include "VariableListPool.h"
+
+// test suite
+CPPUNIT_TEST_SUITE_REGISTRATION( UnivariateRepresentationTest );
+
+void UnivariateRepresentationTest::setUp()
+{
+    grevlex = MonomMRCompare( &MultivariateMonomialMR::GrRevLexCompare );
+    x       = VariableListPool::getVariableSymbol( 0 );
+    y       = VariableListPool::getVariableSymbol( 1 );
+}
+
+void UnivariateRepresentationTest::tearDown(){}
+
+void UnivariateRepresentationTest::testConstructor()
+{
+    symbol t = symbol( "t" );
+    // x = t, y = t^2 at the roots of t^2 - 2, written with denominator 1
+    list<RationalUnivariatePolynomial> numerators;
+    numerators.push_back( RationalUnivariatePolynomial( t, t ));
+    numerators.push_back( RationalUnivariatePolynomial( t * t, t ));
+    vector<symbol> variables;
+    variables.push_back( x );
+    variables.push_back( y );
+    UnivariateRepresentation r = UnivariateRepresentation( RationalUnivariatePolynomial( t * t - 2, t ), RationalUnivariatePolynomial( 1, t ), numerators, variables );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)2, r.nrOfRealSolutions() );
+    CPPUNIT_ASSERT( r.SeparatingForm().empty() );
+
+    variables.pop_back();
+    CPPUNIT_ASSERT_THROW( UnivariateRepresentation( RationalUnivariatePolynomial( t * t - 2, t ), RationalUnivariatePolynomial( 1, t ), numerators, variables ),
+                          invalid_argument );
+    variables.push_back( y );
+    CPPUNIT_ASSERT_THROW( UnivariateRepresentation( RationalUnivariatePolynomial( t * t - 2, t ), RationalUnivariatePolynomial( t * t - 2, t ), numerators, variables ),
+                          invalid_argument );
+}
+
+void UnivariateRepresentationTest::testGroebner()
+{
+    // x^2 - 1, y^2 - 1: neither x nor x + y separates the four solutions
+    std::list<MultivariatePolynomialMRQ> system;
+    system.push_back( MultivariatePolynomialMRQ( x * x - 1, grevlex ));
+    system.push_back( MultivariatePolynomialMRQ( y * y - 1, grevlex ));
+    GroebnerQ gb = GroebnerQ( system.begin(), system.end() );
+    gb.solve();
+    gb.reduce();
+    UnivariateRepresentation r = UnivariateRepresentation( gb );
+    CPPUNIT_ASSERT_EQUAL( 4, r.RootSource().degree() );
+    CPPUNIT_ASSERT_EQUAL( (size_t)2, r.Variables().size() );
+    CPPUNIT_ASSERT_EQUAL( (size_t)2, r.Numerators().size() );
+    CPPUNIT_ASSERT( r.SeparatingForm().size() == 2 && !r.SeparatingForm()[1].is_zero() && !r.SeparatingForm()[1].is_equal( 1 ) );
+    CPPUNIT_ASSERT_EQUAL( (unsigned)4, r.nrOfRealSolutions() );
+
+    // a double solution is represented once
+    system.clear();
+    system.push_back( MultivariatePolynomialMRQ( x * x, grevlex ));
+    system.push_back( MultivariatePolynomialMRQ( y - 1, grevlex ));
+    GroebnerQ gb2 = GroebnerQ( system.begin(), system.end() );
+    gb2.solve();
+    gb2.reduce();
+    CPPUNIT_ASSERT_EQUAL( 1, UnivariateRepresentation( gb2 ).RootSource().degree() );
+
+    // no solutions
+    system.clear();
+    system.push_back( MultivariatePolynomialMRQ( x * x + 1, grevlex ));
+    system.push_back( MultivariatePolynomialMRQ( x * y - 1, grevlex ));
+    GroebnerQ gb3 = GroebnerQ( system.begin(), system.end() );
+    gb3.solve();
+    gb3.reduce();
+    CPPUNIT_ASSERT_EQUAL( (unsigned)0, UnivariateRepresentation( gb3 ).nrOfRealSolutions() );
+}
+
+void UnivariateRepresentationTest::testRealSolutions()
+{
+    // x^2 - 2, y^2 - x: the real solutions are (2^(1/2), 2^(1/4)) and (2^(1/2), -2^(1/4))
+    std::list<MultivariatePolynomialMRQ> system;
+    system.push_back( MultivariatePolynomialMRQ( x * x - 2, grevlex ));
+    system.push_back( MultivariatePolynomialMRQ( y * y - x, grevlex ));
+    QuotientRingMultiplicationTableQ table = QuotientRingMultiplicationTableQ( system.begin(), system.end() );
+    UnivariateRepresentation         r     = UnivariateRepresentation( table );
+    CPPUNIT_ASSERT_EQUAL( table.nrOfRealSolutions(), r.nrOfRealSolutions() );
+    list<RealAlgebraicPoint> solutions = r.realSolutions();
+    CPPUNIT_ASSERT_EQUAL( (size_t)2, solutions.size() );
+    int ySigns = 0;
+    for( list<RealAlgebraicPoint>::const_iterator p = solutions.begin(); p != solutions.end(); ++p )
+    {
+        CPPUNIT_ASSERT_EQUAL( (unsigned)2, p->dim() );
+        CPPUNIT_ASSERT_EQUAL( GiNaC::POSITIVE_SIGN, p->at( 0 )->sgn() );
+        CPPUNIT_ASSERT_EQUAL( GiNaC::ZERO_SIGN, p->at( 0 )->sgn( RationalUnivariatePolynomial( x * x - 2, x )));
+        CPPUNIT_ASSERT_EQUAL( GiNaC::ZERO_SIGN, p->at( 1 )->sgn( RationalUnivariatePolynomial( y * y * y * y - 2, y )));
+        ySigns += p->at( 1 )->sgn();
+    }
+    CPPUNIT_ASSERT_EQUAL( 0, ySigns );
+
+    // x * y - 1, x^2 - 4: the rational solutions (2, 1/2) and (-2, -1/2)
+    system.clear();
+    system.push_back( MultivariatePolynomialMRQ( x * y - 1, grevlex ));
+    system.push_back( MultivariatePolynomialMRQ( x * x - 4, grevlex ));
+    solutions = UnivariateRepresentation( QuotientRingMultiplicationTableQ( system.begin(), system.end() )).realSolutions();
+    CPPUNIT_ASSERT_EQUAL( (size_t)2, solutions.size() );
+    for( list<RealAlgebraicPoint>::const_iterator p = solutions.begin(); p != solutions.end(); ++p )
+    {
+        CPPUNIT_ASSERT_EQUAL( GiNaC::ZERO_SIGN, p->at( 0 )->sgn( RationalUnivariatePolynomial( x * x - 4, x )));
+        CPPUNIT_ASSERT_EQUAL( GiNaC::ZERO_SIGN, p->at( 1 )->sgn( RationalUnivariatePolynomial( 4 * y * y - 1, y )));
+        CPPUNIT_ASSERT_EQUAL( p->at( 0 )->sgn(), p->at( 1 )->sgn() );
+    }
+}
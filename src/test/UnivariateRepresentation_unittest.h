@@ -0,0 +1,64 @@
+/*
+ * GiNaCRA - GiNaC Real Algebra package
+ * Copyright (C) 2010-2012  Ulrich Loup, Joachim Redies, Sebastian Junges
+ *
+ * This file is part of GiNaCRA.
+ *
+ * GiNaCRA is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * GiNaCRA is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with GiNaCRA.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+
+#ifndef UNIVARIATEREPRESENTATION_UNITTEST_H
+#define UNIVARIATEREPRESENTATION_UNITTEST_H
+
+/**
+ * Unit tests for the class UnivariateRepresentation.
+ *
+ * @since 2026-10-18
+ * @version 2026-10-18
+ */
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "UnivariateRepresentation.h"
+
+using namespace GiNaCRA;
+
+class UnivariateRepresentationTest:
+    public CppUnit:: TestFixture
+{
+    // declare test suite
+    CPPUNIT_TEST_SUITE( UnivariateRepresentationTest );
+    // declare each test case
+    CPPUNIT_TEST( testConstructor );
+    CPPUNIT_TEST( testGroebner );
+    CPPUNIT_TEST( testRealSolutions );
+    CPPUNIT_TEST_SUITE_END();
+
+    public:
+        void setUp();
+        void tearDown();
+
+        void testConstructor();
+        void testGroebner();
+        void testRealSolutions();
+
+    private:
+        MonomMRCompare grevlex;
+        symbol         x, y;
+};
+
+#endif   /** UNIVARIATEREPRESENTATION_UNITTEST_H */
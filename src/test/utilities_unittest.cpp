@@ -27,7 +27,7 @@
  *
  * @author Ulrich Loup
  * @since 2010-12-15
- * @version 2012-03-20
+ * @version 2026-10-18
  */
 
 #include <cln/cln.h>
@@ -88,6 +88,36 @@ void utilitiesTest::testDenominator()
             CPPUNIT_ASSERT_EQUAL( cln::denominator( cln::cl_I( i ) / cln::cl_I( j )), cln::cl_I( GiNaC::denominator( i, j )));
 }
 
+void utilitiesTest::testChineseRemainder()
+{
+    CPPUNIT_ASSERT_EQUAL( cln::cl_I( 8 ), chineseRemainder( 2, 3, 3, 5 ));
+    CPPUNIT_ASSERT_EQUAL( cln::cl_I( 0 ), chineseRemainder( 0, 7, 0, 11 ));
+    CPPUNIT_ASSERT_THROW( chineseRemainder( 1, 4, 1, 6 ), invalid_argument );
+}
+
+void utilitiesTest::testRationalReconstruction()
+{
+    cln::cl_I  m = cln::cl_I( 2147483647 ) * cln::cl_I( 2147483629 );
+    cln::cl_RA r;
+    for( int num = -20; num <= 20; ++num )
+    {
+        for( int den = 1; den <= 20; ++den )
+        {
+            cln::cl_RA q = cln::cl_RA( num ) / cln::cl_RA( den );
+            // image of q modulo m
+            cln::cl_I u, v;
+            cln::xgcd( cln::denominator( q ), m, &u, &v );
+            cln::cl_I a = cln::mod( cln::numerator( q ) * u, m );
+            CPPUNIT_ASSERT( rationalReconstruction( a, m, r ));
+            CPPUNIT_ASSERT_EQUAL( q, r );
+        }
+    }
+    // 1/2 modulo 11 is 6, but 3 has no preimage with numerator and denominator bounded by sqrt(11/2)
+    CPPUNIT_ASSERT( rationalReconstruction( 6, 11, r ));
+    CPPUNIT_ASSERT_EQUAL( cln::cl_RA( 1 ) / cln::cl_RA( 2 ), r );
+    CPPUNIT_ASSERT( !rationalReconstruction( 3, 11, r ));
+}
+
 void utilitiesTest::testCoeffpart()
 {
 #ifdef GINACRA_UTILITIESTEST_DEBUG
@@ -134,4 +164,17 @@ void utilitiesTest::testSubresultants()
     CPPUNIT_ASSERT_EQUAL( v[2], ex( 0 ));
     CPPUNIT_ASSERT_EQUAL( v[1], ex( -100 * pow( a, 3 ) * pow( b, 2 ) * pow( c, 2 )));
     CPPUNIT_ASSERT_EQUAL( v[0], ex( 256 * a * pow( b, 5 ) * pow( c, 3 ) + 3125 * pow( a, 5 ) * pow( c, 4 )));
+
+    // the dense sequence is indexed by the degree and agrees with the map
+    vector<vector<ex> > dense = signedSubresultants( denseCoefficients( P, z ), denseCoefficients( PP, z ));
+    CPPUNIT_ASSERT_EQUAL( (size_t)6, dense.size() );
+    CPPUNIT_ASSERT( dense[5].empty() );
+    CPPUNIT_ASSERT( dense[2].size() < 3 );    // defective
+    for( map<int, ex>::const_iterator i = subres.begin(); i != subres.end(); ++i )
+    {
+        CPPUNIT_ASSERT_EQUAL( (size_t)(i->second.degree( z ) + 1), dense[i->first].size() );
+        for( unsigned d = 0; d < dense[i->first].size(); ++d )
+            CPPUNIT_ASSERT( (dense[i->first][d] - i->second.coeff( z, d )).expand().is_zero() );
+    }
+    CPPUNIT_ASSERT_THROW( signedSubresultants( vector<ex>(), denseCoefficients( PP, z )), invalid_argument );
 }
@@ -47,6 +47,8 @@ class utilitiesTest:
     CPPUNIT_TEST( testGcd );
     CPPUNIT_TEST( testNumerator );
     CPPUNIT_TEST( testDenominator );
+    CPPUNIT_TEST( testChineseRemainder );
+    CPPUNIT_TEST( testRationalReconstruction );
     CPPUNIT_TEST( testCoeffpart );
     CPPUNIT_TEST( testMonpart );
     CPPUNIT_TEST( testIsolateByVariables );
@@ -72,6 +74,8 @@ class utilitiesTest:
      void testGcd();
      void testNumerator();
      void testDenominator();
+     void testChineseRemainder();
+     void testRationalReconstruction();
      void testCoeffpart();
      void testMonpart();
      void testIsolateByVariables();